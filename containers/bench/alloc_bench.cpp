@@ -0,0 +1,119 @@
+#include "bench.hpp"
+
+/*
+**	Alloc: the allocations of the suite workloads, through an
+**	ft::tracking_allocator with its own stats per container. For each size:
+**	the number of allocations of the operations that grow a container, the
+**	peak of live bytes per element, and the bytes still allocated once the
+**	container is gone. These counts do not depend on the machine, so the
+**	regression gate flags any increase, see gate.cpp.
+*/
+
+#define ALLOC_MIDDLE_OPS 100
+
+typedef ft::tracking_allocator<int>											int_tracker;
+typedef ft::tracking_allocator< ft::pair<const int, int> >	ft_pair_tracker;
+typedef ft::tracking_allocator< std::pair<const int, int> >	std_pair_tracker;
+
+static double	alloc_per_elem( std::size_t bytes, std::size_t n ) {
+	return n ? static_cast<double>(bytes) / n : 0;
+}
+
+/*****      VECTOR      *****/
+
+template < class Vector >
+static void	alloc_vector( const std::string& name, std::size_t n ) {
+	ft::allocation_stats stats;
+	{
+		Vector v((int_tracker(stats)));
+		for (std::size_t i = 0; i < n; i++) {
+			v.push_back(static_cast<int>(i));
+		}
+		bench_report_count("push_back", name, n, "allocs", stats.allocations);
+		bench_report_count("peak", name, n, "bytes/elem", alloc_per_elem(stats.peak_bytes, n));
+
+		std::size_t before = stats.allocations;
+		Vector c(v);
+		bench_report_count("copy", name, n, "allocs", stats.allocations - before);
+
+		before = stats.allocations;
+		for (int i = 0; i < ALLOC_MIDDLE_OPS; i++) {
+			c.insert(c.begin() + c.size() / 2, i);
+		}
+		bench_report_count("insert_mid", name, n, "allocs", stats.allocations - before);
+	}
+	bench_report_count("leaked", name, n, "bytes", stats.live_bytes);
+}
+
+/*****      STACK      *****/
+
+template < class Stack >
+static void	alloc_stack( const std::string& name, std::size_t n ) {
+	ft::allocation_stats stats;
+	{
+		Stack s((typename Stack::container_type(int_tracker(stats))));
+		for (std::size_t i = 0; i < n; i++) {
+			s.push(static_cast<int>(i));
+		}
+		bench_report_count("push", name, n, "allocs", stats.allocations);
+		bench_report_count("peak", name, n, "bytes/elem", alloc_per_elem(stats.peak_bytes, n));
+
+		std::size_t before = stats.allocations;
+		Stack c(s);
+		bench_report_count("copy", name, n, "allocs", stats.allocations - before);
+
+		before = stats.allocations;
+		while (!s.empty()) {
+			s.pop();
+		}
+		bench_report_count("pop", name, n, "allocs", stats.allocations - before);
+	}
+	bench_report_count("leaked", name, n, "bytes", stats.live_bytes);
+}
+
+/*****      MAP      *****/
+
+template < class Map, class Tracker >
+static void	alloc_map( const std::string& name, const std::vector<int>& keys ) {
+	std::size_t n = keys.size();
+	ft::allocation_stats stats;
+	std::less<int> less;
+	{
+		Map m(less, Tracker(stats));
+		for (std::size_t i = 0; i < n; i++) {
+			m.insert(typename Map::value_type(keys[i], static_cast<int>(i)));
+		}
+		bench_report_count("insert", name, n, "allocs", stats.allocations);
+		bench_report_count("peak", name, n, "bytes/elem", alloc_per_elem(stats.peak_bytes, n));
+
+		std::size_t before = stats.allocations;
+		Map c(m);
+		bench_report_count("copy", name, n, "allocs", stats.allocations - before);
+
+		before = stats.allocations;
+		for (std::size_t i = 0; i < n; i++) {
+			m.erase(keys[i]);
+		}
+		bench_report_count("erase", name, n, "allocs", stats.allocations - before);
+	}
+	bench_report_count("leaked", name, n, "bytes", stats.live_bytes);
+}
+
+void	bench_alloc() {
+	srand(42);
+	bench_header("count");
+	for (std::size_t n = 1000; n <= g_bench_max_n; n *= 10) {
+		std::vector<int> keys(n);
+		for (std::size_t i = 0; i < n; i++) {
+			keys[i] = rand() % (4 * n);
+		}
+
+		alloc_vector< ft::vector<int, int_tracker> >("ft::vector", n);
+		alloc_vector< std::vector<int, int_tracker> >("std::vector", n);
+		alloc_stack< ft::stack<int, ft::vector<int, int_tracker> > >("ft::stack", n);
+		alloc_stack< std::stack<int, std::deque<int, int_tracker> > >("std::stack", n);
+		alloc_map< ft::map<int, int, std::less<int>, ft_pair_tracker>, ft_pair_tracker >("ft::map", keys);
+		alloc_map< std::map<int, int, std::less<int>, std_pair_tracker>, std_pair_tracker >("std::map", keys);
+		bench_note("");
+	}
+}
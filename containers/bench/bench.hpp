@@ -0,0 +1,112 @@
+#pragma once
+
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+# include "../class/utils.hpp"
+
+/*
+**	Bench
+**
+**	Helpers shared by the benchmarks of the `make bench` target.
+**	Unlike the test binaries, every benchmark instantiates ft:: and std:: side by side,
+**	so one run is enough to compare both implementations.
+**	Results go to the standard output as an aligned table, CSV or a JSON array,
+**	chosen once with bench_begin(). Measurements timed with bench_counters()
+**	also report the hardware counters per operation, when the system allows them.
+*/
+
+enum bench_format { bench_text, bench_csv, bench_json };
+
+// Samples of one measurement, kept for the regression gate. Only the ns/op
+// ones are noisy: counts of allocations and bytes are exact.
+struct bench_row
+{
+	std::string					section;
+	std::string					op;
+	std::string					container;
+	std::size_t					n;
+	std::string					unit;
+	std::vector<double>	samples;
+};
+
+// Largest N of the scalable workloads, from --max-n
+extern std::size_t	g_bench_max_n;
+// Repetitions of the scalable workloads, from --repetitions (0: depends on N)
+extern std::size_t	g_bench_repetitions;
+// Trace replayed by the replay benchmark, from --trace (empty: synthetic ones)
+extern std::string	g_bench_trace;
+// Every bench_report_stats() since the start of the run
+extern std::vector<bench_row>	g_bench_rows;
+
+long long	now_ns();
+const ft::perf_counters	*bench_counters();
+void		bench_begin( bench_format format );
+void		bench_end();
+void		bench_section( const std::string& name, const std::string& title );
+void		bench_note( const std::string& line );
+void		bench_header( const std::string& unit = "ns/op" );
+void		bench_report( const std::string& op, const std::string& container, std::size_t n, long long total_ns, std::size_t ops );
+void		bench_report_stats( const std::string& op, const std::string& container, std::size_t n, const ft::perf_timer& timer );
+void		bench_report_count( const std::string& op, const std::string& container, std::size_t n, const char *unit, double value );
+void		bench_report_latency( const std::string& container, std::size_t n, std::vector<double> samples );
+
+bool		bench_gate_record( const std::string& path );
+int			bench_gate_compare( const std::string& path, double threshold );
+void		bench_report_bytes( const std::string& container, std::size_t n, std::size_t bytes );
+
+void		bench_map();
+void		bench_btree();
+void		bench_concurrent();
+void		bench_unordered();
+void		bench_radix();
+void		bench_compact();
+void		bench_small();
+void		bench_suite();
+void		bench_alloc();
+void		bench_latency();
+void		bench_replay();
+void		bench_keys();
+
+/*
+**	Bench_allocator
+**
+**	ft::tracking_allocator whose copies all count into the same stats, so that the
+**	memory footprint of a container is the difference of bench_live_bytes() before
+**	and after filling it.
+*/
+
+struct bench_tag {};
+
+template < class T >
+class bench_allocator : public ft::tracking_allocator<T, bench_tag>
+{
+	public:
+
+		template < class U >
+		struct rebind {
+			typedef bench_allocator<U> other;
+		};
+
+		bench_allocator()
+			: ft::tracking_allocator<T, bench_tag>() {
+		};
+
+		bench_allocator( const bench_allocator& other )
+			: ft::tracking_allocator<T, bench_tag>(other) {
+		};
+
+		template < class U >
+		bench_allocator( const bench_allocator<U>& other )
+			: ft::tracking_allocator<T, bench_tag>(other) {
+		};
+
+		~bench_allocator() {
+		};
+};
+
+inline std::size_t	bench_live_bytes() {
+	return ft::tracking_allocator<char, bench_tag>::tag_stats().live_bytes;
+}
+
+#endif /* BENCH_HPP */
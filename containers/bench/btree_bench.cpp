@@ -0,0 +1,79 @@
+#include "bench.hpp"
+
+typedef bench_allocator<ft::pair<const int, int> >		ft_pair_alloc;
+typedef bench_allocator<std::pair<const int, int> >		std_pair_alloc;
+
+typedef ft::btree_map<int, int, std::less<int>, ft_pair_alloc>	bench_btree_map;
+typedef ft::map<int, int, std::less<int>, ft_pair_alloc>				bench_ft_map;
+typedef std::map<int, int, std::less<int>, std_pair_alloc>			bench_std_map;
+
+static volatile long long	g_sink;
+
+/*
+**	Runs insert, find, range scan and full scan on one map type and reports
+**	the time per operation and the memory held per element.
+*/
+
+template < class Map >
+static void	bench_ordered_map( const std::string& name, const std::vector<int>& keys, const std::vector<int>& probes ) {
+	std::size_t n = keys.size();
+	std::size_t bytes_before = bench_live_bytes();
+	long long sum = 0;
+	Map m;
+
+	long long start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		m.insert(typename Map::value_type(keys[i], static_cast<int>(i)));
+	}
+	bench_report("insert", name, n, now_ns() - start, n);
+	bench_report_bytes(name, n, bench_live_bytes() - bytes_before);
+
+	start = now_ns();
+	for (std::size_t i = 0; i < probes.size(); i++) {
+		typename Map::iterator it = m.find(probes[i]);
+		if (it != m.end()) {
+			sum += it->second;
+		}
+	}
+	bench_report("find", name, n, now_ns() - start, probes.size());
+
+	const std::size_t ranges = 1000;
+	const std::size_t width = 100;
+	std::size_t visited = 0;
+	start = now_ns();
+	for (std::size_t i = 0; i < ranges; i++) {
+		typename Map::iterator it = m.lower_bound(probes[i % probes.size()]);
+		for (std::size_t j = 0; j < width && it != m.end(); j++, ++it) {
+			sum += it->second;
+			visited++;
+		}
+	}
+	bench_report("range_scan", name, n, now_ns() - start, visited);
+
+	start = now_ns();
+	for (typename Map::iterator it = m.begin(); it != m.end(); ++it) {
+		sum += it->first;
+	}
+	bench_report("full_scan", name, n, now_ns() - start, n);
+	g_sink = sum;
+}
+
+void	bench_btree() {
+	std::size_t sizes[] = { 10000, 100000, 1000000 };
+
+	srand(42);
+	bench_header();
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t n = sizes[s];
+		std::vector<int> keys(n);
+		std::vector<int> probes(n);
+		for (std::size_t i = 0; i < n; i++) {
+			keys[i] = rand();
+			probes[i] = (i % 2) ? keys[rand() % n] : rand();
+		}
+		bench_ordered_map<bench_btree_map>("ft::btree_map", keys, probes);
+		bench_ordered_map<bench_ft_map>("ft::map", keys, probes);
+		bench_ordered_map<bench_std_map>("std::map", keys, probes);
+		bench_note("");
+	}
+}
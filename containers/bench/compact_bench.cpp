@@ -0,0 +1,82 @@
+#include "bench.hpp"
+
+/*
+**	Compact map against the pointer-based maps on int keys: bytes per element,
+**	then find and a full in-order scan on a map fragmented by erasing and
+**	inserting half of its keys, and the same again after defragment().
+*/
+
+typedef bench_allocator<ft::pair<const int, int> >		ft_int_alloc;
+typedef bench_allocator<std::pair<const int, int> >		std_int_alloc;
+
+static volatile long long	g_sink;
+
+template < class Map >
+static void	bench_lookup_scan( const std::string& op, const std::string& name, const Map& m, const std::vector<int>& keys ) {
+	std::size_t n = keys.size();
+	long long sum = 0;
+
+	long long start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		sum += m.count(keys[(i * 7919) % n]);
+	}
+	bench_report("find" + op, name, n, now_ns() - start, n);
+
+	start = now_ns();
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it) {
+		sum += it->second;
+	}
+	bench_report("scan" + op, name, n, now_ns() - start, m.size());
+	g_sink = sum;
+}
+
+// Fill m with keys, then erase and insert back every other key in another order
+template < class Map >
+static void	bench_fragment( const std::string& name, Map& m, const std::vector<int>& keys ) {
+	std::size_t n = keys.size();
+	std::size_t bytes_before = bench_live_bytes();
+
+	long long start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		m.insert(typename Map::value_type(keys[i], static_cast<int>(i)));
+	}
+	bench_report("insert", name, n, now_ns() - start, n);
+	bench_report_bytes(name, n, bench_live_bytes() - bytes_before);
+	for (std::size_t i = 0; i < n; i += 2) {
+		m.erase(keys[i]);
+	}
+	for (std::size_t i = n; i >= 2; i -= 2) {
+		m.insert(typename Map::value_type(keys[i - 2], static_cast<int>(i)));
+	}
+	bench_lookup_scan("", name, m, keys);
+}
+
+void	bench_compact() {
+	std::size_t sizes[] = { 10000, 100000, 1000000 };
+
+	srand(42);
+	bench_header();
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t n = sizes[s];
+		std::vector<int> keys(n);
+		for (std::size_t i = 0; i < n; i++) {
+			keys[i] = rand();
+		}
+
+		ft::compact_map<int, int, std::less<int>, ft_int_alloc> compact;
+		bench_fragment("ft::compact_map", compact, keys);
+		long long start = now_ns();
+		compact.defragment();
+		bench_report("defragment", "ft::compact_map", n, now_ns() - start, compact.size());
+		bench_lookup_scan("_defrag", "ft::compact_map", compact, keys);
+		{
+			ft::map<int, int, std::less<int>, ft_int_alloc> mine;
+			bench_fragment("ft::map", mine, keys);
+		}
+		{
+			std::map<int, int, std::less<int>, std_int_alloc> real;
+			bench_fragment("std::map", real, keys);
+		}
+		bench_note("");
+	}
+}
@@ -0,0 +1,120 @@
+#include "bench.hpp"
+
+#include <pthread.h>
+
+/*
+**	Throughput of ft::concurrent_map under a growing number of threads.
+**	Readers and writers are scaled independently: each row runs R reader threads
+**	(find on random keys) next to W writer threads (insert/erase pairs on random keys)
+**	for a fixed time, on a map prefilled with half of the key space.
+**	The single-shard map is the baseline: one lock around a whole ft::map.
+*/
+
+typedef ft::concurrent_map<int, int>	bench_concurrent_map;
+
+static const int				g_key_space = 1 << 20;
+static const long long	g_run_ns = 200000000LL;
+static volatile int			g_concurrent_sink;
+
+struct bench_thread
+{
+	bench_concurrent_map	*map;
+	bool									writer;
+	unsigned int					seed;
+	volatile bool					*stop;
+	std::size_t						ops;
+};
+
+static void	*bench_concurrent_run( void *arg ) {
+	bench_thread *t = static_cast<bench_thread *>(arg);
+	std::size_t ops = 0;
+	int value = 0;
+
+	while (!*t->stop) {
+		for (int i = 0; i < 64; i++) {
+			int k = static_cast<int>(rand_r(&t->seed) % g_key_space);
+			if (t->writer) {
+				if (t->map->insert(ft::make_pair(k, k)) == false) {
+					t->map->erase(k);
+				}
+			}
+			else {
+				t->map->find(k, value);
+			}
+		}
+		ops += 64;
+	}
+	t->ops = ops;
+	g_concurrent_sink = value;
+	return NULL;
+}
+
+// Run readers and writers for g_run_ns and return the total number of operations
+static std::size_t	bench_concurrent_round( bench_concurrent_map& map, int readers, int writers ) {
+	std::vector<bench_thread>	threads(readers + writers);
+	std::vector<pthread_t>		ids(readers + writers);
+	volatile bool							stop = false;
+
+	for (int i = 0; i < readers + writers; i++) {
+		threads[i].map = &map;
+		threads[i].writer = i >= readers;
+		threads[i].seed = 42 + i;
+		threads[i].stop = &stop;
+		threads[i].ops = 0;
+		pthread_create(&ids[i], NULL, bench_concurrent_run, &threads[i]);
+	}
+	struct timespec ts;
+	ts.tv_sec = g_run_ns / 1000000000LL;
+	ts.tv_nsec = g_run_ns % 1000000000LL;
+	nanosleep(&ts, NULL);
+	stop = true;
+	std::size_t total = 0;
+	for (int i = 0; i < readers + writers; i++) {
+		pthread_join(ids[i], NULL);
+		total += threads[i].ops;
+	}
+	return total;
+}
+
+static void	bench_concurrent_shards( std::size_t shards, int readers, int writers ) {
+	bench_concurrent_map map(shards);
+	for (int k = 0; k < g_key_space; k += 2) {
+		map.insert(ft::make_pair(k, k));
+	}
+	long long start = now_ns();
+	std::size_t ops = bench_concurrent_round(map, readers, writers);
+	long long elapsed = now_ns() - start;
+
+	std::ostringstream name;
+	name << shards << (shards > 1 ? " shards" : " shard");
+	std::ostringstream op;
+	op << readers << "R/" << writers << "W";
+	// ns/op is wall time per operation over all threads: the inverse of throughput
+	bench_report(op.str(), name.str(), static_cast<std::size_t>(readers + writers), elapsed, ops);
+}
+
+void	bench_concurrent() {
+	const int threads[] = { 1, 2, 4, 8, 16, 32, 64 };
+	const int count = sizeof(threads) / sizeof(*threads);
+
+	bench_header();
+	for (int i = 0; i < count; i++) {
+		bench_concurrent_shards(1, threads[i], 0);
+		bench_concurrent_shards(64, threads[i], 0);
+	}
+	bench_note("");
+	for (int i = 0; i < count; i++) {
+		bench_concurrent_shards(1, 0, threads[i]);
+		bench_concurrent_shards(64, 0, threads[i]);
+	}
+	bench_note("");
+	for (int i = 0; i < count; i++) {
+		bench_concurrent_shards(1, threads[i], 1);
+		bench_concurrent_shards(64, threads[i], 1);
+	}
+	bench_note("");
+	for (int i = 0; i < count; i++) {
+		bench_concurrent_shards(1, 1, threads[i]);
+		bench_concurrent_shards(64, 1, threads[i]);
+	}
+}
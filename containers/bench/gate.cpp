@@ -0,0 +1,341 @@
+#include "bench.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <set>
+
+/*
+**	Regression gate
+**
+**	The samples of one run are correlated: a busy or throttled machine slows all
+**	of them, and the next run may be 30% faster. So the unit of the gate is the
+**	run (--runs R runs the benchmarks R times), and the value of an ft::
+**	operation in a run is the ratio of its median to the median of the same std::
+**	operation in the same run, which absorbs the speed of the machine at the time.
+**	bench_gate_record() writes the median of every repeated measurement of every
+**	run to a baseline file, one line per measurement:
+**		<bench> <operation> <container> <N> <runs> <median of run 1>...
+**	bench_gate_compare() computes the R ratios of the run and of the baseline
+**	and flags an ft:: operation as regressed when both hold:
+**		- the median ratio is more than threshold percent above the baseline one;
+**		- a one-sided Mann-Whitney U test says the new ratios are larger,
+**		 so that one slow run is not enough.
+**	The U test compares ranks, not values, so it needs no assumption on the
+**	distribution of the timings, which is skewed to the right. The gate runs
+**	one test per ft:: operation, about 40 of them, so the p-values go through
+**	the Holm-Bonferroni correction: the probability that a run without any
+**	regression fails the gate stays under GATE_ALPHA. With 7 runs on each
+**	side the smallest p-value is 1/3432, enough for 40 tests.
+**	Counts of allocations and bytes (bench_report_count()) are the same on
+**	every run and every machine: they are compared as they are, and any
+**	increase of an ft:: one is a regression.
+*/
+
+#define GATE_ALPHA 0.05
+#define GATE_MIN_RUNS 5
+// Counts are recorded with 3 decimals
+#define GATE_EXACT_EPSILON 0.0005
+
+struct gate_count
+{
+	const bench_row	*row;
+	double					before;
+	double					after;
+	bool						known;
+	const char			*status;
+};
+
+struct gate_result
+{
+	const bench_row	*row;
+	double					before;
+	double					after;
+	double					change;
+	double					p;
+	bool						tested;
+	const char			*status;
+};
+
+static bool	gate_by_p( const gate_result *a, const gate_result *b ) {
+	return a->p < b->p;
+}
+
+typedef std::map< std::string, std::vector<double> >	gate_runs;
+
+static std::string	gate_key( const std::string& section, const std::string& op, const std::string& container, std::size_t n ) {
+	std::ostringstream key;
+	key << section << ' ' << op << ' ' << container << ' ' << n;
+	return key.str();
+}
+
+static double	gate_median( std::vector<double> samples ) {
+	return ft::perf_summarize(samples).median;
+}
+
+// Median of every run of every measurement, in the order of the runs
+static gate_runs	gate_collect() {
+	gate_runs runs;
+	for (std::size_t i = 0; i < g_bench_rows.size(); i++) {
+		const bench_row& row = g_bench_rows[i];
+		runs[gate_key(row.section, row.op, row.container, row.n)].push_back(gate_median(row.samples));
+	}
+	return runs;
+}
+
+// Ratios of the runs of an ft:: measurement to the runs of its std:: counterpart
+static std::vector<double>	gate_ratios( const gate_runs& runs, const std::string& key, const std::string& std_key ) {
+	std::vector<double> ratios;
+	gate_runs::const_iterator mine = runs.find(key);
+	gate_runs::const_iterator real = runs.find(std_key);
+	if (mine == runs.end() || real == runs.end()) {
+		return ratios;
+	}
+	for (std::size_t r = 0; r < mine->second.size() && r < real->second.size(); r++) {
+		if (real->second[r] > 0) {
+			ratios.push_back(mine->second[r] / real->second[r]);
+		}
+	}
+	return ratios;
+}
+
+/*
+**	Gate_exact_tail
+**
+**	P(U >= u) when n1 and n0 samples without ties come from the same
+**	distribution: every order of the n1 + n0 samples is equally likely, and
+**	count[i][j][v] is the number of orders of i and j samples with U = v.
+**	The last sample is either from the first group, above the j others, or not.
+*/
+
+static double	gate_exact_tail( std::size_t n1, std::size_t n0, std::size_t u ) {
+	std::size_t umax = n1 * n0;
+	std::vector< std::vector< std::vector<double> > > count(n1 + 1,
+		std::vector< std::vector<double> >(n0 + 1, std::vector<double>(umax + 1, 0)));
+	for (std::size_t i = 0; i <= n1; i++) {
+		for (std::size_t j = 0; j <= n0; j++) {
+			if (i == 0 || j == 0) {
+				count[i][j][0] = 1;
+				continue;
+			}
+			for (std::size_t v = 0; v <= i * j; v++) {
+				count[i][j][v] = (v >= j ? count[i - 1][j][v - j] : 0) + count[i][j - 1][v];
+			}
+		}
+	}
+	double tail = 0;
+	double total = 0;
+	for (std::size_t v = 0; v <= umax; v++) {
+		total += count[n1][n0][v];
+		tail += v >= u ? count[n1][n0][v] : 0;
+	}
+	return tail / total;
+}
+
+/*
+**	Gate_mann_whitney
+**
+**	p-value of the one-sided test "slower tends to be larger than faster":
+**	exact for small samples without ties, else from the normal approximation
+**	of U with the tie and continuity corrections.
+*/
+
+static double	gate_mann_whitney( const std::vector<double>& slower, const std::vector<double>& faster ) {
+	std::vector< std::pair<double, int> > all;
+	for (std::size_t i = 0; i < slower.size(); i++) {
+		all.push_back(std::make_pair(slower[i], 1));
+	}
+	for (std::size_t i = 0; i < faster.size(); i++) {
+		all.push_back(std::make_pair(faster[i], 0));
+	}
+	std::sort(all.begin(), all.end());
+
+	double n1 = slower.size();
+	double n0 = faster.size();
+	double total = all.size();
+	double rank_sum = 0;
+	double ties = 0;
+	for (std::size_t i = 0; i < all.size(); ) {
+		std::size_t j = i;
+		while (j < all.size() && all[j].first == all[i].first) {
+			j++;
+		}
+		// Equal values share the mean of their ranks i + 1 .. j
+		double rank = (i + 1 + j) / 2.0;
+		double t = j - i;
+		ties += t * t * t - t;
+		for (; i < j; i++) {
+			rank_sum += all[i].second * rank;
+		}
+	}
+	double u = rank_sum - n1 * (n1 + 1) / 2;
+	if (ties == 0 && slower.size() <= 20 && faster.size() <= 20) {
+		return gate_exact_tail(slower.size(), faster.size(), static_cast<std::size_t>(u + 0.5));
+	}
+	double mean = n1 * n0 / 2;
+	double var = n1 * n0 / 12 * ((total + 1) - ties / (total * (total - 1)));
+	if (var <= 0) {
+		return 1;
+	}
+	double z = (u - mean - 0.5) / sqrt(var);
+	return 0.5 * erfc(z / sqrt(2.0));
+}
+
+bool	bench_gate_record( const std::string& path ) {
+	std::ofstream out(path.c_str());
+	if (!out) {
+		std::cerr << "ft_bench: cannot write " << path << std::endl;
+		return false;
+	}
+	gate_runs runs = gate_collect();
+	out << "# ft_bench baseline, median ns/op per run: <bench> <operation> <container> <N> <runs> <median>..." << std::endl;
+	out << std::fixed << std::setprecision(3);
+	for (gate_runs::const_iterator it = runs.begin(); it != runs.end(); ++it) {
+		out << it->first << ' ' << it->second.size();
+		for (std::size_t r = 0; r < it->second.size(); r++) {
+			out << ' ' << it->second[r];
+		}
+		out << std::endl;
+	}
+	return true;
+}
+
+/*
+**	Bench_gate_compare
+**
+**	Prints one line per ft:: measurement and returns the number of
+**	regressions, or -1 when the baseline cannot be read.
+*/
+
+int	bench_gate_compare( const std::string& path, double threshold ) {
+	std::ifstream in(path.c_str());
+	if (!in) {
+		std::cerr << "ft_bench: cannot read " << path << std::endl;
+		return -1;
+	}
+	gate_runs baseline;
+	std::string line;
+	while (std::getline(in, line)) {
+		if (line.empty() || line[0] == '#') {
+			continue;
+		}
+		std::istringstream fields(line);
+		std::string section, op, container;
+		std::size_t n, count;
+		fields >> section >> op >> container >> n >> count;
+		std::vector<double> medians(count);
+		for (std::size_t r = 0; r < count; r++) {
+			fields >> medians[r];
+		}
+		if (fields) {
+			baseline[gate_key(section, op, container, n)] = medians;
+		}
+	}
+
+	gate_runs current = gate_collect();
+	std::set<std::string> done;
+	std::vector<gate_result> results;
+	std::vector<gate_count> counts;
+	int regressions = 0;
+	for (std::size_t i = 0; i < g_bench_rows.size(); i++) {
+		const bench_row& row = g_bench_rows[i];
+		std::string key = gate_key(row.section, row.op, row.container, row.n);
+		if (row.container.compare(0, 4, "ft::") != 0 || !done.insert(key).second) {
+			continue;
+		}
+		if (row.unit != "ns/op") {
+			gate_runs::const_iterator was = baseline.find(key);
+			gate_count c = { &row, 0, gate_median(current[key]), false, "new" };
+			if (was != baseline.end() && !was->second.empty()) {
+				c.before = gate_median(was->second);
+				c.known = true;
+				c.status = "ok";
+				if (c.after > c.before + GATE_EXACT_EPSILON) {
+					c.status = "\e[91mREGRESSED\e[39m";
+					regressions++;
+				}
+				else if (c.after < c.before - GATE_EXACT_EPSILON) {
+					c.status = "fewer";
+				}
+			}
+			counts.push_back(c);
+			continue;
+		}
+		std::string std_key = gate_key(row.section, row.op, "std::" + row.container.substr(4), row.n);
+		std::vector<double> was = gate_ratios(baseline, key, std_key);
+		std::vector<double> now = gate_ratios(current, key, std_key);
+		gate_result r = { &row, 0, 0, 0, 1, false, "new" };
+		if (!was.empty() && !now.empty()) {
+			r.before = gate_median(was);
+			r.after = gate_median(now);
+			r.change = r.before > 0 ? (r.after - r.before) / r.before * 100 : 0;
+			r.p = gate_mann_whitney(now, was);
+			r.tested = now.size() >= GATE_MIN_RUNS && was.size() >= GATE_MIN_RUNS;
+			r.status = "ok";
+			if (!r.tested) {
+				r.status = "too few runs";
+			}
+			else if (r.change > threshold) {
+				r.status = "noise";
+			}
+			else if (r.change < -threshold && gate_mann_whitney(was, now) < GATE_ALPHA) {
+				r.status = "faster";
+			}
+		}
+		results.push_back(r);
+	}
+
+	// Holm-Bonferroni: the k-th smallest p-value of m tests must be below alpha / (m - k)
+	std::vector<gate_result *> tested;
+	for (std::size_t i = 0; i < results.size(); i++) {
+		if (results[i].tested) {
+			tested.push_back(&results[i]);
+		}
+	}
+	std::sort(tested.begin(), tested.end(), gate_by_p);
+	for (std::size_t k = 0; k < tested.size() && tested[k]->p < GATE_ALPHA / (tested.size() - k); k++) {
+		if (tested[k]->change > threshold) {
+			tested[k]->status = "\e[91mREGRESSED\e[39m";
+			regressions++;
+		}
+	}
+
+	if (!results.empty()) {
+		std::cout << std::endl << std::left << std::setw(14) << "operation" << std::setw(14) << "container" << std::right
+			<< std::setw(10) << "N" << std::setw(12) << "baseline" << std::setw(12) << "current" << std::setw(10) << "change"
+			<< std::setw(10) << "p-value" << "  status" << std::endl;
+		std::cout << std::left << std::setw(38) << "" << std::right << std::setw(12) << "x std" << std::setw(12) << "x std" << std::endl;
+	}
+	for (std::size_t i = 0; i < results.size(); i++) {
+		const gate_result& r = results[i];
+		std::cout << std::left << std::setw(14) << r.row->op << std::setw(14) << r.row->container << std::right << std::setw(10) << r.row->n;
+		if (r.before == 0 && r.after == 0) {
+			std::cout << std::setw(12) << "-" << std::setw(12) << "-" << std::setw(10) << "-" << std::setw(10) << "-" << "  new" << std::endl;
+			continue;
+		}
+		std::cout << std::fixed << std::setprecision(2) << std::setw(12) << r.before << std::setw(12) << r.after
+			<< std::setprecision(1) << std::showpos << std::setw(9) << r.change << '%' << std::noshowpos
+			<< std::setprecision(4) << std::setw(10) << r.p << "  " << r.status << std::endl;
+	}
+	if (!counts.empty()) {
+		std::cout << std::endl << std::left << std::setw(14) << "operation" << std::setw(14) << "container" << std::right
+			<< std::setw(10) << "N" << std::setw(12) << "unit" << std::setw(12) << "baseline" << std::setw(12) << "current"
+			<< "  status" << std::endl;
+	}
+	for (std::size_t i = 0; i < counts.size(); i++) {
+		const gate_count& c = counts[i];
+		std::cout << std::left << std::setw(14) << c.row->op << std::setw(14) << c.row->container << std::right
+			<< std::setw(10) << c.row->n << std::setw(12) << c.row->unit << std::fixed << std::setprecision(2);
+		if (c.known) {
+			std::cout << std::setw(12) << c.before;
+		}
+		else {
+			std::cout << std::setw(12) << "-";
+		}
+		std::cout << std::setw(12) << c.after << "  " << c.status << std::endl;
+	}
+	std::cout.unsetf(std::ios_base::floatfield);
+	std::cout << std::endl << regressions << " regression(s): timings above " << threshold << "% with family-wise alpha " << GATE_ALPHA
+		<< ", or counts above the baseline" << std::endl;
+	return regressions;
+}
@@ -0,0 +1,116 @@
+#include "bench.hpp"
+
+/*
+**	Keys: map and vector workloads on each distribution of ft::key_generator,
+**	ft:: against std::, with a fixed seed so that every run draws the same keys.
+**	Map: insert N keys of the distribution in the order drawn, find N more of the
+**	same distribution, erase the first ones. Vector: keep N keys sorted by
+**	inserting each one at its lower bound (O(N) each, so at most KEYS_VECTOR_MAX
+**	keys), then look up N more by binary search. Last, maps of random strings of
+**	two lengths. Each distribution is its own section, keys_<name> in CSV and JSON.
+*/
+
+#define KEYS_SEED 42
+#define KEYS_VECTOR_MAX 10000
+#define KEYS_MAP_MAX 1000000
+
+static volatile long long	g_sink;
+
+template < class Map, class Key >
+static void	keys_map( const std::string& name, const std::vector<Key>& keys, const std::vector<Key>& probes ) {
+	std::size_t n = keys.size();
+	long long sum = 0;
+	Map m;
+
+	long long start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		m.insert(typename Map::value_type(keys[i], static_cast<int>(i)));
+	}
+	bench_report("insert", name, n, now_ns() - start, n);
+
+	start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		typename Map::iterator it = m.find(probes[i]);
+		if (it != m.end()) {
+			sum += it->second;
+		}
+	}
+	bench_report("find", name, n, now_ns() - start, n);
+
+	start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		sum += m.erase(keys[i]);
+	}
+	bench_report("erase", name, n, now_ns() - start, n);
+	g_sink = sum;
+}
+
+template < class Vector >
+static void	keys_vector( const std::string& name, const std::vector<int>& keys, const std::vector<int>& probes ) {
+	std::size_t n = keys.size();
+	long long sum = 0;
+	Vector v;
+
+	long long start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		v.insert(std::lower_bound(v.begin(), v.end(), keys[i]), keys[i]);
+	}
+	bench_report("sorted_insert", name, n, now_ns() - start, n);
+
+	start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		sum += std::lower_bound(v.begin(), v.end(), probes[i]) - v.begin();
+	}
+	bench_report("lower_bound", name, n, now_ns() - start, n);
+	g_sink = sum;
+}
+
+static void	keys_distribution( ft::key_distribution distribution ) {
+	std::string name = ft::key_generator::name(distribution);
+	bench_section("keys_" + name, "\n\e[95m-" + name + "-\e[39m");
+	bench_header();
+	std::size_t max_n = std::min<std::size_t>(g_bench_max_n, KEYS_MAP_MAX);
+
+	for (std::size_t n = 10000; n <= max_n; n *= 10) {
+		ft::key_generator gen(KEYS_SEED);
+		std::vector<int> keys = gen.integers<int>(distribution, n, 4 * n);
+		std::vector<int> probes = gen.integers<int>(distribution, n, 4 * n);
+
+		keys_map< ft::map<int, int> >("ft::map", keys, probes);
+		keys_map< std::map<int, int> >("std::map", keys, probes);
+		if (n <= KEYS_VECTOR_MAX) {
+			keys_vector< ft::vector<int> >("ft::vector", keys, probes);
+			keys_vector< std::vector<int> >("std::vector", keys, probes);
+		}
+		bench_note("");
+	}
+}
+
+static void	keys_strings() {
+	std::size_t lengths[] = { 8, 64 };
+
+	bench_section("keys_string", "\n\e[95m-random strings-\e[39m");
+	bench_header();
+	std::size_t n = std::min<std::size_t>(g_bench_max_n, KEYS_MAP_MAX / 10);
+	for (std::size_t l = 0; l < sizeof(lengths) / sizeof(*lengths); l++) {
+		ft::key_generator gen(KEYS_SEED);
+		std::vector<std::string> keys = gen.strings(n, lengths[l], lengths[l]);
+		std::vector<std::string> probes(keys);
+		for (std::size_t i = n; i > 1; i--) {
+			std::swap(probes[i - 1], probes[gen.below(i)]);
+		}
+
+		std::ostringstream suffix;
+		suffix << " " << lengths[l] << "B";
+		keys_map< ft::map<std::string, int> >("ft::map" + suffix.str(), keys, probes);
+		keys_map< std::map<std::string, int> >("std::map" + suffix.str(), keys, probes);
+		bench_note("");
+	}
+}
+
+void	bench_keys() {
+	for (int d = 0; d < ft::key_distribution_count; d++) {
+		keys_distribution(static_cast<ft::key_distribution>(d));
+	}
+	keys_strings();
+}
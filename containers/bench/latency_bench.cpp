@@ -0,0 +1,33 @@
+#include "bench.hpp"
+
+/*
+**	Latency: the duration of every single push_back of a sequence of N, from an
+**	empty vector. The median is the same for all the vectors, the tail is not:
+**	ft::vector and std::vector copy every element when they grow, so their
+**	slowest push_back grows with N, while ft::incremental_vector spreads that
+**	copy over the push_back that follow.
+*/
+
+template < class Vector >
+static void	latency_push_back( const std::string& name, std::size_t n ) {
+	std::vector<double> samples(n);
+	Vector v;
+
+	for (std::size_t i = 0; i < n; i++) {
+		long long start = now_ns();
+		v.push_back(static_cast<int>(i));
+		samples[i] = static_cast<double>(now_ns() - start);
+	}
+	ft::do_not_optimize(v.back());
+	bench_report_latency(name, n, samples);
+}
+
+void	bench_latency() {
+	for (std::size_t n = 10000; n <= g_bench_max_n; n *= 10) {
+		bench_header("ns");
+		latency_push_back< ft::vector<int> >("ft::vector", n);
+		latency_push_back< std::vector<int> >("std::vector", n);
+		latency_push_back< ft::incremental_vector<int> >("ft::incremental", n);
+		bench_note("");
+	}
+}
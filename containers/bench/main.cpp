@@ -0,0 +1,164 @@
+#include "bench.hpp"
+
+#include <set>
+
+/*
+**	Usage: ft_bench [--csv | --json] [--max-n N] [--repetitions N] [--runs R]
+**		[--record FILE | --compare FILE [--threshold PCT]] [--trace FILE] [name...]
+**
+**	Runs every benchmark, or only the ones named, and prints the results
+**	as a table, CSV or JSON. --max-n caps the sizes of the suite workloads and
+**	--repetitions fixes their number of samples. --runs runs everything R times.
+**	--record writes the samples of the run to a baseline file; --compare checks
+**	the run against one and exits with 1 when an ft:: operation got more than
+**	PCT percent slower (10 by default) or allocates more, see gate.cpp.
+**	--trace gives the recorded trace the replay benchmark runs.
+**	An unknown option or benchmark name prints this usage and exits with 2.
+*/
+
+static const char	*g_bench_names[] = {
+	"map", "btree", "concurrent", "unordered", "radix", "compact", "small",
+	"suite", "alloc", "latency", "replay", "keys"
+};
+
+static bool	bench_selected( const std::set<std::string>& only, const std::string& name ) {
+	return only.empty() || only.count(name);
+}
+
+static bool	bench_known( const std::string& name ) {
+	for (std::size_t i = 0; i < sizeof(g_bench_names) / sizeof(*g_bench_names); i++) {
+		if (name == g_bench_names[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static int	bench_usage( const char *program, const std::string& arg ) {
+	std::cerr << program << ": unknown argument '" << arg << "'" << std::endl;
+	std::cerr << "Usage: " << program << " [--csv | --json] [--max-n N] [--repetitions N] [--runs R]" << std::endl;
+	std::cerr << "\t[--record FILE | --compare FILE [--threshold PCT]] [--trace FILE] [name...]" << std::endl;
+	std::cerr << "Names:";
+	for (std::size_t i = 0; i < sizeof(g_bench_names) / sizeof(*g_bench_names); i++) {
+		std::cerr << " " << g_bench_names[i];
+	}
+	std::cerr << std::endl;
+	return (2);
+}
+
+int main( int argc, char **argv ) {
+	std::set<std::string> only;
+	std::string record;
+	std::string compare;
+	double threshold = 10;
+	int runs = 1;
+	bench_format format = bench_text;
+
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		if (arg == "--csv") {
+			format = bench_csv;
+		}
+		else if (arg == "--json") {
+			format = bench_json;
+		}
+		else if (arg == "--max-n" && i + 1 < argc) {
+			g_bench_max_n = static_cast<std::size_t>(atof(argv[++i]));
+		}
+		else if (arg == "--repetitions" && i + 1 < argc) {
+			g_bench_repetitions = static_cast<std::size_t>(atof(argv[++i]));
+		}
+		else if (arg == "--runs" && i + 1 < argc) {
+			runs = atoi(argv[++i]);
+		}
+		else if (arg == "--record" && i + 1 < argc) {
+			record = argv[++i];
+		}
+		else if (arg == "--compare" && i + 1 < argc) {
+			compare = argv[++i];
+		}
+		else if (arg == "--threshold" && i + 1 < argc) {
+			threshold = atof(argv[++i]);
+		}
+		else if (arg == "--trace" && i + 1 < argc) {
+			g_bench_trace = argv[++i];
+		}
+		else if (bench_known(arg)) {
+			only.insert(arg);
+		}
+		else {
+			return bench_usage(argv[0], arg);
+		}
+	}
+
+	bench_begin(format);
+
+	for (int run = 0; run < runs; run++) {
+		if (runs > 1) {
+			std::ostringstream title;
+			title << "\n\e[93mRun " << run + 1 << "/" << runs << "\e[39m";
+			bench_note(title.str());
+		}
+		if (bench_selected(only, "map")) {
+			bench_section("map", "\n\e[96m*** MAP ***\e[39m");
+			bench_map();
+		}
+		if (bench_selected(only, "btree")) {
+			bench_section("btree", "\n\e[96m*** BTREE_MAP ***\e[39m");
+			bench_btree();
+		}
+		if (bench_selected(only, "concurrent")) {
+			bench_section("concurrent", "\n\e[96m*** CONCURRENT_MAP ***\e[39m");
+			bench_concurrent();
+		}
+		if (bench_selected(only, "unordered")) {
+			bench_section("unordered", "\n\e[96m*** UNORDERED_MAP ***\e[39m");
+			bench_unordered();
+		}
+		if (bench_selected(only, "radix")) {
+			bench_section("radix", "\n\e[96m*** RADIX_MAP ***\e[39m");
+			bench_radix();
+		}
+		if (bench_selected(only, "compact")) {
+			bench_section("compact", "\n\e[96m*** COMPACT_MAP ***\e[39m");
+			bench_compact();
+		}
+		if (bench_selected(only, "small")) {
+			bench_section("small", "\n\e[96m*** SMALL_MAP ***\e[39m");
+			bench_small();
+		}
+		if (bench_selected(only, "suite")) {
+			bench_section("suite", "\n\e[96m*** SUITE ***\e[39m");
+			bench_suite();
+		}
+		if (bench_selected(only, "alloc")) {
+			bench_section("alloc", "\n\e[96m*** ALLOCATIONS ***\e[39m");
+			bench_alloc();
+		}
+		if (bench_selected(only, "latency")) {
+			bench_section("latency", "\n\e[96m*** PUSH_BACK LATENCY ***\e[39m");
+			bench_latency();
+		}
+		if (bench_selected(only, "replay")) {
+			bench_section("replay", "\n\e[96m*** REPLAY ***\e[39m");
+			bench_replay();
+		}
+		if (bench_selected(only, "keys")) {
+			bench_section("keys", "\n\e[96m*** KEY DISTRIBUTIONS ***\e[39m");
+			bench_keys();
+		}
+	}
+	bench_end();
+
+	if (!record.empty() && !bench_gate_record(record)) {
+		return (2);
+	}
+	if (!compare.empty()) {
+		int regressions = bench_gate_compare(compare, threshold);
+		if (regressions < 0) {
+			return (2);
+		}
+		return (regressions ? 1 : 0);
+	}
+	return (0);
+}
@@ -0,0 +1,147 @@
+#include "bench.hpp"
+
+/*
+**	Batched lookup on ft::map: find() in a loop against find_many() on batches
+**	of 1000 random keys, half of them present, with std::map::find as reference.
+**	Then a nearly sorted insert stream, with and without the previous iterator as hint.
+**	Last, find and a full scan on a map fragmented by churn, before and after compact().
+*/
+
+typedef ft::map<int, int>		bench_ft_map;
+typedef std::map<int, int>	bench_std_map;
+
+static volatile long long	g_sink;
+
+template < class Map >
+static void	bench_nearly_sorted( const std::string& name, const std::vector<int>& stream ) {
+	std::size_t n = stream.size();
+	Map plain;
+	long long start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		plain.insert(typename Map::value_type(stream[i], 0));
+	}
+	bench_report("insert", name, n, now_ns() - start, n);
+
+	Map hinted;
+	typename Map::iterator hint = hinted.end();
+	start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		hint = hinted.insert(hint, typename Map::value_type(stream[i], 0));
+	}
+	bench_report("insert_hint", name, n, now_ns() - start, n);
+	g_sink = plain.size() + hinted.size();
+}
+
+template < class Map >
+static void	bench_find_scan( const std::string& op, const std::string& name, const Map& m, const std::vector<int>& keys ) {
+	std::size_t n = keys.size();
+	long long sum = 0;
+
+	long long start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		sum += m.count(keys[(i * 7919) % n]);
+	}
+	bench_report("find" + op, name, n, now_ns() - start, n);
+
+	start = now_ns();
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it) {
+		sum += it->second;
+	}
+	bench_report("scan" + op, name, n, now_ns() - start, m.size());
+	g_sink = sum;
+}
+
+// Interleave the insertions with erasures and reinsertions so that neighbours end up far apart in memory
+static void	bench_fragmented( const std::vector<int>& keys ) {
+	std::size_t n = keys.size();
+	bench_ft_map mine;
+	bench_std_map real;
+	for (std::size_t i = 0; i < n; i++) {
+		mine.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+		real.insert(std::make_pair(keys[i], static_cast<int>(i)));
+		if (i % 2) {
+			int k = keys[rand() % (i + 1)];
+			mine.erase(k);
+			real.erase(k);
+			mine.insert(ft::make_pair(k, static_cast<int>(i)));
+			real.insert(std::make_pair(k, static_cast<int>(i)));
+		}
+	}
+	bench_find_scan("", "std::map", real, keys);
+	bench_find_scan("", "ft::map", mine, keys);
+
+	long long start = now_ns();
+	mine.compact(ft::compact_in_order);
+	bench_report("compact", "ft::map", n, now_ns() - start, mine.size());
+	bench_find_scan("_in_order", "ft::map", mine, keys);
+
+	start = now_ns();
+	mine.compact(ft::compact_veb);
+	bench_report("compact_veb", "ft::map", n, now_ns() - start, mine.size());
+	bench_find_scan("_veb", "ft::map", mine, keys);
+}
+
+void	bench_map() {
+	std::size_t sizes[] = { 10000, 100000, 1000000 };
+	const std::size_t batch = 1000;
+	const std::size_t probes = 1000000;
+
+	srand(42);
+	bench_header();
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t n = sizes[s];
+		bench_ft_map mine;
+		bench_std_map real;
+		std::vector<int> keys(n);
+		for (std::size_t i = 0; i < n; i++) {
+			keys[i] = rand();
+			mine.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+			real.insert(std::make_pair(keys[i], static_cast<int>(i)));
+		}
+		std::vector<int> batches(probes);
+		for (std::size_t i = 0; i < probes; i++) {
+			batches[i] = (i % 2) ? keys[rand() % n] : rand();
+		}
+		long long sum = 0;
+
+		long long start = now_ns();
+		for (std::size_t i = 0; i < probes; i++) {
+			bench_std_map::iterator it = real.find(batches[i]);
+			if (it != real.end()) {
+				sum += it->second;
+			}
+		}
+		bench_report("find", "std::map", n, now_ns() - start, probes);
+
+		start = now_ns();
+		for (std::size_t i = 0; i < probes; i++) {
+			bench_ft_map::iterator it = mine.find(batches[i]);
+			if (it != mine.end()) {
+				sum += it->second;
+			}
+		}
+		bench_report("find", "ft::map", n, now_ns() - start, probes);
+
+		std::vector<bench_ft_map::iterator> found(batch);
+		start = now_ns();
+		for (std::size_t i = 0; i < probes; i += batch) {
+			mine.find_many(batches.begin() + i, batches.begin() + i + batch, found.begin());
+			for (std::size_t j = 0; j < batch; j++) {
+				if (found[j] != mine.end()) {
+					sum += found[j]->second;
+				}
+			}
+		}
+		bench_report("find_many", "ft::map", n, now_ns() - start, probes);
+
+		std::vector<int> stream(n);
+		for (std::size_t i = 0; i < n; i++) {
+			stream[i] = static_cast<int>(i * 4) + rand() % 8;
+		}
+		bench_nearly_sorted<bench_std_map>("std::map", stream);
+		bench_nearly_sorted<bench_ft_map>("ft::map", stream);
+		bench_fragmented(keys);
+		g_sink = sum;
+		bench_note("");
+	}
+}
@@ -0,0 +1,87 @@
+#include "bench.hpp"
+
+#include <algorithm>
+
+/*
+**	Radix tree against the ordered maps on 64-bit keys: insert, find, lower_bound
+**	on absent keys and a full in-order scan, plus the bytes used per element.
+**	Random keys spread over the whole key space, sequential keys share all their high bytes.
+*/
+
+typedef bench_allocator<ft::pair<const long, long> >		ft_long_alloc;
+typedef bench_allocator<std::pair<const long, long> >		std_long_alloc;
+
+static volatile long long	g_sink;
+
+template < class Map >
+static void	bench_ordered_map( const std::string& name, const std::vector<long>& keys, const std::vector<long>& probes ) {
+	std::size_t n = keys.size();
+	std::size_t bytes_before = bench_live_bytes();
+	long long sum = 0;
+	Map m;
+
+	long long start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		m.insert(typename Map::value_type(keys[i], static_cast<long>(i)));
+	}
+	bench_report("insert", name, n, now_ns() - start, n);
+	bench_report_bytes(name, n, bench_live_bytes() - bytes_before);
+
+	start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		typename Map::iterator it = m.find(keys[(i * 7919) % n]);
+		if (it != m.end()) {
+			sum += it->second;
+		}
+	}
+	bench_report("find", name, n, now_ns() - start, n);
+
+	start = now_ns();
+	for (std::size_t i = 0; i < probes.size(); i++) {
+		typename Map::iterator it = m.lower_bound(probes[i]);
+		if (it != m.end()) {
+			sum += it->second;
+		}
+	}
+	bench_report("lower_bound", name, n, now_ns() - start, probes.size());
+
+	start = now_ns();
+	for (typename Map::iterator it = m.begin(); it != m.end(); ++it) {
+		sum += it->second;
+	}
+	bench_report("scan", name, n, now_ns() - start, n);
+	g_sink = sum;
+}
+
+static void	bench_keys( const std::vector<long>& keys, const std::vector<long>& probes ) {
+	bench_ordered_map< ft::radix_map<long, long, ft_long_alloc> >("ft::radix_map", keys, probes);
+	bench_ordered_map< ft::map<long, long, std::less<long>, ft_long_alloc> >("ft::map", keys, probes);
+	bench_ordered_map< std::map<long, long, std::less<long>, std_long_alloc> >("std::map", keys, probes);
+	bench_note("");
+}
+
+void	bench_radix() {
+	std::size_t sizes[] = { 10000, 100000, 1000000 };
+
+	srand(42);
+	bench_header();
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t n = sizes[s];
+		std::vector<long> keys(n);
+		std::vector<long> probes(n);
+		for (std::size_t i = 0; i < n; i++) {
+			keys[i] = static_cast<long>(rand()) << 32 ^ rand();
+			probes[i] = static_cast<long>(rand()) << 32 ^ rand();
+		}
+		bench_section("radix_random", "random keys");
+		bench_keys(keys, probes);
+
+		for (std::size_t i = 0; i < n; i++) {
+			keys[i] = static_cast<long>(i * 2);
+			probes[i] = static_cast<long>(rand() % n) * 2 + 1;
+		}
+		std::random_shuffle(keys.begin(), keys.end());
+		bench_section("radix_sequential", "sequential keys");
+		bench_keys(keys, probes);
+	}
+}
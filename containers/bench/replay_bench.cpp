@@ -0,0 +1,202 @@
+#include "bench.hpp"
+
+#include <fstream>
+
+/*
+**	Replay: the events of a trace recorded with the ft::recording_ wrappers
+**	(see class/trace.hpp), replayed on the ft:: container of its kind and on the
+**	std:: one. A first pass gives the throughput, a second one times every
+**	event for the latency distribution. The trace comes from --trace; without
+**	one, a synthetic workload of each kind is recorded then replayed, which
+**	also checks the format.
+*/
+
+typedef ft::recording_map< ft::map<int, int> >			ft_map_recorder;
+typedef ft::recording_map< std::map<int, int> >			std_map_recorder;
+typedef ft::recording_vector< ft::vector<int> >			ft_vector_recorder;
+typedef ft::recording_vector< std::vector<int> >		std_vector_recorder;
+typedef ft::recording_stack< ft::stack<int> >				ft_stack_recorder;
+typedef ft::recording_stack< std::stack<int> >			std_stack_recorder;
+
+static volatile long long	g_sink;
+
+static bool	replay_load( std::istream& in, ft::trace_container& container, std::vector<ft::trace_event>& events ) {
+	ft::trace_reader reader(in);
+	ft::trace_event event;
+
+	while (reader.next(event)) {
+		events.push_back(event);
+	}
+	if (reader.error()) {
+		std::cerr << "ft_bench: trace: " << reader.error() << " after " << events.size() << " events" << std::endl;
+		return false;
+	}
+	container = reader.container();
+	return true;
+}
+
+template < class Recorder, class Container >
+static void	replay_run( const std::string& name, const std::vector<ft::trace_event>& events ) {
+	std::size_t n = events.size();
+	long long sum = 0;
+	{
+		Container c;
+		long long start = now_ns();
+		for (std::size_t i = 0; i < n; i++) {
+			sum += Recorder::apply(c, events[i]);
+		}
+		bench_header("ns/op");
+		bench_report("replay", name, n, now_ns() - start, n);
+	}
+
+	std::vector<double> samples(n);
+	{
+		Container c;
+		for (std::size_t i = 0; i < n; i++) {
+			long long start = now_ns();
+			sum += Recorder::apply(c, events[i]);
+			samples[i] = static_cast<double>(now_ns() - start);
+		}
+	}
+	bench_header("ns");
+	bench_report_latency(name, n, samples);
+	bench_note("");
+	g_sink = sum;
+}
+
+static void	replay_events( ft::trace_container container, const std::vector<ft::trace_event>& events ) {
+	if (container == ft::trace_map) {
+		replay_run<ft_map_recorder, ft::map<int, int> >("ft::map", events);
+		replay_run<std_map_recorder, std::map<int, int> >("std::map", events);
+	}
+	else if (container == ft::trace_vector) {
+		replay_run<ft_vector_recorder, ft::vector<int> >("ft::vector", events);
+		replay_run<std_vector_recorder, std::vector<int> >("std::vector", events);
+	}
+	else {
+		replay_run<ft_stack_recorder, ft::stack<int> >("ft::stack", events);
+		replay_run<std_stack_recorder, std::stack<int> >("std::stack", events);
+	}
+}
+
+/*****      SYNTHETIC TRACES      *****/
+
+static void	replay_touch( const ft::pair<const int, int>& value ) {
+	g_sink = g_sink + value.second;
+}
+
+// Mostly lookups on a growing key space, a few updates and erases, a scan now and then
+static void	record_map( ft::trace_writer& trace, std::size_t n ) {
+	ft::map<int, int> m;
+	ft_map_recorder rec(m, trace);
+	int range = static_cast<int>(n / 4) + 1;
+
+	for (std::size_t i = 0; i < n; i++) {
+		int r = rand() % 100;
+		int key = rand() % range;
+		if (i % 10000 == 9999) {
+			rec.for_each(replay_touch);
+		}
+		else if (r < 30) {
+			rec.insert(ft::make_pair(key, static_cast<int>(i)));
+		}
+		else if (r < 40) {
+			rec.assign(key, static_cast<int>(i));
+		}
+		else if (r < 90) {
+			rec.find(key);
+		}
+		else {
+			rec.erase(key);
+		}
+	}
+}
+
+// Appends and reads, with a few inserts and erases in the middle
+static void	record_vector( ft::trace_writer& trace, std::size_t n ) {
+	ft::vector<int> v;
+	ft_vector_recorder rec(v, trace);
+
+	for (std::size_t i = 0; i < n; i++) {
+		int r = rand() % 1000;
+		if (r < 400 || v.empty()) {
+			rec.push_back(static_cast<int>(i));
+		}
+		else if (r < 950) {
+			rec.at(rand() % v.size());
+		}
+		else if (r < 997) {
+			rec.pop_back();
+		}
+		else if (r < 999) {
+			rec.insert(rand() % v.size(), static_cast<int>(i));
+		}
+		else {
+			rec.erase(rand() % v.size());
+		}
+	}
+}
+
+// Pushes and pops in bursts, the top read in between
+static void	record_stack( ft::trace_writer& trace, std::size_t n ) {
+	ft::stack<int> s;
+	ft_stack_recorder rec(s, trace);
+
+	for (std::size_t i = 0; i < n; i++) {
+		int r = (i / 64) % 3;
+		if (r == 0 || s.empty()) {
+			rec.push(static_cast<int>(i));
+		}
+		else if (r == 1) {
+			rec.top();
+		}
+		else {
+			rec.pop();
+		}
+	}
+}
+
+static void	replay_synthetic( ft::trace_container container, std::size_t n ) {
+	std::stringstream buffer;
+	{
+		ft::trace_writer trace(buffer, container);
+		if (container == ft::trace_map) {
+			record_map(trace, n);
+		}
+		else if (container == ft::trace_vector) {
+			record_vector(trace, n);
+		}
+		else {
+			record_stack(trace, n);
+		}
+		std::ostringstream note;
+		note << trace.events() << " events, " << buffer.str().size() << " bytes";
+		bench_note(note.str());
+	}
+
+	std::vector<ft::trace_event> events;
+	if (replay_load(buffer, container, events)) {
+		replay_events(container, events);
+	}
+}
+
+void	bench_replay() {
+	if (!g_bench_trace.empty()) {
+		std::ifstream file(g_bench_trace.c_str(), std::ios::in | std::ios::binary);
+		ft::trace_container container;
+		std::vector<ft::trace_event> events;
+		if (!file) {
+			std::cerr << "ft_bench: cannot open " << g_bench_trace << std::endl;
+		}
+		else if (replay_load(file, container, events)) {
+			replay_events(container, events);
+		}
+		return;
+	}
+
+	std::size_t n = std::min<std::size_t>(g_bench_max_n, 1000000);
+	srand(42);
+	replay_synthetic(ft::trace_map, n);
+	replay_synthetic(ft::trace_vector, n);
+	replay_synthetic(ft::trace_stack, n);
+}
@@ -0,0 +1,57 @@
+#include "bench.hpp"
+
+/*
+**	Small map against the tree maps on many maps of a few int keys each: build
+**	them (bytes allocated included), then look up every key of every map.
+*/
+
+typedef bench_allocator<ft::pair<const int, int> >		ft_int_alloc;
+typedef bench_allocator<std::pair<const int, int> >		std_int_alloc;
+
+static volatile long long	g_sink;
+
+template < class Map >
+static void	bench_many_small( const std::string& name, std::size_t maps, std::size_t per_map, const std::vector<int>& keys ) {
+	std::size_t n = maps * per_map;
+	std::size_t bytes_before = bench_live_bytes();
+	std::vector<Map> all(maps);
+	long long sum = 0;
+
+	long long start = now_ns();
+	for (std::size_t m = 0; m < maps; m++) {
+		for (std::size_t i = 0; i < per_map; i++) {
+			all[m].insert(typename Map::value_type(keys[m * per_map + i], static_cast<int>(i)));
+		}
+	}
+	bench_report("insert", name, per_map, now_ns() - start, n);
+	bench_report_bytes(name, per_map, (bench_live_bytes() - bytes_before) / maps);
+
+	start = now_ns();
+	for (std::size_t m = 0; m < maps; m++) {
+		for (std::size_t i = 0; i < per_map; i++) {
+			sum += all[m].find(keys[m * per_map + (i * 5 + 3) % per_map])->second;
+		}
+	}
+	bench_report("find", name, per_map, now_ns() - start, n);
+	g_sink = sum;
+}
+
+void	bench_small() {
+	std::size_t sizes[] = { 4, 8, 16 };
+	std::size_t maps = 100000;
+
+	srand(42);
+	bench_header();
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t per_map = sizes[s];
+		std::vector<int> keys(maps * per_map);
+		for (std::size_t i = 0; i < keys.size(); i++) {
+			keys[i] = rand();
+		}
+
+		bench_many_small< ft::small_map<int, int, 8, std::less<int>, ft_int_alloc> >("ft::small_map", maps, per_map, keys);
+		bench_many_small< ft::map<int, int, std::less<int>, ft_int_alloc> >("ft::map", maps, per_map, keys);
+		bench_many_small< std::map<int, int, std::less<int>, std_int_alloc> >("std::map", maps, per_map, keys);
+		bench_note("");
+	}
+}
@@ -0,0 +1,234 @@
+#include "bench.hpp"
+
+/*
+**	Suite: the same workloads on ft:: and std:: vector, stack and map of ints,
+**	for N = 1e3 to g_bench_max_n (1e7 by default), every size 10 times the previous.
+**	Each workload runs through an ft::perf_timer on a fresh container: many
+**	repetitions for the small sizes, a single one from 1e6 up. Middle insert and
+**	erase on a vector cost O(N) each, so they do SUITE_MIDDLE_OPS operations
+**	on a vector of N elements instead of N operations.
+**	Every workload also reads the hardware counters, see bench_counters().
+*/
+
+#define SUITE_MIDDLE_OPS 100
+#define SUITE_PROBES 100000
+
+// Repetitions so that a size costs about 1e6 operations, between 1 and 15,
+// unless --repetitions sets them
+static std::size_t	suite_repetitions( std::size_t n ) {
+	if (g_bench_repetitions) {
+		return g_bench_repetitions;
+	}
+	std::size_t reps = 1000000 / n;
+	return reps < 1 ? 1 : reps > 15 ? 15 : reps;
+}
+
+static std::size_t	suite_warmup( std::size_t n ) {
+	return n <= 100000 ? 1 : 0;
+}
+
+/*****      VECTOR      *****/
+
+template < class Vector >
+static void	suite_vector( const std::string& name, std::size_t n, const std::vector<int>& probes ) {
+	std::size_t reps = suite_repetitions(n);
+	std::size_t warmup = suite_warmup(n);
+	Vector full;
+	for (std::size_t i = 0; i < n; i++) {
+		full.push_back(static_cast<int>(i * 2));
+	}
+
+	ft::perf_timer push(reps, warmup, n, bench_counters());
+	while (push.next()) {
+		Vector v;
+		push.start();
+		for (std::size_t i = 0; i < n; i++) {
+			v.push_back(static_cast<int>(i));
+		}
+		push.stop();
+		ft::do_not_optimize(v);
+	}
+	bench_report_stats("push_back", name, n, push);
+
+	ft::perf_timer insert(reps, warmup, SUITE_MIDDLE_OPS, bench_counters());
+	while (insert.next()) {
+		Vector v(full);
+		insert.start();
+		for (int i = 0; i < SUITE_MIDDLE_OPS; i++) {
+			v.insert(v.begin() + v.size() / 2, i);
+		}
+		insert.stop();
+		ft::do_not_optimize(v);
+	}
+	bench_report_stats("insert_mid", name, n, insert);
+
+	ft::perf_timer erase(reps, warmup, SUITE_MIDDLE_OPS, bench_counters());
+	while (erase.next()) {
+		Vector v(full);
+		erase.start();
+		for (int i = 0; i < SUITE_MIDDLE_OPS && !v.empty(); i++) {
+			v.erase(v.begin() + v.size() / 2);
+		}
+		erase.stop();
+		ft::do_not_optimize(v);
+	}
+	bench_report_stats("erase_mid", name, n, erase);
+
+	ft::perf_timer lower(reps, warmup, probes.size(), bench_counters());
+	while (lower.next()) {
+		long found = 0;
+		for (std::size_t i = 0; i < probes.size(); i++) {
+			found += std::lower_bound(full.begin(), full.end(), probes[i] % (2 * n)) - full.begin();
+		}
+		ft::do_not_optimize(found);
+	}
+	bench_report_stats("lower_bound", name, n, lower);
+
+	ft::perf_timer scan(reps, warmup, n, bench_counters());
+	while (scan.next()) {
+		long sum = 0;
+		for (typename Vector::const_iterator it = full.begin(); it != full.end(); ++it) {
+			sum += *it;
+		}
+		ft::do_not_optimize(sum);
+	}
+	bench_report_stats("iterate", name, n, scan);
+
+	ft::perf_timer copy(reps, warmup, n, bench_counters());
+	while (copy.next()) {
+		Vector v(full);
+		copy.stop();
+		ft::do_not_optimize(v);
+	}
+	bench_report_stats("copy", name, n, copy);
+}
+
+/*****      STACK      *****/
+
+template < class Stack >
+static void	suite_stack( const std::string& name, std::size_t n ) {
+	std::size_t reps = suite_repetitions(n);
+	std::size_t warmup = suite_warmup(n);
+
+	ft::perf_timer push(reps, warmup, n, bench_counters());
+	ft::perf_timer pop(reps, warmup, n, bench_counters());
+	ft::perf_timer copy(reps, warmup, n, bench_counters());
+	// Not &&: every timer must record the iteration that ends
+	while (push.next() & pop.next() & copy.next()) {
+		Stack s;
+		push.start();
+		for (std::size_t i = 0; i < n; i++) {
+			s.push(static_cast<int>(i));
+		}
+		push.stop();
+		copy.start();
+		Stack c(s);
+		copy.stop();
+		pop.start();
+		while (!s.empty()) {
+			s.pop();
+		}
+		pop.stop();
+		ft::do_not_optimize(s);
+		ft::do_not_optimize(c);
+	}
+	bench_report_stats("push", name, n, push);
+	bench_report_stats("pop", name, n, pop);
+	bench_report_stats("copy", name, n, copy);
+}
+
+/*****      MAP      *****/
+
+template < class Map >
+static void	suite_map( const std::string& name, const std::vector<int>& keys, const std::vector<int>& probes ) {
+	std::size_t n = keys.size();
+	std::size_t reps = suite_repetitions(n);
+	std::size_t warmup = suite_warmup(n);
+
+	ft::perf_timer insert(reps, warmup, n, bench_counters());
+	ft::perf_timer erase(reps, warmup, n, bench_counters());
+	while (insert.next() & erase.next()) {
+		Map m;
+		insert.start();
+		for (std::size_t i = 0; i < n; i++) {
+			m.insert(typename Map::value_type(keys[i], static_cast<int>(i)));
+		}
+		insert.stop();
+		erase.start();
+		for (std::size_t i = 0; i < n; i++) {
+			m.erase(keys[i]);
+		}
+		erase.stop();
+		ft::do_not_optimize(m);
+	}
+	bench_report_stats("insert", name, n, insert);
+	bench_report_stats("erase", name, n, erase);
+
+	Map full;
+	for (std::size_t i = 0; i < n; i++) {
+		full.insert(typename Map::value_type(keys[i], static_cast<int>(i)));
+	}
+
+	ft::perf_timer find(reps, warmup, probes.size(), bench_counters());
+	while (find.next()) {
+		std::size_t found = 0;
+		for (std::size_t i = 0; i < probes.size(); i++) {
+			found += full.find(probes[i]) != full.end();
+		}
+		ft::do_not_optimize(found);
+	}
+	bench_report_stats("find", name, n, find);
+
+	ft::perf_timer lower(reps, warmup, probes.size(), bench_counters());
+	while (lower.next()) {
+		long sum = 0;
+		for (std::size_t i = 0; i < probes.size(); i++) {
+			typename Map::const_iterator it = full.lower_bound(probes[i]);
+			sum += it == full.end() ? 0 : it->second;
+		}
+		ft::do_not_optimize(sum);
+	}
+	bench_report_stats("lower_bound", name, n, lower);
+
+	ft::perf_timer scan(reps, warmup, full.size(), bench_counters());
+	while (scan.next()) {
+		long sum = 0;
+		for (typename Map::const_iterator it = full.begin(); it != full.end(); ++it) {
+			sum += it->second;
+		}
+		ft::do_not_optimize(sum);
+	}
+	bench_report_stats("iterate", name, n, scan);
+
+	ft::perf_timer copy(reps, warmup, full.size(), bench_counters());
+	while (copy.next()) {
+		Map c(full);
+		copy.stop();
+		ft::do_not_optimize(c);
+	}
+	bench_report_stats("copy", name, n, copy);
+}
+
+void	bench_suite() {
+	srand(42);
+	std::vector<int> probes(SUITE_PROBES);
+	bench_header();
+	for (std::size_t n = 1000; n <= g_bench_max_n; n *= 10) {
+		std::vector<int> keys(n);
+		for (std::size_t i = 0; i < n; i++) {
+			keys[i] = rand() % (4 * n);
+		}
+		// About a fifth of the probes hit a map of n random keys in [0, 4n)
+		for (std::size_t i = 0; i < probes.size(); i++) {
+			probes[i] = rand() % (4 * n);
+		}
+
+		suite_vector< ft::vector<int> >("ft::vector", n, probes);
+		suite_vector< std::vector<int> >("std::vector", n, probes);
+		suite_stack< ft::stack<int> >("ft::stack", n);
+		suite_stack< std::stack<int> >("std::stack", n);
+		suite_map< ft::map<int, int> >("ft::map", keys, probes);
+		suite_map< std::map<int, int> >("std::map", keys, probes);
+		bench_note("");
+	}
+}
@@ -0,0 +1,93 @@
+#include "bench.hpp"
+
+#include <algorithm>
+
+/*
+**	Hash map against the ordered maps, on int keys and on string keys:
+**	insert, successful and failed find, and erase of every key.
+**	String keys stop at 100000 elements to keep the run short.
+*/
+
+typedef bench_allocator<ft::pair<const int, int> >					ft_int_alloc;
+typedef bench_allocator<std::pair<const int, int> >					std_int_alloc;
+typedef bench_allocator<ft::pair<const std::string, int> >	ft_str_alloc;
+typedef bench_allocator<std::pair<const std::string, int> >	std_str_alloc;
+
+static volatile long long	g_sink;
+
+template < class Map >
+static void	bench_lookup_map( const std::string& name, const std::vector<typename Map::key_type>& keys,
+	const std::vector<typename Map::key_type>& misses ) {
+	std::size_t n = keys.size();
+	std::size_t bytes_before = bench_live_bytes();
+	long long sum = 0;
+	Map m;
+
+	long long start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		m.insert(typename Map::value_type(keys[i], static_cast<int>(i)));
+	}
+	bench_report("insert", name, n, now_ns() - start, n);
+	bench_report_bytes(name, n, bench_live_bytes() - bytes_before);
+
+	start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		typename Map::iterator it = m.find(keys[(i * 7919) % n]);
+		if (it != m.end()) {
+			sum += it->second;
+		}
+	}
+	bench_report("find_hit", name, n, now_ns() - start, n);
+
+	start = now_ns();
+	for (std::size_t i = 0; i < misses.size(); i++) {
+		sum += m.count(misses[i]);
+	}
+	bench_report("find_miss", name, n, now_ns() - start, misses.size());
+
+	start = now_ns();
+	for (std::size_t i = 0; i < n; i++) {
+		sum += m.erase(keys[i]);
+	}
+	bench_report("erase", name, n, now_ns() - start, n);
+	g_sink = sum;
+}
+
+void	bench_unordered() {
+	std::size_t sizes[] = { 10000, 100000, 1000000 };
+
+	srand(42);
+	bench_header();
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::size_t n = sizes[s];
+		std::vector<int> keys(n);
+		std::vector<int> misses(n);
+		for (std::size_t i = 0; i < n; i++) {
+			keys[i] = static_cast<int>(i * 2);
+			misses[i] = static_cast<int>(rand() % n) * 2 + 1;
+		}
+		std::random_shuffle(keys.begin(), keys.end());
+		bench_lookup_map< ft::unordered_map<int, int, ft::hash<int>, std::equal_to<int>, ft_int_alloc> >("ft::unordered_map", keys, misses);
+		bench_lookup_map< ft::map<int, int, std::less<int>, ft_int_alloc> >("ft::map", keys, misses);
+		bench_lookup_map< std::map<int, int, std::less<int>, std_int_alloc> >("std::map", keys, misses);
+		bench_note("");
+	}
+	for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes) - 1; s++) {
+		std::size_t n = sizes[s];
+		std::vector<std::string> keys(n);
+		std::vector<std::string> misses(n);
+		for (std::size_t i = 0; i < n; i++) {
+			std::ostringstream key;
+			std::ostringstream miss;
+			key << "user:" << i * 2;
+			miss << "user:" << (rand() % n) * 2 + 1;
+			keys[i] = key.str();
+			misses[i] = miss.str();
+		}
+		std::random_shuffle(keys.begin(), keys.end());
+		bench_lookup_map< ft::unordered_map<std::string, int, ft::hash<std::string>, std::equal_to<std::string>, ft_str_alloc> >("ft::unordered_map", keys, misses);
+		bench_lookup_map< ft::map<std::string, int, std::less<std::string>, ft_str_alloc> >("ft::map", keys, misses);
+		bench_lookup_map< std::map<std::string, int, std::less<std::string>, std_str_alloc> >("std::map", keys, misses);
+		bench_note("");
+	}
+}
@@ -0,0 +1,213 @@
+#include "bench.hpp"
+
+#include <iomanip>
+
+std::size_t	g_bench_max_n = 10000000;
+std::size_t	g_bench_repetitions = 0;
+std::string	g_bench_trace;
+std::vector<bench_row>	g_bench_rows;
+
+static bench_format	g_format = bench_text;
+static std::string	g_section;
+static bool					g_first_row = true;
+
+long long	now_ns() {
+	return ft::perf_now();
+}
+
+// Opened on first use and shared by every measurement
+const ft::perf_counters	*bench_counters() {
+	static ft::perf_counters	counters;
+
+	return &counters;
+}
+
+void	bench_begin( bench_format format ) {
+	g_format = format;
+	g_first_row = true;
+	const char *error = bench_counters()->error();
+	if (error) {
+		std::cerr << "ft_bench: " << (bench_counters()->any() ? "some " : "") << "hardware counters unavailable (" << error
+			<< "), see /proc/sys/kernel/perf_event_paranoid" << std::endl;
+	}
+	if (g_format == bench_csv) {
+		std::cout << "bench,operation,container,n,unit,median,p90,p99,stddev,samples";
+		for (int e = 0; e < ft::perf_event_count; e++) {
+			std::cout << ',' << ft::perf_counters::name(e);
+		}
+		std::cout << std::endl;
+	}
+	else if (g_format == bench_json) {
+		std::cout << "[";
+	}
+}
+
+void	bench_end() {
+	if (g_format == bench_json) {
+		std::cout << (g_first_row ? "]" : "\n]") << std::endl;
+	}
+}
+
+void	bench_section( const std::string& name, const std::string& title ) {
+	g_section = name;
+	bench_note(title);
+}
+
+void	bench_note( const std::string& line ) {
+	if (g_format == bench_text) {
+		std::cout << line << std::endl;
+	}
+}
+
+void	bench_header( const std::string& unit ) {
+	if (g_format != bench_text) {
+		return;
+	}
+	std::cout << std::left << std::setw(14) << "operation" << std::setw(18) << "container"
+		<< std::right << std::setw(10) << "N" << std::setw(14) << unit;
+	for (int e = 0; e < ft::perf_event_count; e++) {
+		if (bench_counters()->available(e)) {
+			std::cout << std::setw(15) << ft::perf_counters::name(e);
+		}
+	}
+	std::cout << std::endl;
+}
+
+/*
+**	Bench_emit
+**
+**	Prints one result: a text row with the median only, or a CSV line or JSON
+**	object with the whole distribution. Single measurements have one sample.
+**	Hardware counters per operation follow, empty (null) when not measured.
+*/
+
+static void	bench_emit( const std::string& op, const std::string& container, std::size_t n, const char *unit, const ft::perf_stats& s ) {
+	if (g_format == bench_text) {
+		std::cout << std::left << std::setw(14) << op << std::setw(18) << container
+			<< std::right << std::setw(10) << n << std::setw(14) << std::fixed << std::setprecision(1) << s.median;
+		for (int e = 0; e < ft::perf_event_count; e++) {
+			if (s.events[e] >= 0) {
+				std::cout << std::setw(15) << std::setprecision(2) << s.events[e];
+			}
+		}
+		std::cout << std::endl;
+	}
+	else if (g_format == bench_csv) {
+		std::cout << g_section << ',' << op << ',' << container << ',' << n << ',' << unit << std::fixed << std::setprecision(1)
+			<< ',' << s.median << ',' << s.p90 << ',' << s.p99 << ',' << s.stddev << ',' << s.samples << std::setprecision(3);
+		for (int e = 0; e < ft::perf_event_count; e++) {
+			std::cout << ',';
+			if (s.events[e] >= 0) {
+				std::cout << s.events[e];
+			}
+		}
+		std::cout << std::endl;
+	}
+	else {
+		std::cout << (g_first_row ? "\n" : ",\n") << std::fixed << std::setprecision(1)
+			<< "  {\"bench\": \"" << g_section << "\", \"operation\": \"" << op << "\", \"container\": \"" << container
+			<< "\", \"n\": " << n << ", \"unit\": \"" << unit << "\", \"median\": " << s.median << ", \"p90\": " << s.p90
+			<< ", \"p99\": " << s.p99 << ", \"stddev\": " << s.stddev << ", \"samples\": " << s.samples << std::setprecision(3);
+		for (int e = 0; e < ft::perf_event_count; e++) {
+			std::cout << ", \"" << ft::perf_counters::name(e) << "\": ";
+			if (s.events[e] >= 0) {
+				std::cout << s.events[e];
+			}
+			else {
+				std::cout << "null";
+			}
+		}
+		std::cout << "}";
+	}
+	g_first_row = false;
+}
+
+static ft::perf_stats	bench_single( double value ) {
+	ft::perf_stats s = ft::perf_summarize(std::vector<double>());
+	s.samples = 1;
+	s.min = value;
+	s.median = value;
+	s.p90 = value;
+	s.p99 = value;
+	s.mean = value;
+	return s;
+}
+
+static void	bench_record( const std::string& op, const std::string& container, std::size_t n, const char *unit, const std::vector<double>& samples ) {
+	bench_row row;
+
+	row.section = g_section;
+	row.op = op;
+	row.container = container;
+	row.n = n;
+	row.unit = unit;
+	row.samples = samples;
+	g_bench_rows.push_back(row);
+}
+
+void	bench_report( const std::string& op, const std::string& container, std::size_t n, long long total_ns, std::size_t ops ) {
+	double per_op = ops ? static_cast<double>(total_ns) / ops : 0;
+
+	bench_emit(op, container, n, "ns/op", bench_single(per_op));
+}
+
+void	bench_report_stats( const std::string& op, const std::string& container, std::size_t n, const ft::perf_timer& timer ) {
+	bench_record(op, container, n, "ns/op", timer.samples());
+	bench_emit(op, container, n, "ns/op", timer.stats());
+}
+
+// Exact value, such as a number of allocations: the gate flags any increase
+void	bench_report_count( const std::string& op, const std::string& container, std::size_t n, const char *unit, double value ) {
+	bench_record(op, container, n, unit, std::vector<double>(1, value));
+	bench_emit(op, container, n, unit, bench_single(value));
+}
+
+void	bench_report_bytes( const std::string& container, std::size_t n, std::size_t bytes ) {
+	bench_report_count("bytes/elem", container, n, "bytes/elem", n ? static_cast<double>(bytes) / n : 0);
+}
+
+/*
+**	Bench_report_latency
+**
+**	Distribution of the durations of single operations, one row per percentile
+**	and the maximum:
+**	the tail shows the stalls a median or a mean hides. The rows are not kept
+**	for the gate, tails are too noisy to compare between runs. The text output
+**	adds a histogram with one bucket per power of two nanoseconds.
+*/
+
+void	bench_report_latency( const std::string& container, std::size_t n, std::vector<double> samples ) {
+	static const double	percentiles[] = { 0.5, 0.99, 0.999, 0.9999 };
+	static const char		*names[] = { "p50", "p99", "p99.9", "p99.99" };
+
+	if (samples.empty()) {
+		return;
+	}
+	std::sort(samples.begin(), samples.end());
+	for (std::size_t p = 0; p < sizeof(percentiles) / sizeof(*percentiles); p++) {
+		bench_emit(names[p], container, n, "ns", bench_single(ft::perf_percentile(samples, percentiles[p])));
+	}
+	bench_emit("max", container, n, "ns", bench_single(samples.back()));
+	if (g_format != bench_text) {
+		return;
+	}
+
+	std::vector<std::size_t> buckets;
+	for (std::size_t i = 0; i < samples.size(); i++) {
+		std::size_t b = 0;
+		for (double ns = samples[i]; ns >= 2; ns /= 2) {
+			b++;
+		}
+		if (b >= buckets.size()) {
+			buckets.resize(b + 1, 0);
+		}
+		buckets[b]++;
+	}
+	for (std::size_t b = 0; b < buckets.size(); b++) {
+		if (buckets[b]) {
+			std::ostringstream line;
+			line << std::right << std::setw(34) << "< " << std::setw(10) << (2ull << b) << " ns" << std::setw(12) << buckets[b];
+			bench_note(line.str());
+		}
+	}
+}
@@ -0,0 +1,1071 @@
+#pragma once
+
+#ifndef BTREE_MAP_HPP
+# define BTREE_MAP_HPP
+
+# include "utils.hpp"
+
+/*
+**	Node size
+**
+**	Target size in bytes of a btree_map node. The default spans a few cache lines;
+**	build with -D FT_BTREE_NODE_BYTES=4096 to get page sized nodes instead.
+*/
+
+# ifndef FT_BTREE_NODE_BYTES
+#  define FT_BTREE_NODE_BYTES 512
+# endif
+
+namespace ft {
+
+	/*
+	**	Btree_node_traits
+	**
+	**	Number of slots of each node kind for a given key and value type.
+	**	Inner nodes hold a multiple of 4 separators so that the SIMD key search
+	**	of btree_search can always load full 16-byte groups.
+	*/
+
+	template< typename Key, typename Value >
+	struct btree_node_traits
+	{
+		static const int header_bytes = sizeof(void *) * 4;
+		static const int inner_fit = (FT_BTREE_NODE_BYTES - header_bytes) / static_cast<int>(sizeof(Key) + sizeof(void *));
+		static const int inner_slots = inner_fit < 4 ? 4 : (inner_fit & ~3);
+		static const int leaf_fit = (FT_BTREE_NODE_BYTES - header_bytes) / static_cast<int>(sizeof(Value));
+		static const int leaf_slots = leaf_fit < 4 ? 4 : leaf_fit;
+	};
+
+	template< typename Key, typename Value >
+	struct btree_inner;
+
+	template< typename Key, typename Value >
+	struct btree_node
+	{
+		btree_inner<Key, Value>	*_parent;
+		int											_count;
+		bool										_leaf;
+	};
+
+	/*
+	**	Leaves store up to leaf_slots values inline, in key order, and are linked
+	**	to their neighbours so that iteration never goes back up the tree.
+	*/
+
+	template< typename Key, typename Value >
+	struct btree_leaf : public btree_node<Key, Value>
+	{
+		btree_leaf			*_prev;
+		btree_leaf			*_next;
+		union {
+			char				_raw[sizeof(Value) * btree_node_traits<Key, Value>::leaf_slots];
+			long double	_align_ld;
+			long long		_align_ll;
+			void				*_align_ptr;
+		}								_slots;
+
+		Value	*values() {
+			return reinterpret_cast<Value *>(_slots._raw);
+		};
+
+		const Value	*values() const {
+			return reinterpret_cast<const Value *>(_slots._raw);
+		};
+	};
+
+	/*
+	**	Inner nodes hold _count separators and _count + 1 children. Every key of
+	**	_children[i] is >= _keys[i - 1] and < _keys[i].
+	*/
+
+	template< typename Key, typename Value >
+	struct btree_inner : public btree_node<Key, Value>
+	{
+		Key											_keys[btree_node_traits<Key, Value>::inner_slots];
+		btree_node<Key, Value>	*_children[btree_node_traits<Key, Value>::inner_slots + 1];
+	};
+
+	template< typename Leaf >
+	struct btree_header
+	{
+		Leaf	*_first;
+		Leaf	*_last;
+	};
+
+	/*
+	**	Btree_map
+	**
+	**	Sorted associative container with the interface of ft::map, stored as a B+ tree.
+	**	Nodes are wide (see FT_BTREE_NODE_BYTES), so a lookup touches a handful of
+	**	nodes instead of one node per level, and a range scan walks contiguous leaves.
+	**	Unlike ft::map, elements live inline in the leaves: insert and erase may move
+	**	other elements and therefore invalidate iterators and references to them.
+	*/
+
+	template < typename Key, typename T, typename Compare = std::less<Key>, typename Allocator = std::allocator<ft::pair<const Key, T> > >
+	class btree_map
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef T																														mapped_type;
+			typedef typename ft::pair<const Key, T>															value_type;
+
+			typedef std::size_t																									size_type;
+			typedef std::ptrdiff_t																							difference_type;
+
+			typedef Compare																											key_compare;
+			typedef Allocator																										allocator_type;
+			typedef value_type&																									reference;
+			typedef const value_type&																						const_reference;
+
+			typedef typename allocator_type::pointer														pointer;
+			typedef typename allocator_type::const_pointer											const_pointer;
+
+		protected:
+
+			typedef btree_node<Key, value_type>																	tnode;
+			typedef btree_leaf<Key, value_type>																	tleaf;
+			typedef btree_inner<Key, value_type>																tinner;
+			typedef btree_header<tleaf>																					theader;
+			typedef btree_node_traits<Key, value_type>													traits;
+			typedef btree_search<Key, Compare>																	search;
+			typedef typename allocator_type::template rebind<tleaf>::other			leaf_alloc;
+			typedef typename allocator_type::template rebind<tinner>::other			inner_alloc;
+
+		public:
+
+			typedef btree_map_iterators<tleaf, theader, value_type>							iterator;
+			typedef btree_map_iterators<tleaf, theader, const value_type>				const_iterator;
+			typedef ft::reverse_iterator<iterator>															reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>												const_reverse_iterator;
+
+			/************************************/
+			/*****      MEMBER CLASSES      *****/
+			/************************************/
+
+			/*
+			**	Value_compare
+			**
+			**	Compares objects of type value_type (key-value pairs) by comparing
+			**	of the first components of the pairs.
+			*/
+
+			class value_compare : public std::binary_function<value_type, value_type, bool>
+			{
+				protected:
+
+					Compare comp;
+
+				public:
+
+					value_compare( Compare c )
+						: comp(c) {
+					};
+
+					bool operator()( const value_type& x, const value_type& y ) const {
+						return comp(x.first, y.first);
+					};
+			};
+
+		private:
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			leaf_alloc			_allocLeaf;
+			inner_alloc			_allocInner;
+			tnode						*_root;
+			theader					_header;
+			allocator_type	_alloc;
+			size_type				_size;
+			Compare					_comp;
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+
+
+			/*
+			**	Constructors
+			**
+			**		1) Constructs an empty container.
+			**		2) Constructs the container with the contents of the range [first, last).
+			**		3) Copy constructor. Constructs the container with the copy of the contents of other.
+			*/
+
+			explicit btree_map( const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _allocLeaf(alloc), _allocInner(alloc), _root(NULL), _alloc(alloc), _size(0), _comp(comp) {
+				_header._first = NULL;
+				_header._last = NULL;
+			};
+
+			template< class InputIt >
+			btree_map( InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _allocLeaf(alloc), _allocInner(alloc), _root(NULL), _alloc(alloc), _size(0), _comp(comp) {
+				_header._first = NULL;
+				_header._last = NULL;
+				insert(first, last);
+			};
+
+			btree_map( const btree_map& other )
+				: _allocLeaf(other._allocLeaf), _allocInner(other._allocInner), _root(NULL), _alloc(other._alloc), _size(0), _comp(other._comp) {
+				_header._first = NULL;
+				_header._last = NULL;
+				insert(other.begin(), other.end());
+			};
+
+
+			/*
+			**	Destructor
+			*/
+
+			~btree_map() {
+				clear();
+			};
+
+
+			/*
+			**	Operator=
+			**
+			**	Copy assignment operator. Replaces the contents with a copy of the contents of other.
+			*/
+
+			btree_map& operator=( const btree_map& other ) {
+				if (this != &other) {
+					clear();
+					_comp = other._comp;
+					insert(other.begin(), other.end());
+				}
+				return *this;
+			};
+
+
+			/*
+			**	Get_allocator
+			**
+			**	Returns the allocator associated with the container.
+			*/
+
+			allocator_type	get_allocator() const {
+				return _alloc;
+			};
+
+
+
+			/************************************/
+			/*****      ELEMENT ACCESS      *****/
+			/************************************/
+
+
+
+			/*
+			**	At
+			**
+			**	Returns a reference to the mapped value of the element with key equivalent to key.
+			**	If no such element exists, an exception of type std::out_of_range is thrown.
+			*/
+
+			T& at( const Key& key ) {
+				iterator it = find(key);
+				if (it == end()) {
+					throw std::out_of_range("Key not found");
+				}
+				return it->second;
+			};
+
+			const T& at( const Key& key ) const {
+				const_iterator it = find(key);
+				if (it == end()) {
+					throw std::out_of_range("Key not found");
+				}
+				return it->second;
+			};
+
+
+			/*
+			**	Operator[]
+			**
+			**	Returns a reference to the value that is mapped to a key equivalent to key,
+			**	inserting value_type(key, T()) if such key does not already exist.
+			*/
+
+			T& operator[]( const Key& key ) {
+				return insert(value_type(key, T())).first->second;
+			};
+
+
+
+			/******************************/
+			/*****      ITERATOR      *****/
+			/******************************/
+
+
+
+			iterator begin() {
+				return iterator(_header._first, 0, &_header);
+			};
+
+			const_iterator begin() const {
+				return const_iterator(_header._first, 0, &_header);
+			};
+
+			iterator end() {
+				return iterator(NULL, 0, &_header);
+			};
+
+			const_iterator end() const {
+				return const_iterator(NULL, 0, &_header);
+			};
+
+			reverse_iterator rbegin() {
+				return reverse_iterator(end());
+			};
+
+			const_reverse_iterator rbegin() const {
+				return const_reverse_iterator(end());
+			};
+
+			reverse_iterator rend() {
+				return reverse_iterator(begin());
+			};
+
+			const_reverse_iterator rend() const {
+				return const_reverse_iterator(begin());
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return _size == 0;
+			};
+
+			size_type	size() const {
+				return _size;
+			};
+
+			size_type	max_size() const {
+				return _alloc.max_size();
+			};
+
+
+			/*
+			**	Leaf_capacity / Inner_capacity
+			**
+			**	Number of values a leaf can hold and number of separators an inner node can hold.
+			*/
+
+			static int	leaf_capacity() {
+				return traits::leaf_slots;
+			};
+
+			static int	inner_capacity() {
+				return traits::inner_slots;
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			/*
+			**	Clear
+			**
+			**	Erases all elements from the container. After this call, size() returns zero.
+			*/
+
+			void clear() {
+				if (_root) {
+					destroy_tree(_root);
+				}
+				_root = NULL;
+				_header._first = NULL;
+				_header._last = NULL;
+				_size = 0;
+			};
+
+
+			/*
+			**	Insert
+			**
+			**	Inserts element(s) into the container, if the container doesn't already
+			**	contain an element with an equivalent key.
+			**		1) Inserts value.
+			**		2) Inserts value, in the leaf of hint without a descent from the root when
+			**		   the value goes right before hint and that leaf is the one a descent
+			**		   would reach: inside the leaf, before begin() or at end().
+			**		3) Inserts elements from range [first, last).
+			**	A full leaf is split in two halves and the first key of the new leaf is
+			**	pushed up to the parent, splitting full inner nodes on the way up.
+			*/
+
+			pair<iterator, bool> insert( const value_type& value ) {
+				if (_root == NULL) {
+					tleaf *lf = new_leaf();
+					_root = lf;
+					_header._first = lf;
+					_header._last = lf;
+				}
+				tleaf *lf = find_leaf(value.first);
+				int pos = leaf_lower(lf, value.first);
+				if (pos < lf->_count && !_comp(value.first, lf->values()[pos].first)) {
+					return pair<iterator, bool>(iterator(lf, pos, &_header), false);
+				}
+				return pair<iterator, bool>(insert_in_leaf(lf, pos, value), true);
+			};
+
+			// Sorted ranges are appended to the last leaf without a descent
+			template< class InputIt >
+			void insert( InputIt first, InputIt last ) {
+				for (; first != last; ++first) {
+					insert(end(), *first);
+				}
+			};
+
+			// The separators above a leaf only bound its first and last keys, so a value
+			// falling between two leaves takes the descent
+			iterator	insert( iterator hint, const value_type& value ) {
+				tleaf *lf = hint.getleaf();
+				int pos = hint.getindex();
+				if (lf == NULL) {
+					lf = _header._last;
+					pos = lf ? lf->_count : 0;
+				}
+				if (lf == NULL || (pos == 0 && lf != _header._first)) {
+					return insert(value).first;
+				}
+				const value_type *v = lf->values();
+				if ((pos < lf->_count && !_comp(value.first, v[pos].first)) || (pos > 0 && !_comp(v[pos - 1].first, value.first))) {
+					return insert(value).first;
+				}
+				return insert_in_leaf(lf, pos, value);
+			};
+
+
+			/*
+			**	Erase
+			**
+			**	Removes specified elements from the container.
+			**		1) Removes the element at pos.
+			**		2) Removes the elements in the range [first; last).
+			**		3) Removes the element (if one exists) with the key equivalent to key.
+			**	A leaf left less than half full borrows from a sibling, or is merged with it,
+			**	and the same is done on the way up for inner nodes.
+			*/
+
+			void erase( iterator pos ) {
+				tleaf *lf = pos.getleaf();
+				leaf_erase_range(lf, pos.getindex(), 1);
+				_size--;
+				rebalance_leaf(lf);
+			};
+
+			// Leaf by leaf: one descent per leaf the range spans, to find where it goes on after a rebalance
+			void erase( iterator first, iterator last ) {
+				size_type remaining = 0;
+				for (iterator it = first; it != last; ++it) {
+					remaining++;
+				}
+				tleaf *lf = first.getleaf();
+				int pos = first.getindex();
+				while (remaining > 0) {
+					int count = lf->_count - pos;
+					if (static_cast<size_type>(count) > remaining) {
+						count = static_cast<int>(remaining);
+					}
+					leaf_erase_range(lf, pos, count);
+					_size -= count;
+					remaining -= count;
+					if (remaining == 0) {
+						rebalance_leaf(lf);
+						return;
+					}
+					key_type next = lf->_next->values()[0].first;
+					rebalance_leaf(lf);
+					pos = bound(next, lf, false);
+				}
+			};
+
+			size_type erase( const Key& key ) {
+				if (_root == NULL) {
+					return 0;
+				}
+				tleaf *lf = find_leaf(key);
+				int pos = leaf_lower(lf, key);
+				if (pos == lf->_count || _comp(key, lf->values()[pos].first)) {
+					return 0;
+				}
+				leaf_erase_at(lf, pos);
+				_size--;
+				rebalance_leaf(lf);
+				return 1;
+			};
+
+
+			/*
+			**	Swap
+			**
+			**	Exchanges the contents of the container with those of other.
+			**	Iterators stay valid, except the past-the-end iterator.
+			*/
+
+			void swap( btree_map& other ) {
+				std::swap(_allocLeaf, other._allocLeaf);
+				std::swap(_allocInner, other._allocInner);
+				std::swap(_root, other._root);
+				std::swap(_header, other._header);
+				std::swap(_alloc, other._alloc);
+				std::swap(_size, other._size);
+				std::swap(_comp, other._comp);
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			size_type count( const Key& key ) const {
+				return find(key) == end() ? 0 : 1;
+			};
+
+			iterator find( const Key& key ) {
+				tleaf *lf = NULL;
+				int pos = locate(key, lf);
+				return iterator(lf, pos, &_header);
+			};
+
+			const_iterator find( const Key& key ) const {
+				tleaf *lf = NULL;
+				int pos = locate(key, lf);
+				return const_iterator(lf, pos, &_header);
+			};
+
+			ft::pair<iterator,iterator> equal_range( const Key& key ) {
+				return ft::pair<iterator,iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const {
+				return ft::pair<const_iterator,const_iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			iterator lower_bound( const Key& key ) {
+				tleaf *lf = NULL;
+				int pos = bound(key, lf, false);
+				return iterator(lf, pos, &_header);
+			};
+
+			const_iterator lower_bound( const Key& key ) const {
+				tleaf *lf = NULL;
+				int pos = bound(key, lf, false);
+				return const_iterator(lf, pos, &_header);
+			};
+
+			iterator upper_bound( const Key& key ) {
+				tleaf *lf = NULL;
+				int pos = bound(key, lf, true);
+				return iterator(lf, pos, &_header);
+			};
+
+			const_iterator upper_bound( const Key& key ) const {
+				tleaf *lf = NULL;
+				int pos = bound(key, lf, true);
+				return const_iterator(lf, pos, &_header);
+			};
+
+
+
+			/*******************************/
+			/*****      OBSERVERS      *****/
+			/*******************************/
+
+
+
+			key_compare key_comp() const {
+				return _comp;
+			};
+
+			value_compare value_comp() const {
+				return value_compare(_comp);
+			};
+
+
+
+			/***************************/
+			/*****      BTREE      *****/
+			/***************************/
+
+		private:
+
+			// Descend from the root to the leaf whose key range covers key
+			tleaf	*find_leaf( const Key& key ) const {
+				tnode *nd = _root;
+				while (!nd->_leaf) {
+					tinner *in = static_cast<tinner *>(nd);
+					nd = in->_children[search::upper(in->_keys, in->_count, key, _comp)];
+				}
+				return static_cast<tleaf *>(nd);
+			};
+
+			// Index of the first value of lf whose key is not less than key
+			int	leaf_lower( const tleaf *lf, const Key& key ) const {
+				const value_type *v = lf->values();
+				int lo = 0;
+				int hi = lf->_count;
+				while (lo < hi) {
+					int mid = (lo + hi) >> 1;
+					if (_comp(v[mid].first, key)) {
+						lo = mid + 1;
+					}
+					else {
+						hi = mid;
+					}
+				}
+				return lo;
+			};
+
+			// Index of the first value of lf whose key is greater than key
+			int	leaf_upper( const tleaf *lf, const Key& key ) const {
+				const value_type *v = lf->values();
+				int lo = 0;
+				int hi = lf->_count;
+				while (lo < hi) {
+					int mid = (lo + hi) >> 1;
+					if (_comp(key, v[mid].first)) {
+						hi = mid;
+					}
+					else {
+						lo = mid + 1;
+					}
+				}
+				return lo;
+			};
+
+			// Position of key, or the past-the-end position (NULL leaf) if it is missing
+			int	locate( const Key& key, tleaf *&lf ) const {
+				if (_root == NULL) {
+					lf = NULL;
+					return 0;
+				}
+				lf = find_leaf(key);
+				int pos = leaf_lower(lf, key);
+				if (pos == lf->_count || _comp(key, lf->values()[pos].first)) {
+					lf = NULL;
+					return 0;
+				}
+				return pos;
+			};
+
+			// Position of lower_bound (or upper_bound if upper is set), past the end of a leaf moves to the next one
+			int	bound( const Key& key, tleaf *&lf, bool upper ) const {
+				if (_root == NULL) {
+					lf = NULL;
+					return 0;
+				}
+				lf = find_leaf(key);
+				int pos = upper ? leaf_upper(lf, key) : leaf_lower(lf, key);
+				if (pos == lf->_count) {
+					lf = lf->_next;
+					return 0;
+				}
+				return pos;
+			};
+
+			int	child_index( const tinner *parent, const tnode *child ) const {
+				int i = 0;
+				while (parent->_children[i] != child) {
+					i++;
+				}
+				return i;
+			};
+
+			tleaf	*new_leaf() {
+				tleaf *lf = _allocLeaf.allocate(1);
+				_allocLeaf.construct(lf, tleaf());
+				lf->_parent = NULL;
+				lf->_count = 0;
+				lf->_leaf = true;
+				lf->_prev = NULL;
+				lf->_next = NULL;
+				return lf;
+			};
+
+			tinner	*new_inner() {
+				tinner *in = _allocInner.allocate(1);
+				_allocInner.construct(in, tinner());
+				in->_parent = NULL;
+				in->_count = 0;
+				in->_leaf = false;
+				return in;
+			};
+
+			void	free_leaf( tleaf *lf ) {
+				for (int i = 0; i < lf->_count; i++) {
+					_alloc.destroy(lf->values() + i);
+				}
+				_allocLeaf.destroy(lf);
+				_allocLeaf.deallocate(lf, 1);
+			};
+
+			void	free_inner( tinner *in ) {
+				_allocInner.destroy(in);
+				_allocInner.deallocate(in, 1);
+			};
+
+			void	destroy_tree( tnode *nd ) {
+				if (nd->_leaf) {
+					free_leaf(static_cast<tleaf *>(nd));
+					return;
+				}
+				tinner *in = static_cast<tinner *>(nd);
+				for (int i = 0; i <= in->_count; i++) {
+					destroy_tree(in->_children[i]);
+				}
+				free_inner(in);
+			};
+
+			// Move the value at src into the raw slot dst
+			void	move_value( value_type *dst, value_type *src ) {
+				_alloc.construct(dst, *src);
+				_alloc.destroy(src);
+			};
+
+			void	leaf_insert_at( tleaf *lf, int pos, const value_type& value ) {
+				value_type *v = lf->values();
+				for (int i = lf->_count; i > pos; i--) {
+					move_value(v + i, v + i - 1);
+				}
+				_alloc.construct(v + pos, value);
+				lf->_count++;
+			};
+
+			void	leaf_erase_at( tleaf *lf, int pos ) {
+				leaf_erase_range(lf, pos, 1);
+			};
+
+			// Remove count values from pos, shifting the rest of the leaf down once
+			void	leaf_erase_range( tleaf *lf, int pos, int count ) {
+				value_type *v = lf->values();
+				for (int i = pos; i < pos + count; i++) {
+					_alloc.destroy(v + i);
+				}
+				for (int i = pos; i < lf->_count - count; i++) {
+					move_value(v + i, v + i + count);
+				}
+				lf->_count -= count;
+			};
+
+			// Insert value at pos in lf, splitting lf first when it is full
+			iterator	insert_in_leaf( tleaf *lf, int pos, const value_type& value ) {
+				if (lf->_count == traits::leaf_slots) {
+					tleaf *left = lf;
+					tleaf *right = split_leaf(left);
+					if (pos > left->_count) {
+						pos -= left->_count;
+						lf = right;
+					}
+					leaf_insert_at(lf, pos, value);
+					insert_in_parent(left, right->values()[0].first, right);
+				}
+				else {
+					leaf_insert_at(lf, pos, value);
+				}
+				_size++;
+				return iterator(lf, pos, &_header);
+			};
+
+			// Move the upper half of a full leaf to a new leaf chained right after it
+			tleaf	*split_leaf( tleaf *lf ) {
+				tleaf *right = new_leaf();
+				int mid = lf->_count / 2;
+				for (int i = mid; i < lf->_count; i++) {
+					move_value(right->values() + i - mid, lf->values() + i);
+				}
+				right->_count = lf->_count - mid;
+				lf->_count = mid;
+				right->_prev = lf;
+				right->_next = lf->_next;
+				if (lf->_next) {
+					lf->_next->_prev = right;
+				}
+				else {
+					_header._last = right;
+				}
+				lf->_next = right;
+				return right;
+			};
+
+			void	inner_insert_at( tinner *in, int idx, const Key& sep, tnode *right ) {
+				for (int i = in->_count; i > idx; i--) {
+					in->_keys[i] = in->_keys[i - 1];
+					in->_children[i + 1] = in->_children[i];
+				}
+				in->_keys[idx] = sep;
+				in->_children[idx + 1] = right;
+				right->_parent = in;
+				in->_count++;
+			};
+
+			// Remove the separator idx and the child on its right
+			void	inner_erase_at( tinner *in, int idx ) {
+				for (int i = idx; i < in->_count - 1; i++) {
+					in->_keys[i] = in->_keys[i + 1];
+					in->_children[i + 1] = in->_children[i + 2];
+				}
+				in->_count--;
+			};
+
+			// Register right, the new sibling of left, in their parent
+			void	insert_in_parent( tnode *left, const Key& sep, tnode *right ) {
+				tinner *parent = left->_parent;
+				if (parent == NULL) {
+					tinner *root = new_inner();
+					root->_keys[0] = sep;
+					root->_children[0] = left;
+					root->_children[1] = right;
+					root->_count = 1;
+					left->_parent = root;
+					right->_parent = root;
+					_root = root;
+					return;
+				}
+				int idx = child_index(parent, left);
+				if (parent->_count < traits::inner_slots) {
+					inner_insert_at(parent, idx, sep, right);
+					return;
+				}
+
+				const int total = traits::inner_slots + 1;
+				Key keys[total];
+				tnode *children[total + 1];
+				for (int i = 0, j = 0; i < total; i++) {
+					keys[i] = (i == idx) ? sep : parent->_keys[j++];
+				}
+				for (int i = 0, j = 0; i <= total; i++) {
+					children[i] = (i == idx + 1) ? right : parent->_children[j++];
+				}
+
+				int mid = total / 2;
+				tinner *sibling = new_inner();
+				parent->_count = mid;
+				for (int i = 0; i <= mid; i++) {
+					if (i < mid) {
+						parent->_keys[i] = keys[i];
+					}
+					parent->_children[i] = children[i];
+					children[i]->_parent = parent;
+				}
+				sibling->_count = total - mid - 1;
+				for (int i = mid + 1; i <= total; i++) {
+					if (i < total) {
+						sibling->_keys[i - mid - 1] = keys[i];
+					}
+					sibling->_children[i - mid - 1] = children[i];
+					children[i]->_parent = sibling;
+				}
+				insert_in_parent(parent, keys[mid], sibling);
+			};
+
+			void	rebalance_leaf( tleaf *lf ) {
+				if (lf == _root) {
+					if (lf->_count == 0) {
+						free_leaf(lf);
+						_root = NULL;
+						_header._first = NULL;
+						_header._last = NULL;
+					}
+					return;
+				}
+				const int min = traits::leaf_slots / 2;
+				if (lf->_count >= min) {
+					return;
+				}
+				tinner *parent = lf->_parent;
+				int idx = child_index(parent, lf);
+				tleaf *left = idx > 0 ? static_cast<tleaf *>(parent->_children[idx - 1]) : NULL;
+				tleaf *right = idx < parent->_count ? static_cast<tleaf *>(parent->_children[idx + 1]) : NULL;
+
+				if (left && left->_count > min) {
+					leaf_insert_at(lf, 0, left->values()[left->_count - 1]);
+					leaf_erase_at(left, left->_count - 1);
+					parent->_keys[idx - 1] = lf->values()[0].first;
+				}
+				else if (right && right->_count > min) {
+					leaf_insert_at(lf, lf->_count, right->values()[0]);
+					leaf_erase_at(right, 0);
+					parent->_keys[idx] = right->values()[0].first;
+				}
+				else if (left) {
+					merge_leaves(left, lf, idx - 1);
+				}
+				else {
+					merge_leaves(lf, right, idx);
+				}
+			};
+
+			// Append right to left, right being the child sep + 1 of their parent
+			void	merge_leaves( tleaf *left, tleaf *right, int sep ) {
+				for (int i = 0; i < right->_count; i++) {
+					move_value(left->values() + left->_count + i, right->values() + i);
+				}
+				left->_count += right->_count;
+				right->_count = 0;
+				left->_next = right->_next;
+				if (right->_next) {
+					right->_next->_prev = left;
+				}
+				else {
+					_header._last = left;
+				}
+				tinner *parent = left->_parent;
+				free_leaf(right);
+				inner_erase_at(parent, sep);
+				rebalance_inner(parent);
+			};
+
+			void	rebalance_inner( tinner *in ) {
+				if (in == _root) {
+					if (in->_count == 0) {
+						_root = in->_children[0];
+						_root->_parent = NULL;
+						free_inner(in);
+					}
+					return;
+				}
+				const int min = (traits::inner_slots - 1) / 2;
+				if (in->_count >= min) {
+					return;
+				}
+				tinner *parent = in->_parent;
+				int idx = child_index(parent, in);
+				tinner *left = idx > 0 ? static_cast<tinner *>(parent->_children[idx - 1]) : NULL;
+				tinner *right = idx < parent->_count ? static_cast<tinner *>(parent->_children[idx + 1]) : NULL;
+
+				if (left && left->_count > min) {
+					for (int i = in->_count; i > 0; i--) {
+						in->_keys[i] = in->_keys[i - 1];
+					}
+					for (int i = in->_count + 1; i > 0; i--) {
+						in->_children[i] = in->_children[i - 1];
+					}
+					in->_keys[0] = parent->_keys[idx - 1];
+					in->_children[0] = left->_children[left->_count];
+					in->_children[0]->_parent = in;
+					parent->_keys[idx - 1] = left->_keys[left->_count - 1];
+					left->_count--;
+					in->_count++;
+				}
+				else if (right && right->_count > min) {
+					in->_keys[in->_count] = parent->_keys[idx];
+					in->_children[in->_count + 1] = right->_children[0];
+					in->_children[in->_count + 1]->_parent = in;
+					parent->_keys[idx] = right->_keys[0];
+					for (int i = 0; i < right->_count - 1; i++) {
+						right->_keys[i] = right->_keys[i + 1];
+					}
+					for (int i = 0; i < right->_count; i++) {
+						right->_children[i] = right->_children[i + 1];
+					}
+					right->_count--;
+					in->_count++;
+				}
+				else if (left) {
+					merge_inners(left, in, idx - 1);
+				}
+				else {
+					merge_inners(in, right, idx);
+				}
+			};
+
+			// Pull the separator sep down and append right to left
+			void	merge_inners( tinner *left, tinner *right, int sep ) {
+				tinner *parent = left->_parent;
+				left->_keys[left->_count] = parent->_keys[sep];
+				for (int i = 0; i < right->_count; i++) {
+					left->_keys[left->_count + 1 + i] = right->_keys[i];
+				}
+				for (int i = 0; i <= right->_count; i++) {
+					left->_children[left->_count + 1 + i] = right->_children[i];
+					right->_children[i]->_parent = left;
+				}
+				left->_count += right->_count + 1;
+				free_inner(right);
+				inner_erase_at(parent, sep);
+				rebalance_inner(parent);
+			};
+
+	};
+
+	/******************************************/
+	/*****      NON-MEMBER FUNCTIONS      *****/
+	/******************************************/
+
+
+
+	/*
+	**	Operators
+	**
+	**	Compares the contents of two btree_maps, like the ft::map operators.
+	*/
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator==( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs ) {
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator!=( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs ) {
+		return !(lhs == rhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs ) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<=( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs ) {
+		return !(rhs < lhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs ) {
+		return (rhs < lhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>=( const ft::btree_map<Key,T,Compare,Alloc>& lhs, const ft::btree_map<Key,T,Compare,Alloc>& rhs ) {
+		return !(lhs < rhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	void swap( ft::btree_map<Key,T,Compare,Alloc>& lhs, ft::btree_map<Key,T,Compare,Alloc>& rhs ) {
+		lhs.swap(rhs);
+	};
+
+}; // namespace ft
+
+#endif /*BTREE_MAP_HPP*/
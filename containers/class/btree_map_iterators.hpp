@@ -0,0 +1,171 @@
+#pragma once
+
+#ifndef BTREE_MAP_ITERATORS_HPP
+# define BTREE_MAP_ITERATORS_HPP
+
+namespace ft {
+
+	/*
+	**	Btree_map_iterators
+	**
+	**	Elements of a btree_map live inline in the leaves, and the leaves are chained
+	**	in key order. An iterator is a (leaf, slot) position; the past-the-end iterator
+	**	has no leaf and keeps a pointer to the tree header so that it can still be
+	**	decremented to the last element (needed by ft::reverse_iterator).
+	*/
+
+	template < typename Leaf, typename Header, typename T >
+		class btree_map_iterators {
+
+			public:
+
+				/**********************************/
+				/*****      MEMBER TYPES      *****/
+				/**********************************/
+
+				typedef T                               	value_type;
+				typedef T*                              	pointer;
+				typedef T&                              	reference;
+				typedef std::ptrdiff_t                  	difference_type;
+				typedef std::size_t                     	size_type;
+				typedef std::bidirectional_iterator_tag 	iterator_category;
+
+			private:
+
+				/**************************************/
+				/*****      MEMBER ATTRIBUTES     *****/
+				/**************************************/
+
+				Leaf					*_leaf;
+				int						_index;
+				const Header	*_header;
+
+			public:
+
+				/**************************************/
+				/*****      MEMBER FUNCTIONS      *****/
+				/**************************************/
+
+				btree_map_iterators()
+					: _leaf(NULL), _index(0), _header(NULL) {
+				};
+
+				btree_map_iterators( Leaf *leaf, int index, const Header *header )
+					: _leaf(leaf), _index(index), _header(header) {
+				};
+
+				btree_map_iterators( const btree_map_iterators &other )
+					: _leaf(other._leaf), _index(other._index), _header(other._header) {
+				};
+
+				virtual ~btree_map_iterators() {
+				};
+
+				btree_map_iterators &operator=( const btree_map_iterators &other ) {
+					if ( this != &other ) {
+						_leaf = other._leaf;
+						_index = other._index;
+						_header = other._header;
+					}
+					return *this;
+				};
+
+				btree_map_iterators &operator+=( difference_type n ) {
+					for ( difference_type i = 0; i < n; ++i ) {
+						++(*this);
+					}
+					return *this;
+				};
+
+				btree_map_iterators &operator-=( difference_type n ) {
+					for ( difference_type i = 0; i < n; ++i ) {
+						--(*this);
+					}
+					return *this;
+				};
+
+
+
+				/************************************/
+				/*****      ELEMENT ACCESS      *****/
+				/************************************/
+
+
+
+				operator btree_map_iterators<Leaf, Header, T const>() const {
+					return btree_map_iterators<Leaf, Header, T const>(_leaf, _index, _header);
+				};
+
+				reference operator*() const {
+					return _leaf->values()[_index];
+				};
+
+				pointer operator->() const {
+					return _leaf->values() + _index;
+				};
+
+
+
+				/*******************************/
+				/*****      OPERATORS      *****/
+				/*******************************/
+
+
+
+				btree_map_iterators& operator++() {
+					if (++_index >= _leaf->_count) {
+						_leaf = _leaf->_next;
+						_index = 0;
+					}
+					return *this;
+				};
+
+				btree_map_iterators operator++(int) {
+					btree_map_iterators temp = *this;
+					++(*this);
+					return temp;
+				};
+
+				btree_map_iterators& operator--() {
+					if (_leaf == NULL) {
+						_leaf = _header->_last;
+						_index = _leaf->_count - 1;
+					}
+					else if (_index == 0) {
+						_leaf = _leaf->_prev;
+						_index = _leaf->_count - 1;
+					}
+					else {
+						--_index;
+					}
+					return *this;
+				};
+
+				btree_map_iterators operator--(int) {
+					btree_map_iterators temp = *this;
+					--(*this);
+					return temp;
+				};
+
+				Leaf	*getleaf() const {
+					return _leaf;
+				};
+
+				int		getindex() const {
+					return _index;
+				};
+
+				friend bool operator==( const btree_map_iterators& lhs, const btree_map_iterators& rhs ) {
+					return lhs._leaf == rhs._leaf && lhs._index == rhs._index;
+				};
+
+				friend bool operator!=( const btree_map_iterators& lhs, const btree_map_iterators& rhs ) {
+					return !(lhs == rhs);
+				};
+
+		}; // btree_map_iterators
+
+}; // namespace ft
+
+
+#endif /* BTREE_MAP_ITERATORS_HPP */
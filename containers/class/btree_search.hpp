@@ -0,0 +1,263 @@
+#pragma once
+
+#ifndef BTREE_SEARCH_HPP
+# define BTREE_SEARCH_HPP
+
+# include <functional>
+
+# ifdef __SSE2__
+#  include <emmintrin.h>
+# endif
+# ifdef __SSE4_2__
+#  include <nmmintrin.h>
+# endif
+
+/*
+**	Btree_search
+**
+**	Intra-node key search used by ft::btree_map. Both functions work on a sorted
+**	array of n keys:
+**		- lower() returns the index of the first key that is not less than key.
+**		- upper() returns the index of the first key that is greater than key.
+**	The generic version is a binary search driven by Compare. When the keys are
+**	arithmetic and compared with std::less, the specializations below compare a
+**	whole group of keys per instruction with SSE2 (SSE4.2 for 64-bit integers).
+**	Groups always load a full 16 bytes, so the caller must pad the key array to a
+**	multiple of 16 bytes; lanes past n are masked out.
+*/
+
+namespace ft {
+
+	template < typename Key, typename Compare >
+	struct btree_search
+	{
+		static int lower( const Key *keys, int n, const Key& key, const Compare& comp ) {
+			int lo = 0;
+			int hi = n;
+			while (lo < hi) {
+				int mid = (lo + hi) >> 1;
+				if (comp(keys[mid], key)) {
+					lo = mid + 1;
+				}
+				else {
+					hi = mid;
+				}
+			}
+			return lo;
+		};
+
+		static int upper( const Key *keys, int n, const Key& key, const Compare& comp ) {
+			int lo = 0;
+			int hi = n;
+			while (lo < hi) {
+				int mid = (lo + hi) >> 1;
+				if (comp(key, keys[mid])) {
+					hi = mid;
+				}
+				else {
+					lo = mid + 1;
+				}
+			}
+			return lo;
+		};
+	};
+
+# ifdef __SSE2__
+
+	// Index of the first lane set in mask among the n - i lanes still in range, or -1
+	inline int btree_first_lane( int mask, int i, int lanes, int n ) {
+		if (n - i < lanes) {
+			mask &= (1 << (n - i)) - 1;
+		}
+		if (mask) {
+			return i + __builtin_ctz(mask);
+		}
+		return -1;
+	};
+
+	template < >
+	struct btree_search< int, std::less<int> >
+	{
+		static int lower( const int *keys, int n, const int& key, const std::less<int>& ) {
+			__m128i k = _mm_set1_epi32(key);
+			for (int i = 0; i < n; i += 4) {
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+				int ge = ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(v, k))) & 0xF;
+				int found = btree_first_lane(ge, i, 4, n);
+				if (found >= 0) {
+					return found;
+				}
+			}
+			return n;
+		};
+
+		static int upper( const int *keys, int n, const int& key, const std::less<int>& ) {
+			__m128i k = _mm_set1_epi32(key);
+			for (int i = 0; i < n; i += 4) {
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+				int gt = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, k)));
+				int found = btree_first_lane(gt, i, 4, n);
+				if (found >= 0) {
+					return found;
+				}
+			}
+			return n;
+		};
+	};
+
+	// Unsigned lanes are compared as signed ones once their sign bit is flipped
+	template < >
+	struct btree_search< unsigned int, std::less<unsigned int> >
+	{
+		static int lower( const unsigned int *keys, int n, const unsigned int& key, const std::less<unsigned int>& ) {
+			__m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+			__m128i k = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(key)), bias);
+			for (int i = 0; i < n; i += 4) {
+				__m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), bias);
+				int ge = ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(v, k))) & 0xF;
+				int found = btree_first_lane(ge, i, 4, n);
+				if (found >= 0) {
+					return found;
+				}
+			}
+			return n;
+		};
+
+		static int upper( const unsigned int *keys, int n, const unsigned int& key, const std::less<unsigned int>& ) {
+			__m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+			__m128i k = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(key)), bias);
+			for (int i = 0; i < n; i += 4) {
+				__m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), bias);
+				int gt = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, k)));
+				int found = btree_first_lane(gt, i, 4, n);
+				if (found >= 0) {
+					return found;
+				}
+			}
+			return n;
+		};
+	};
+
+	template < >
+	struct btree_search< float, std::less<float> >
+	{
+		static int lower( const float *keys, int n, const float& key, const std::less<float>& ) {
+			__m128 k = _mm_set1_ps(key);
+			for (int i = 0; i < n; i += 4) {
+				int ge = _mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(keys + i), k));
+				int found = btree_first_lane(ge, i, 4, n);
+				if (found >= 0) {
+					return found;
+				}
+			}
+			return n;
+		};
+
+		static int upper( const float *keys, int n, const float& key, const std::less<float>& ) {
+			__m128 k = _mm_set1_ps(key);
+			for (int i = 0; i < n; i += 4) {
+				int gt = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(keys + i), k));
+				int found = btree_first_lane(gt, i, 4, n);
+				if (found >= 0) {
+					return found;
+				}
+			}
+			return n;
+		};
+	};
+
+	template < >
+	struct btree_search< double, std::less<double> >
+	{
+		static int lower( const double *keys, int n, const double& key, const std::less<double>& ) {
+			__m128d k = _mm_set1_pd(key);
+			for (int i = 0; i < n; i += 2) {
+				int ge = _mm_movemask_pd(_mm_cmpge_pd(_mm_loadu_pd(keys + i), k));
+				int found = btree_first_lane(ge, i, 2, n);
+				if (found >= 0) {
+					return found;
+				}
+			}
+			return n;
+		};
+
+		static int upper( const double *keys, int n, const double& key, const std::less<double>& ) {
+			__m128d k = _mm_set1_pd(key);
+			for (int i = 0; i < n; i += 2) {
+				int gt = _mm_movemask_pd(_mm_cmpgt_pd(_mm_loadu_pd(keys + i), k));
+				int found = btree_first_lane(gt, i, 2, n);
+				if (found >= 0) {
+					return found;
+				}
+			}
+			return n;
+		};
+	};
+
+# endif /* __SSE2__ */
+
+# ifdef __SSE4_2__
+
+	template < typename Int >
+	struct btree_search_epi64
+	{
+		static int lower( const Int *keys, int n, const Int& key ) {
+			__m128i k = _mm_set1_epi64x(static_cast<long long>(key));
+			for (int i = 0; i < n; i += 2) {
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+				int ge = ~_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(k, v))) & 0x3;
+				int found = btree_first_lane(ge, i, 2, n);
+				if (found >= 0) {
+					return found;
+				}
+			}
+			return n;
+		};
+
+		static int upper( const Int *keys, int n, const Int& key ) {
+			__m128i k = _mm_set1_epi64x(static_cast<long long>(key));
+			for (int i = 0; i < n; i += 2) {
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+				int gt = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(v, k)));
+				int found = btree_first_lane(gt, i, 2, n);
+				if (found >= 0) {
+					return found;
+				}
+			}
+			return n;
+		};
+	};
+
+	template < >
+	struct btree_search< long long, std::less<long long> >
+	{
+		static int lower( const long long *keys, int n, const long long& key, const std::less<long long>& ) {
+			return btree_search_epi64<long long>::lower(keys, n, key);
+		};
+
+		static int upper( const long long *keys, int n, const long long& key, const std::less<long long>& ) {
+			return btree_search_epi64<long long>::upper(keys, n, key);
+		};
+	};
+
+#  if __SIZEOF_LONG__ == 8
+
+	template < >
+	struct btree_search< long, std::less<long> >
+	{
+		static int lower( const long *keys, int n, const long& key, const std::less<long>& ) {
+			return btree_search_epi64<long>::lower(keys, n, key);
+		};
+
+		static int upper( const long *keys, int n, const long& key, const std::less<long>& ) {
+			return btree_search_epi64<long>::upper(keys, n, key);
+		};
+	};
+
+#  endif
+
+# endif /* __SSE4_2__ */
+
+}; // namespace ft
+
+#endif /* BTREE_SEARCH_HPP */
@@ -0,0 +1,859 @@
+#pragma once
+
+#ifndef COMPACT_MAP_HPP
+# define COMPACT_MAP_HPP
+
+# include <stdexcept>
+# include "utils.hpp"
+
+namespace ft {
+
+	/*
+	**	Compact_map
+	**
+	**	Sorted key-value pairs on an AVL tree whose nodes live in one growable array
+	**	and link to each other through 32-bit indices (see compact_node): a node
+	**	carries 13 bytes of links and height instead of 36 for ft::map, and the map
+	**	is one block of memory that can be copied, moved or mapped without rewriting
+	**	a single link. Erased slots are kept on a free list and reused by the next
+	**	insertions; defragment() rewrites the nodes in key order without holes.
+	**	Iterators survive the growth of the array, but references and pointers to
+	**	elements do not, like for ft::vector; swap() invalidates every iterator.
+	**	At most 2^32 - 2 elements.
+	*/
+
+	template < typename Key, typename T, typename Compare = std::less<Key>, typename Allocator = std::allocator<ft::pair<const Key, T> > >
+	class compact_map
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef T																														mapped_type;
+			typedef typename ft::pair<const Key, T>															value_type;
+
+			typedef std::size_t																									size_type;
+			typedef std::ptrdiff_t																							difference_type;
+
+			typedef Compare																											key_compare;
+			typedef Allocator																										allocator_type;
+			typedef value_type&																									reference;
+			typedef const value_type&																						const_reference;
+
+			typedef typename allocator_type::pointer														pointer;
+			typedef typename allocator_type::const_pointer											const_pointer;
+			typedef compact_map_iterators<compact_node<value_type>, value_type>			iterator;
+			typedef compact_map_iterators<compact_node<value_type>, const value_type>	const_iterator;
+			typedef ft::reverse_iterator<iterator>															reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>												const_reverse_iterator;
+
+		protected:
+
+			typedef compact_node<value_type>																		cnode;
+			typedef typename allocator_type::template rebind<cnode>::other			node_alloc;
+
+		public:
+
+			/************************************/
+			/*****      MEMBER CLASSES      *****/
+			/************************************/
+
+			class value_compare : public std::binary_function<value_type, value_type, bool>
+			{
+				protected:
+
+					Compare comp;
+
+				public:
+
+					value_compare( Compare c )
+						: comp(c) {
+					};
+
+					bool operator()( const value_type& x, const value_type& y ) const {
+						return comp(x.first, y.first);
+					};
+			};
+
+		private:
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			allocator_type	_alloc;
+			node_alloc			_allocNode;
+			Compare					_comp;
+			cnode						*_nodes;
+			compact_index		_capacity;
+			compact_index		_used;
+			compact_index		_free;
+			size_type				_size;
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+
+
+			/*
+			**	Constructors
+			**
+			**		1) Constructs an empty container.
+			**		2) Constructs the container with the contents of the range [first, last).
+			**		3) Copy constructor. The array of other is copied slot by slot,
+			**		   so the copy keeps its layout.
+			*/
+
+			explicit compact_map( const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _alloc(alloc), _allocNode(alloc), _comp(comp), _nodes(NULL), _capacity(0), _used(0), _free(0), _size(0) {
+				initialize_header(1);
+			};
+
+			template< class InputIt >
+			compact_map( InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _alloc(alloc), _allocNode(alloc), _comp(comp), _nodes(NULL), _capacity(0), _used(0), _free(0), _size(0) {
+				initialize_header(1);
+				insert(first, last);
+			};
+
+			compact_map( const compact_map& other )
+				: _alloc(other._alloc), _allocNode(other._allocNode), _comp(other._comp), _nodes(NULL), _capacity(0),
+				_used(0), _free(0), _size(0) {
+				initialize_header(other._used);
+				copy_nodes(other);
+			};
+
+
+			/*
+			**	Destructor
+			*/
+
+			~compact_map() {
+				clear();
+				_allocNode.deallocate(_nodes, _capacity);
+			};
+
+
+			/*
+			**	Operator=
+			**
+			**	Copy assignment operator. Replaces the contents with a copy of the contents of other.
+			*/
+
+			compact_map& operator=( const compact_map& other ) {
+				if (this != &other) {
+					clear();
+					_comp = other._comp;
+					if (other._used > _capacity) {
+						reallocate(other._used);
+					}
+					copy_nodes(other);
+				}
+				return *this;
+			};
+
+			allocator_type	get_allocator() const {
+				return _alloc;
+			};
+
+
+
+			/************************************/
+			/*****      ELEMENT ACCESS      *****/
+			/************************************/
+
+
+
+			T& at( const Key& key ) {
+				compact_index i = find_index(key);
+				if (i == 0) {
+					throw std::out_of_range("Key not found");
+				}
+				return _nodes[i]._data.second;
+			};
+
+			const T& at( const Key& key ) const {
+				compact_index i = find_index(key);
+				if (i == 0) {
+					throw std::out_of_range("Key not found");
+				}
+				return _nodes[i]._data.second;
+			};
+
+			T& operator[]( const Key& key ) {
+				return insert(value_type(key, T())).first->second;
+			};
+
+
+
+			/******************************/
+			/*****      ITERATOR      *****/
+			/******************************/
+
+
+
+			iterator begin() {
+				return make_iterator(_nodes[0]._left);
+			};
+
+			const_iterator begin() const {
+				return make_iterator(_nodes[0]._left);
+			};
+
+			iterator end() {
+				return make_iterator(0);
+			};
+
+			const_iterator end() const {
+				return make_iterator(0);
+			};
+
+			reverse_iterator rbegin() {
+				return reverse_iterator(end());
+			};
+
+			const_reverse_iterator rbegin() const {
+				return const_reverse_iterator(end());
+			};
+
+			reverse_iterator rend() {
+				return reverse_iterator(begin());
+			};
+
+			const_reverse_iterator rend() const {
+				return const_reverse_iterator(begin());
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return _size == 0;
+			};
+
+			size_type	size() const {
+				return _size;
+			};
+
+			size_type	max_size() const {
+				size_type limit = static_cast<compact_index>(-1) - 1;
+				return _allocNode.max_size() - 1 < limit ? _allocNode.max_size() - 1 : limit;
+			};
+
+			// Number of elements the array can hold before it is reallocated
+			size_type	capacity() const {
+				return _capacity - 1;
+			};
+
+			void	reserve( size_type new_cap ) {
+				if (new_cap > max_size()) {
+					throw std::length_error("compact_map::reserve");
+				}
+				if (new_cap + 1 > _capacity) {
+					reallocate(static_cast<compact_index>(new_cap + 1));
+				}
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			// Destroys every element; the array keeps its capacity
+			void clear() {
+				for (compact_index i = 1; i < _used; i++) {
+					if (_nodes[i]._height) {
+						_alloc.destroy(&_nodes[i]._data);
+					}
+				}
+				_used = 1;
+				_free = 0;
+				_size = 0;
+				_nodes[0]._left = 0;
+				_nodes[0]._right = 0;
+				_nodes[0]._parent = 0;
+			};
+
+
+			/*
+			**	Insert
+			**
+			**	Inserts value if the container doesn't already contain an element with an equivalent key.
+			**	The new node takes a free slot if there is one, otherwise the next slot of
+			**	the array, which doubles its capacity when it is full.
+			**	With a hint, when the value goes right before hint, it is linked under hint
+			**	or under its predecessor, whichever has a free child slot, without a descent
+			**	from the root; otherwise the hint is ignored.
+			*/
+
+			pair<iterator, bool> insert( const value_type& value ) {
+				compact_index cur = root();
+				compact_index parent = 0;
+				bool left = false;
+				while (cur) {
+					parent = cur;
+					left = _comp(value.first, _nodes[cur]._data.first);
+					if (!left && !_comp(_nodes[cur]._data.first, value.first)) {
+						return pair<iterator, bool>(make_iterator(cur), false);
+					}
+					cur = left ? _nodes[cur]._left : _nodes[cur]._right;
+				}
+				return pair<iterator, bool>(link_node(value, parent, left), true);
+			};
+
+			iterator	insert( iterator hint, const value_type& value ) {
+				compact_index h = hint.getindex();
+				compact_index p = h ? prev(h) : _nodes[0]._right;
+				if ((h && !_comp(value.first, _nodes[h]._data.first)) || (p && !_comp(_nodes[p]._data.first, value.first))) {
+					return insert(value).first;
+				}
+				// Between p and h, one of them always has the free child slot
+				if (p && _nodes[p]._right == 0) {
+					return link_node(value, p, false);
+				}
+				return link_node(value, h, true);
+			};
+
+			// Sorted ranges are linked at the end without a descent
+			template< class InputIt >
+			void insert( InputIt first, InputIt last ) {
+				for (; first != last; ++first) {
+					insert(end(), *first);
+				}
+			};
+
+
+			/*
+			**	Erase
+			**
+			**	Removes the element at pos, the elements in [first, last), or the element
+			**	with key equivalent to key. The slot goes to the free list; only the
+			**	iterators to the erased elements are invalidated.
+			*/
+
+			void erase( iterator pos ) {
+				erase_node(pos.getindex());
+			};
+
+			void erase( iterator first, iterator last ) {
+				while (first != last) {
+					erase(first++);
+				}
+			};
+
+			size_type erase( const Key& key ) {
+				compact_index i = find_index(key);
+				if (i == 0) {
+					return 0;
+				}
+				erase_node(i);
+				return 1;
+			};
+
+			void swap( compact_map& other ) {
+				std::swap(_alloc, other._alloc);
+				std::swap(_allocNode, other._allocNode);
+				std::swap(_comp, other._comp);
+				std::swap(_nodes, other._nodes);
+				std::swap(_capacity, other._capacity);
+				std::swap(_used, other._used);
+				std::swap(_free, other._free);
+				std::swap(_size, other._size);
+			};
+
+
+			/*
+			**	Defragment
+			**
+			**	Moves the elements to the first slots of a new array, in key order, and
+			**	links them as a perfectly balanced tree: the free list is emptied, the
+			**	capacity shrinks to the size, and an in-order walk reads memory sequentially.
+			**	Every iterator is invalidated.
+			*/
+
+			void defragment() {
+				cnode *nodes = _allocNode.allocate(_size + 1);
+				compact_index n = 1;
+				for (compact_index i = _nodes[0]._left; i; i = next(i)) {
+					_alloc.construct(&nodes[n]._data, _nodes[i]._data);
+					n++;
+				}
+				clear();
+				_allocNode.deallocate(_nodes, _capacity);
+				_nodes = nodes;
+				_capacity = n;
+				_used = n;
+				_size = n - 1;
+				_nodes[0]._height = 0;
+				_nodes[0]._parent = build_balanced(1, n, 0);
+				_nodes[0]._left = _size ? 1 : 0;
+				_nodes[0]._right = _size ? n - 1 : 0;
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			size_type count( const Key& key ) const {
+				return find_index(key) ? 1 : 0;
+			};
+
+			iterator find( const Key& key ) {
+				return make_iterator(find_index(key));
+			};
+
+			const_iterator find( const Key& key ) const {
+				return make_iterator(find_index(key));
+			};
+
+			ft::pair<iterator,iterator> equal_range( const Key& key ) {
+				return ft::pair<iterator,iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const {
+				return ft::pair<const_iterator,const_iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			iterator lower_bound( const Key& key ) {
+				return make_iterator(lower_bound_index(key));
+			};
+
+			const_iterator lower_bound( const Key& key ) const {
+				return make_iterator(lower_bound_index(key));
+			};
+
+			iterator upper_bound( const Key& key ) {
+				return make_iterator(upper_bound_index(key));
+			};
+
+			const_iterator upper_bound( const Key& key ) const {
+				return make_iterator(upper_bound_index(key));
+			};
+
+
+
+			/*******************************/
+			/*****      OBSERVERS      *****/
+			/*******************************/
+
+
+
+			key_compare key_comp() const {
+				return _comp;
+			};
+
+			value_compare value_comp() const {
+				return value_compare(_comp);
+			};
+
+
+
+			/*********************************/
+			/*****      NODE ARRAY       *****/
+			/*********************************/
+
+		private:
+
+			// The header, slot 0, keeps the root in _parent, the minimum in _left and the maximum in _right
+			compact_index& root() {
+				return _nodes[0]._parent;
+			};
+
+			compact_index root() const {
+				return _nodes[0]._parent;
+			};
+
+			iterator	make_iterator( compact_index i ) {
+				return iterator(&_nodes, i);
+			};
+
+			const_iterator	make_iterator( compact_index i ) const {
+				return const_iterator(&_nodes, i);
+			};
+
+			void	initialize_header( compact_index capacity ) {
+				_nodes = _allocNode.allocate(capacity);
+				_capacity = capacity;
+				_used = 1;
+				_nodes[0]._left = 0;
+				_nodes[0]._right = 0;
+				_nodes[0]._parent = 0;
+				_nodes[0]._height = 0;
+			};
+
+			// Move every slot to a new array of capacity slots, keeping the indices
+			void	reallocate( compact_index capacity ) {
+				cnode *nodes = _allocNode.allocate(capacity);
+				for (compact_index i = 0; i < _used; i++) {
+					if (i && _nodes[i]._height) {
+						_alloc.construct(&nodes[i]._data, _nodes[i]._data);
+						_alloc.destroy(&_nodes[i]._data);
+					}
+					nodes[i]._left = _nodes[i]._left;
+					nodes[i]._right = _nodes[i]._right;
+					nodes[i]._parent = _nodes[i]._parent;
+					nodes[i]._height = _nodes[i]._height;
+				}
+				_allocNode.deallocate(_nodes, _capacity);
+				_nodes = nodes;
+				_capacity = capacity;
+			};
+
+			// Copy the slots of other into this empty map, which has room for them
+			void	copy_nodes( const compact_map& other ) {
+				for (compact_index i = 0; i < other._used; i++) {
+					if (i && other._nodes[i]._height) {
+						_alloc.construct(&_nodes[i]._data, other._nodes[i]._data);
+					}
+					_nodes[i]._left = other._nodes[i]._left;
+					_nodes[i]._right = other._nodes[i]._right;
+					_nodes[i]._parent = other._nodes[i]._parent;
+					_nodes[i]._height = other._nodes[i]._height;
+				}
+				_used = other._used;
+				_free = other._free;
+				_size = other._size;
+			};
+
+			compact_index	new_node( const value_type& value, compact_index parent ) {
+				compact_index nd = _free;
+				if (nd) {
+					_free = _nodes[nd]._left;
+				}
+				else {
+					if (_size >= max_size()) {
+						throw std::length_error("compact_map::insert");
+					}
+					if (_used == _capacity) {
+						size_type grown = _capacity < 8 ? 16 : static_cast<size_type>(_capacity) * 2;
+						reallocate(static_cast<compact_index>(grown < max_size() + 1 ? grown : max_size() + 1));
+					}
+					nd = _used++;
+				}
+				_alloc.construct(&_nodes[nd]._data, value);
+				_nodes[nd]._left = 0;
+				_nodes[nd]._right = 0;
+				_nodes[nd]._parent = parent;
+				_nodes[nd]._height = 1;
+				_size++;
+				return nd;
+			};
+
+			// Hang a new node for value under parent, or as the root when parent is 0
+			iterator	link_node( const value_type& value, compact_index parent, bool left ) {
+				compact_index nd = new_node(value, parent);
+				if (parent == 0) {
+					root() = nd;
+				}
+				else {
+					if (left) {
+						_nodes[parent]._left = nd;
+					}
+					else {
+						_nodes[parent]._right = nd;
+					}
+					rebalance_up(parent, true);
+				}
+				if (_nodes[0]._left == 0 || (parent == _nodes[0]._left && left)) {
+					_nodes[0]._left = nd;
+				}
+				if (_nodes[0]._right == 0 || (parent == _nodes[0]._right && !left)) {
+					_nodes[0]._right = nd;
+				}
+				return make_iterator(nd);
+			};
+
+			void	free_node( compact_index nd ) {
+				_alloc.destroy(&_nodes[nd]._data);
+				_nodes[nd]._height = 0;
+				_nodes[nd]._left = _free;
+				_free = nd;
+				_size--;
+			};
+
+			// Link the slots [lo, hi), already in key order, as a balanced subtree under parent
+			compact_index	build_balanced( compact_index lo, compact_index hi, compact_index parent ) {
+				if (lo >= hi) {
+					return 0;
+				}
+				compact_index mid = lo + (hi - lo) / 2;
+				_nodes[mid]._parent = parent;
+				_nodes[mid]._left = build_balanced(lo, mid, mid);
+				_nodes[mid]._right = build_balanced(mid + 1, hi, mid);
+				update(mid);
+				return mid;
+			};
+
+
+
+			/******************************/
+			/*****      AVL TREE      *****/
+			/******************************/
+
+
+
+			compact_index	find_index( const Key& key ) const {
+				compact_index i = lower_bound_index(key);
+				if (i == 0 || _comp(key, _nodes[i]._data.first)) {
+					return 0;
+				}
+				return i;
+			};
+
+			compact_index	lower_bound_index( const Key& key ) const {
+				compact_index cur = root();
+				compact_index found = 0;
+				while (cur) {
+					if (_comp(_nodes[cur]._data.first, key)) {
+						cur = _nodes[cur]._right;
+					}
+					else {
+						found = cur;
+						cur = _nodes[cur]._left;
+					}
+				}
+				return found;
+			};
+
+			compact_index	upper_bound_index( const Key& key ) const {
+				compact_index cur = root();
+				compact_index found = 0;
+				while (cur) {
+					if (_comp(key, _nodes[cur]._data.first)) {
+						found = cur;
+						cur = _nodes[cur]._left;
+					}
+					else {
+						cur = _nodes[cur]._right;
+					}
+				}
+				return found;
+			};
+
+			compact_index	next( compact_index i ) const {
+				const_iterator it = make_iterator(i);
+				return (++it).getindex();
+			};
+
+			compact_index	prev( compact_index i ) const {
+				if (i == _nodes[0]._left) {
+					return 0;
+				}
+				const_iterator it = make_iterator(i);
+				return (--it).getindex();
+			};
+
+			int	height( compact_index nd ) const {
+				return nd ? _nodes[nd]._height : 0;
+			};
+
+			void	update( compact_index nd ) {
+				int l = height(_nodes[nd]._left);
+				int r = height(_nodes[nd]._right);
+				_nodes[nd]._height = static_cast<unsigned char>((l > r ? l : r) + 1);
+			};
+
+			int	getBalanceFactor( compact_index nd ) const {
+				return nd ? height(_nodes[nd]._left) - height(_nodes[nd]._right) : 0;
+			};
+
+			compact_index	rightRotate( compact_index y ) {
+				compact_index x = _nodes[y]._left;
+				compact_index xr = _nodes[x]._right;
+
+				_nodes[x]._parent = _nodes[y]._parent;
+				_nodes[y]._parent = x;
+				_nodes[x]._right = y;
+				_nodes[y]._left = xr;
+				if (xr) {
+					_nodes[xr]._parent = y;
+				}
+				update(y);
+				update(x);
+				return x;
+			};
+
+			compact_index	leftRotate( compact_index x ) {
+				compact_index y = _nodes[x]._right;
+				compact_index yl = _nodes[y]._left;
+
+				_nodes[y]._parent = _nodes[x]._parent;
+				_nodes[x]._parent = y;
+				_nodes[y]._left = x;
+				_nodes[x]._right = yl;
+				if (yl) {
+					_nodes[yl]._parent = x;
+				}
+				update(x);
+				update(y);
+				return y;
+			};
+
+			// Update root from its children, then rotate if its subtrees differ in height by 2
+			compact_index	balance( compact_index root ) {
+				update(root);
+				int balanceFactor = getBalanceFactor(root);
+				if (balanceFactor > 1) {
+					if (getBalanceFactor(_nodes[root]._left) < 0) {
+						_nodes[root]._left = leftRotate(_nodes[root]._left);
+					}
+					return rightRotate(root);
+				}
+				if (balanceFactor < -1) {
+					if (getBalanceFactor(_nodes[root]._right) > 0) {
+						_nodes[root]._right = rightRotate(_nodes[root]._right);
+					}
+					return leftRotate(root);
+				}
+				return root;
+			};
+
+			/* Rebalance from nd up to the root
+			/ Same walk as ft::tree: after an insertion, a subtree that keeps its height
+			/ leaves its ancestors balanced and the walk stops there.
+			*/
+			void	rebalance_up( compact_index nd, bool insertion ) {
+				while (nd) {
+					compact_index parent = _nodes[nd]._parent;
+					bool left = parent && _nodes[parent]._left == nd;
+					int before = _nodes[nd]._height;
+					compact_index sub = balance(nd);
+					if (parent == 0) {
+						root() = sub;
+					}
+					else if (left) {
+						_nodes[parent]._left = sub;
+					}
+					else {
+						_nodes[parent]._right = sub;
+					}
+					if (insertion && _nodes[sub]._height == before) {
+						return;
+					}
+					nd = parent;
+				}
+			};
+
+			// Put child in the place of nd under the parent of nd
+			void	replace_child( compact_index nd, compact_index child ) {
+				compact_index parent = _nodes[nd]._parent;
+				if (child) {
+					_nodes[child]._parent = parent;
+				}
+				if (parent == 0) {
+					root() = child;
+				}
+				else if (_nodes[parent]._left == nd) {
+					_nodes[parent]._left = child;
+				}
+				else {
+					_nodes[parent]._right = child;
+				}
+			};
+
+			/* Delete a node
+			/ Same steps as ft::tree, on indices: a node with at most one child is replaced
+			/ by it, a node with two children by its in-order successor, then the tree is
+			/ rebalanced from the lowest changed node. The header follows the minimum and maximum.
+			*/
+			void	erase_node( compact_index nd ) {
+				if (_nodes[0]._left == nd) {
+					_nodes[0]._left = next(nd);
+				}
+				if (_nodes[0]._right == nd) {
+					_nodes[0]._right = prev(nd);
+				}
+				compact_index start;
+				compact_index l = _nodes[nd]._left;
+				compact_index r = _nodes[nd]._right;
+				if (l == 0 || r == 0) {
+					start = _nodes[nd]._parent;
+					replace_child(nd, l ? l : r);
+				}
+				else {
+					compact_index succ = r;
+					while (_nodes[succ]._left) {
+						succ = _nodes[succ]._left;
+					}
+					if (_nodes[succ]._parent != nd) {
+						start = _nodes[succ]._parent;
+						replace_child(succ, _nodes[succ]._right);
+						_nodes[succ]._right = r;
+						_nodes[r]._parent = succ;
+					}
+					else {
+						start = succ;
+					}
+					replace_child(nd, succ);
+					_nodes[succ]._left = l;
+					_nodes[l]._parent = succ;
+				}
+				free_node(nd);
+				rebalance_up(start, false);
+			};
+
+	};
+
+	/******************************************/
+	/*****      NON-MEMBER FUNCTIONS      *****/
+	/******************************************/
+
+
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator==( const ft::compact_map<Key,T,Compare,Alloc>& lhs, const ft::compact_map<Key,T,Compare,Alloc>& rhs ) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator!=( const ft::compact_map<Key,T,Compare,Alloc>& lhs, const ft::compact_map<Key,T,Compare,Alloc>& rhs ) {
+		return !(lhs == rhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<( const ft::compact_map<Key,T,Compare,Alloc>& lhs, const ft::compact_map<Key,T,Compare,Alloc>& rhs ) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<=( const ft::compact_map<Key,T,Compare,Alloc>& lhs, const ft::compact_map<Key,T,Compare,Alloc>& rhs ) {
+		return !(rhs < lhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>( const ft::compact_map<Key,T,Compare,Alloc>& lhs, const ft::compact_map<Key,T,Compare,Alloc>& rhs ) {
+		return (rhs < lhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>=( const ft::compact_map<Key,T,Compare,Alloc>& lhs, const ft::compact_map<Key,T,Compare,Alloc>& rhs ) {
+		return !(lhs < rhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	void swap( ft::compact_map<Key,T,Compare,Alloc>& lhs, ft::compact_map<Key,T,Compare,Alloc>& rhs ) {
+		lhs.swap(rhs);
+	};
+
+}; // namespace ft
+
+#endif /*COMPACT_MAP_HPP*/
@@ -0,0 +1,190 @@
+#pragma once
+
+#ifndef COMPACT_MAP_ITERATORS_HPP
+# define COMPACT_MAP_ITERATORS_HPP
+
+namespace ft {
+
+	/*
+	**	Compact_node
+	**
+	**	Node of ft::compact_map. The nodes live in one array and link to each other
+	**	by their 32-bit index in it; index 0 is the header of the tree and also
+	**	stands for "no node". A free slot has a height of 0 and chains the next
+	**	free slot through _left.
+	*/
+
+	typedef unsigned int	compact_index;
+
+	template< typename T >
+	struct compact_node
+	{
+		T							_data;
+		compact_index	_left;
+		compact_index	_right;
+		compact_index	_parent;
+		unsigned char	_height;
+	};
+
+	/*
+	**	Compact_map_iterators
+	**
+	**	Bidirectional iterator over a compact_map. It holds the index of its node and
+	**	the address of the array pointer of the map, so it stays valid when the
+	**	array is reallocated to grow.
+	*/
+
+	template < typename Node, typename T >
+		class compact_map_iterators {
+
+			public:
+
+				/**********************************/
+				/*****      MEMBER TYPES      *****/
+				/**********************************/
+
+				typedef T                               	value_type;
+				typedef T*                              	pointer;
+				typedef T&                              	reference;
+				typedef std::ptrdiff_t                  	difference_type;
+				typedef std::size_t                     	size_type;
+				typedef std::bidirectional_iterator_tag 	iterator_category;
+
+			private:
+
+				/**************************************/
+				/*****      MEMBER ATTRIBUTES     *****/
+				/**************************************/
+
+				Node * const	*_nodes;
+				compact_index	_index;
+
+			public:
+
+				/**************************************/
+				/*****      MEMBER FUNCTIONS      *****/
+				/**************************************/
+
+				compact_map_iterators()
+					: _nodes(NULL), _index(0) {
+				};
+
+				compact_map_iterators( Node * const *nodes, compact_index index )
+					: _nodes(nodes), _index(index) {
+				};
+
+				compact_map_iterators( const compact_map_iterators &other )
+					: _nodes(other._nodes), _index(other._index) {
+				};
+
+				virtual ~compact_map_iterators() {
+				};
+
+				compact_map_iterators &operator=( const compact_map_iterators &other ) {
+					if ( this != &other ) {
+						_nodes = other._nodes;
+						_index = other._index;
+					}
+					return *this;
+				};
+
+
+
+				/************************************/
+				/*****      ELEMENT ACCESS      *****/
+				/************************************/
+
+
+
+				operator compact_map_iterators<Node, T const>() const {
+					return compact_map_iterators<Node, T const>(_nodes, _index);
+				};
+
+				reference operator*() const {
+					return (*_nodes)[_index]._data;
+				};
+
+				pointer operator->() const {
+					return &(*_nodes)[_index]._data;
+				};
+
+
+
+				/*******************************/
+				/*****      OPERATORS      *****/
+				/*******************************/
+
+
+
+				// In-order successor; the header (end) follows the maximum
+				compact_map_iterators& operator++() {
+					Node *n = *_nodes;
+					if (n[_index]._right) {
+						_index = n[_index]._right;
+						while (n[_index]._left) {
+							_index = n[_index]._left;
+						}
+						return *this;
+					}
+					compact_index parent = n[_index]._parent;
+					while (parent && _index == n[parent]._right) {
+						_index = parent;
+						parent = n[parent]._parent;
+					}
+					_index = parent;
+					return *this;
+				};
+
+				compact_map_iterators operator++(int) {
+					compact_map_iterators temp = *this;
+					++(*this);
+					return temp;
+				};
+
+				// In-order predecessor; the header keeps the maximum in _right
+				compact_map_iterators& operator--() {
+					Node *n = *_nodes;
+					if (_index == 0) {
+						_index = n[0]._right;
+						return *this;
+					}
+					if (n[_index]._left) {
+						_index = n[_index]._left;
+						while (n[_index]._right) {
+							_index = n[_index]._right;
+						}
+						return *this;
+					}
+					compact_index parent = n[_index]._parent;
+					while (parent && _index == n[parent]._left) {
+						_index = parent;
+						parent = n[parent]._parent;
+					}
+					_index = parent;
+					return *this;
+				};
+
+				compact_map_iterators operator--(int) {
+					compact_map_iterators temp = *this;
+					--(*this);
+					return temp;
+				};
+
+				compact_index	getindex() const {
+					return _index;
+				};
+
+				friend bool operator==( const compact_map_iterators& lhs, const compact_map_iterators& rhs ) {
+					return lhs._index == rhs._index && lhs._nodes == rhs._nodes;
+				};
+
+				friend bool operator!=( const compact_map_iterators& lhs, const compact_map_iterators& rhs ) {
+					return !(lhs == rhs);
+				};
+
+		}; // compact_map_iterators
+
+}; // namespace ft
+
+
+#endif /* COMPACT_MAP_ITERATORS_HPP */
@@ -0,0 +1,395 @@
+#pragma once
+
+#ifndef CONCURRENT_MAP_HPP
+# define CONCURRENT_MAP_HPP
+
+# include "utils.hpp"
+# include <new>
+# include <stdexcept>
+# include <pthread.h>
+
+namespace ft {
+
+	/*
+	**	Partitions
+	**
+	**	Choose the shard of a key among shards. hash_partition spreads the keys
+	**	evenly whatever their order; range_partition keeps contiguous key ranges
+	**	together, so that for_each visits the keys in order.
+	*/
+
+	template < typename Key, typename Hash = ft::hash<Key> >
+	struct hash_partition
+	{
+		Hash	hasher;
+
+		std::size_t operator()( const Key& key, std::size_t shards ) const {
+			return hasher(key) % shards;
+		};
+	};
+
+	/*
+	**	Range_partition
+	**
+	**	Built from the shards - 1 boundaries, in increasing order: shard i holds the keys
+	**	in [bounds[i - 1], bounds[i]), the first and the last shards being open-ended.
+	*/
+
+	template < typename Key, typename Compare = std::less<Key> >
+	struct range_partition
+	{
+		ft::vector<Key>	bounds;
+		Compare					comp;
+
+		range_partition() {
+		};
+
+		template< class InputIt >
+		range_partition( InputIt first, InputIt last, const Compare& c = Compare() )
+			: bounds(first, last), comp(c) {
+		};
+
+		std::size_t operator()( const Key& key, std::size_t shards ) const {
+			std::size_t lo = 0;
+			std::size_t hi = bounds.size();
+			while (lo < hi) {
+				std::size_t mid = (lo + hi) / 2;
+				if (comp(key, bounds[mid])) {
+					hi = mid;
+				}
+				else {
+					lo = mid + 1;
+				}
+			}
+			return lo < shards ? lo : shards - 1;
+		};
+	};
+
+	/*
+	**	Concurrent_map
+	**
+	**	Thread-safe map made of a fixed number of ft::map shards, each one protected by
+	**	its own reader/writer lock: readers of a shard run in parallel, and threads
+	**	working on different shards never wait for each other.
+	**	No iterator or reference ever leaves a shard lock, so lookups copy the mapped
+	**	value out and modifications go through upsert() callbacks. for_each() holds the
+	**	lock of one shard at a time: each shard is seen in a consistent state, but the
+	**	shards are not all seen at the same instant.
+	*/
+
+	template < typename Key, typename T, typename Compare = std::less<Key>,
+		typename Allocator = std::allocator<ft::pair<const Key, T> >, typename Partition = ft::hash_partition<Key> >
+	class concurrent_map
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef T																														mapped_type;
+			typedef typename ft::pair<const Key, T>															value_type;
+
+			typedef std::size_t																									size_type;
+			typedef std::ptrdiff_t																							difference_type;
+
+			typedef Compare																											key_compare;
+			typedef Allocator																										allocator_type;
+			typedef Partition																										partition_type;
+			typedef ft::map<Key, T, Compare, Allocator>													shard_map;
+
+		private:
+
+			/*
+			**	Shard
+			**
+			**	The padding keeps the locks of neighbouring shards on different cache lines.
+			*/
+
+			struct shard
+			{
+				pthread_rwlock_t	lock;
+				shard_map					map;
+				char							pad[64];
+
+				shard( const Compare& comp, const Allocator& alloc )
+					: map(comp, alloc) {
+					if (pthread_rwlock_init(&lock, NULL) != 0) {
+						throw std::runtime_error("concurrent_map: cannot create a shard lock");
+					}
+				};
+
+				~shard() {
+					pthread_rwlock_destroy(&lock);
+				};
+			};
+
+			typedef typename allocator_type::template rebind<shard>::other			shard_alloc;
+
+			// Holds the lock of a shard for the lifetime of the guard
+			class shard_guard
+			{
+				private:
+
+					pthread_rwlock_t	*_lock;
+
+					shard_guard( const shard_guard& );
+					shard_guard& operator=( const shard_guard& );
+
+				public:
+
+					shard_guard( pthread_rwlock_t *lock, bool write )
+						: _lock(lock) {
+						if (write) {
+							pthread_rwlock_wrlock(_lock);
+						}
+						else {
+							pthread_rwlock_rdlock(_lock);
+						}
+					};
+
+					~shard_guard() {
+						pthread_rwlock_unlock(_lock);
+					};
+			};
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			shard_alloc			_allocShard;
+			shard						*_shards;
+			size_type				_count;
+			Partition				_partition;
+
+			concurrent_map( const concurrent_map& );
+			concurrent_map& operator=( const concurrent_map& );
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+
+
+			/*
+			**	Constructor
+			**
+			**	Constructs an empty container split into shards ft::map.
+			**	A concurrent_map owns locks and cannot be copied.
+			*/
+
+			explicit concurrent_map( size_type shards = 16, const Partition& partition = Partition(),
+				const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _allocShard(alloc), _shards(NULL), _count(0), _partition(partition) {
+				if (shards == 0) {
+					throw std::invalid_argument("concurrent_map: at least one shard is needed");
+				}
+				_shards = _allocShard.allocate(shards);
+				try {
+					for (; _count < shards; _count++) {
+						new (_shards + _count) shard(comp, alloc);
+					}
+				}
+				catch (...) {
+					destroy_shards(shards);
+					throw;
+				}
+			};
+
+
+			/*
+			**	Destructor
+			*/
+
+			~concurrent_map() {
+				destroy_shards(_count);
+			};
+
+
+
+			/*******************************/
+			/*****      CAPACITY      *****/
+			/*******************************/
+
+
+
+			/*
+			**	Size / Empty
+			**
+			**	Sum over the shards, each one read under its lock. Under concurrent
+			**	modifications the result is only a momentary estimate.
+			*/
+
+			size_type	size() const {
+				size_type total = 0;
+				for (size_type i = 0; i < _count; i++) {
+					shard_guard guard(&_shards[i].lock, false);
+					total += _shards[i].map.size();
+				}
+				return total;
+			};
+
+			bool	empty() const {
+				return size() == 0;
+			};
+
+			size_type	shard_count() const {
+				return _count;
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			/*
+			**	Insert
+			**
+			**	Inserts value if the container doesn't already contain an element with an
+			**	equivalent key. Returns true if the insertion took place.
+			*/
+
+			bool	insert( const value_type& value ) {
+				shard& s = shard_of(value.first);
+				shard_guard guard(&s.lock, true);
+				return s.map.insert(value).second;
+			};
+
+
+			/*
+			**	Upsert
+			**
+			**	Inserts value_type(key, value) if key is absent; otherwise calls fn on the
+			**	mapped value of key, under the write lock of its shard. fn must not call
+			**	back into the container. Returns true if the insertion took place.
+			*/
+
+			template< class Function >
+			bool	upsert( const Key& key, const T& value, Function fn ) {
+				shard& s = shard_of(key);
+				shard_guard guard(&s.lock, true);
+				ft::pair<typename shard_map::iterator, bool> ret = s.map.insert(value_type(key, value));
+				if (!ret.second) {
+					fn(ret.first->second);
+				}
+				return ret.second;
+			};
+
+
+			/*
+			**	Erase
+			**
+			**	Removes the element with key equivalent to key, if any. Returns the number of elements removed.
+			*/
+
+			size_type	erase( const Key& key ) {
+				shard& s = shard_of(key);
+				shard_guard guard(&s.lock, true);
+				return s.map.erase(key);
+			};
+
+
+			/*
+			**	Clear
+			**
+			**	Erases all elements, one shard after the other.
+			*/
+
+			void	clear() {
+				for (size_type i = 0; i < _count; i++) {
+					shard_guard guard(&_shards[i].lock, true);
+					_shards[i].map.clear();
+				}
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			/*
+			**	Find
+			**
+			**	Copies the mapped value of key into value and returns true, or returns false
+			**	and leaves value untouched if key is absent.
+			*/
+
+			bool	find( const Key& key, T& value ) const {
+				shard& s = shard_of(key);
+				shard_guard guard(&s.lock, false);
+				typename shard_map::const_iterator it = s.map.find(key);
+				if (it == s.map.end()) {
+					return false;
+				}
+				value = it->second;
+				return true;
+			};
+
+			size_type	count( const Key& key ) const {
+				shard& s = shard_of(key);
+				shard_guard guard(&s.lock, false);
+				return s.map.count(key);
+			};
+
+
+			/*
+			**	For_each
+			**
+			**	Calls fn on every element, shard by shard, under the read lock of the shard.
+			**	fn must not call back into the container.
+			*/
+
+			template< class Function >
+			void	for_each( Function fn ) const {
+				for (size_type i = 0; i < _count; i++) {
+					shard_guard guard(&_shards[i].lock, false);
+					typename shard_map::const_iterator it = _shards[i].map.begin();
+					for (; it != _shards[i].map.end(); ++it) {
+						fn(*it);
+					}
+				}
+			};
+
+
+
+			/*******************************/
+			/*****      OBSERVERS      *****/
+			/*******************************/
+
+
+
+			partition_type	partition() const {
+				return _partition;
+			};
+
+		private:
+
+			shard&	shard_of( const Key& key ) const {
+				return _shards[_partition(key, _count)];
+			};
+
+			// Destroy the _count shards built and free the room of allocated ones
+			void	destroy_shards( size_type allocated ) {
+				while (_count > 0) {
+					_count--;
+					_shards[_count].~shard();
+				}
+				_allocShard.deallocate(_shards, allocated);
+				_shards = NULL;
+			};
+
+	};
+
+}; // namespace ft
+
+#endif /* CONCURRENT_MAP_HPP */
@@ -0,0 +1,167 @@
+#pragma once
+
+#ifndef HASH_HPP
+# define HASH_HPP
+
+# include <string>
+# include <cstring>
+
+/*
+**	Hash
+**
+**	C++98 has no std::hash, so the hashed containers use ft::hash. Each specialization
+**	provides operator() returning a std::size_t for the type.
+**	Integers go through a 64-bit finalizer rather than the identity so that all
+**	the bits of the result depend on all the bits of the key: the containers use
+**	both the low bits (to pick a bucket or a shard) and the high bits.
+**	Strings use 64-bit FNV-1a followed by the same finalizer.
+*/
+
+namespace ft {
+
+	// Finalizer of MurmurHash3
+	inline std::size_t hash_mix( unsigned long long x ) {
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccdULL;
+		x ^= x >> 33;
+		x *= 0xc4ceb9fe1a85ec53ULL;
+		x ^= x >> 33;
+		return static_cast<std::size_t>(x);
+	};
+
+	inline std::size_t hash_bytes( const void *data, std::size_t len ) {
+		const unsigned char *p = static_cast<const unsigned char *>(data);
+		unsigned long long h = 0xcbf29ce484222325ULL;
+		for (std::size_t i = 0; i < len; i++) {
+			h ^= p[i];
+			h *= 0x100000001b3ULL;
+		}
+		return hash_mix(h);
+	};
+
+	template < class T >
+	struct hash;
+
+	template < >
+	struct hash<bool> {
+		std::size_t operator()( bool value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<char> {
+		std::size_t operator()( char value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<signed char> {
+		std::size_t operator()( signed char value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<unsigned char> {
+		std::size_t operator()( unsigned char value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<wchar_t> {
+		std::size_t operator()( wchar_t value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<short> {
+		std::size_t operator()( short value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<unsigned short> {
+		std::size_t operator()( unsigned short value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<int> {
+		std::size_t operator()( int value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<unsigned int> {
+		std::size_t operator()( unsigned int value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<long> {
+		std::size_t operator()( long value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<unsigned long> {
+		std::size_t operator()( unsigned long value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<long long> {
+		std::size_t operator()( long long value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	template < >
+	struct hash<unsigned long long> {
+		std::size_t operator()( unsigned long long value ) const {
+			return hash_mix(value);
+		};
+	};
+
+	// 0.0 and -0.0 compare equal, so they must hash alike
+	template < >
+	struct hash<float> {
+		std::size_t operator()( float value ) const {
+			return value == 0.0f ? hash_mix(0) : hash_bytes(&value, sizeof(value));
+		};
+	};
+
+	template < >
+	struct hash<double> {
+		std::size_t operator()( double value ) const {
+			return value == 0.0 ? hash_mix(0) : hash_bytes(&value, sizeof(value));
+		};
+	};
+
+	template < >
+	struct hash<std::string> {
+		std::size_t operator()( const std::string& value ) const {
+			return hash_bytes(value.data(), value.size());
+		};
+	};
+
+	template < class T >
+	struct hash<T *> {
+		std::size_t operator()( T *value ) const {
+			return hash_mix(reinterpret_cast<unsigned long long>(value));
+		};
+	};
+
+}; // namespace ft
+
+#endif /* HASH_HPP */
@@ -0,0 +1,428 @@
+#pragma once
+
+#ifndef INCREMENTAL_VECTOR_HPP
+# define INCREMENTAL_VECTOR_HPP
+
+# include <stdexcept>
+# include "utils.hpp"
+
+/*
+**	Migration step
+**
+**	Elements an incremental_vector moves to its new storage on every push_back
+**	while it migrates, 2 by default: override it with -D FT_INCREMENTAL_VECTOR_STEP=n.
+**	Any step of 1 or more ends the migration before the next growth.
+*/
+
+# ifndef FT_INCREMENTAL_VECTOR_STEP
+#  define FT_INCREMENTAL_VECTOR_STEP 2
+# endif
+
+namespace ft {
+
+	/*
+	**	Incremental_vector
+	**
+	**	Vector whose growth never copies all the elements at once. When push_back
+	**	finds it full, the vector allocates twice the capacity but leaves the
+	**	elements where they are: each push_back then moves FT_INCREMENTAL_VECTOR_STEP
+	**	of them to the new storage, and the old one is freed once empty. A push_back
+	**	thus costs one allocation and a few copies at worst, where ft::vector copies
+	**	every element on growth, which stalls for a long time on large vectors.
+	**	During a migration element i is in the old storage if _moved <= i < _old_size,
+	**	in the new one otherwise, so the elements are not contiguous: there is no
+	**	data(), the iterators hold an index and element access costs one more
+	**	comparison. reserve() ends any migration and reallocates at once, like
+	**	ft::vector. Growing invalidates no iterator, references are invalidated
+	**	when their element moves.
+	*/
+
+	template < class T, class Allocator = std::allocator<T> >
+	class incremental_vector
+	{
+		public:
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+			typedef T																										value_type;
+			typedef Allocator																						allocator_type;
+
+			typedef std::size_t																					size_type;
+			typedef std::ptrdiff_t																			difference_type;
+
+			typedef typename allocator_type::reference									reference;
+			typedef typename allocator_type::const_reference						const_reference;
+			typedef typename allocator_type::pointer										pointer;
+			typedef typename allocator_type::const_pointer							const_pointer;
+
+			typedef incremental_vector_iterators<incremental_vector, T>				iterator;
+			typedef incremental_vector_iterators<incremental_vector, const T>	const_iterator;
+			typedef ft::reverse_iterator<iterator>											reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>								const_reverse_iterator;
+
+		private:
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			allocator_type	_alloc;
+			pointer					_data;
+			size_type				_capacity;
+			size_type				_size;
+			pointer					_old;
+			size_type				_old_capacity;
+			size_type				_old_size;
+			size_type				_moved;
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+
+
+			/*
+			**	Constructors
+			**
+			**		1) Constructs an empty container.
+			**		2) Constructs the container with count copies of value.
+			**		3) Constructs the container with the contents of the range [first, last).
+			**		4) Copy constructor. The copy is not migrating.
+			*/
+
+			explicit incremental_vector( const allocator_type& alloc = allocator_type() )
+				: _alloc(alloc), _data(NULL), _capacity(0), _size(0), _old(NULL), _old_capacity(0), _old_size(0), _moved(0) {
+			};
+
+			explicit incremental_vector( size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type() )
+				: _alloc(alloc), _data(NULL), _capacity(0), _size(0), _old(NULL), _old_capacity(0), _old_size(0), _moved(0) {
+				reserve(count);
+				for (size_type i = 0; i < count; i++) {
+					push_back(value);
+				}
+			};
+
+			template< class InputIt >
+			incremental_vector( InputIt first, InputIt last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!ft::is_integral<InputIt>::value>::type* = NULL )
+				: _alloc(alloc), _data(NULL), _capacity(0), _size(0), _old(NULL), _old_capacity(0), _old_size(0), _moved(0) {
+				for (; first != last; ++first) {
+					push_back(*first);
+				}
+			};
+
+			incremental_vector( const incremental_vector& other )
+				: _alloc(other._alloc), _data(NULL), _capacity(0), _size(0), _old(NULL), _old_capacity(0), _old_size(0), _moved(0) {
+				reserve(other._size);
+				for (size_type i = 0; i < other._size; i++) {
+					push_back(*other.slot(i));
+				}
+			};
+
+			~incremental_vector() {
+				clear();
+				if (_data) {
+					_alloc.deallocate(_data, _capacity);
+				}
+			};
+
+			incremental_vector& operator=( const incremental_vector& other ) {
+				if (this != &other) {
+					incremental_vector copy(other);
+					swap(copy);
+				}
+				return *this;
+			};
+
+			allocator_type	get_allocator() const {
+				return _alloc;
+			};
+
+
+
+			/************************************/
+			/*****      ELEMENT ACCESS      *****/
+			/************************************/
+
+
+
+			reference at( size_type pos ) {
+				if (pos >= _size) {
+					throw std::out_of_range("incremental_vector::at");
+				}
+				return *slot(pos);
+			};
+
+			const_reference at( size_type pos ) const {
+				if (pos >= _size) {
+					throw std::out_of_range("incremental_vector::at");
+				}
+				return *slot(pos);
+			};
+
+			reference operator[]( size_type pos ) {
+				return *slot(pos);
+			};
+
+			const_reference operator[]( size_type pos ) const {
+				return *slot(pos);
+			};
+
+			reference front() {
+				return *slot(0);
+			};
+
+			const_reference front() const {
+				return *slot(0);
+			};
+
+			reference back() {
+				return *slot(_size - 1);
+			};
+
+			const_reference back() const {
+				return *slot(_size - 1);
+			};
+
+			// Address of element pos, in the old storage or the new one
+			pointer	slot( size_type pos ) const {
+				return (pos < _old_size && pos >= _moved) ? _old + pos : _data + pos;
+			};
+
+
+
+			/******************************/
+			/*****      ITERATOR      *****/
+			/******************************/
+
+
+
+			iterator begin() {
+				return iterator(this, 0);
+			};
+
+			const_iterator begin() const {
+				return const_iterator(this, 0);
+			};
+
+			iterator end() {
+				return iterator(this, _size);
+			};
+
+			const_iterator end() const {
+				return const_iterator(this, _size);
+			};
+
+			reverse_iterator rbegin() {
+				return reverse_iterator(end());
+			};
+
+			const_reverse_iterator rbegin() const {
+				return const_reverse_iterator(end());
+			};
+
+			reverse_iterator rend() {
+				return reverse_iterator(begin());
+			};
+
+			const_reverse_iterator rend() const {
+				return const_reverse_iterator(begin());
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return _size == 0;
+			};
+
+			size_type size() const {
+				return _size;
+			};
+
+			size_type max_size() const {
+				return _alloc.max_size();
+			};
+
+			size_type capacity() const {
+				return _capacity;
+			};
+
+			// Whether elements are still waiting in the old storage
+			bool migrating() const {
+				return _old != NULL;
+			};
+
+			void reserve( size_type new_cap ) {
+				if (new_cap > max_size()) {
+					throw std::length_error("incremental_vector::reserve");
+				}
+				if (new_cap <= _capacity) {
+					return;
+				}
+				finish_migration();
+				pointer tmp = _alloc.allocate(new_cap);
+				for (size_type i = 0; i < _size; i++) {
+					_alloc.construct(tmp + i, _data[i]);
+					_alloc.destroy(_data + i);
+				}
+				if (_data) {
+					_alloc.deallocate(_data, _capacity);
+				}
+				_data = tmp;
+				_capacity = new_cap;
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			void clear() {
+				while (_size) {
+					pop_back();
+				}
+			};
+
+			void push_back( const value_type& value ) {
+				if (_size == _capacity) {
+					grow();
+				}
+				_alloc.construct(_data + _size, value);
+				_size++;
+				if (_old) {
+					migrate(FT_INCREMENTAL_VECTOR_STEP);
+				}
+			};
+
+			void pop_back() {
+				_alloc.destroy(slot(_size - 1));
+				_size--;
+				if (_size < _old_size) {
+					_old_size = _size;
+					if (_moved >= _old_size) {
+						release_old();
+					}
+				}
+			};
+
+			void resize( size_type count, value_type value = value_type() ) {
+				while (_size > count) {
+					pop_back();
+				}
+				while (_size < count) {
+					push_back(value);
+				}
+			};
+
+			void swap( incremental_vector& other ) {
+				std::swap(_alloc, other._alloc);
+				std::swap(_data, other._data);
+				std::swap(_capacity, other._capacity);
+				std::swap(_size, other._size);
+				std::swap(_old, other._old);
+				std::swap(_old_capacity, other._old_capacity);
+				std::swap(_old_size, other._old_size);
+				std::swap(_moved, other._moved);
+			};
+
+		private:
+
+			// Twice the capacity; the elements stay in the old storage until they are moved.
+			// Nothing changes until the allocation succeeds, so a throwing allocator leaves the vector as it was.
+			void	grow() {
+				finish_migration();
+				size_type capacity = _capacity ? _capacity * 2 : 1;
+				pointer tmp = _alloc.allocate(capacity);
+				_old = _data;
+				_old_capacity = _capacity;
+				_old_size = _size;
+				_moved = 0;
+				_capacity = capacity;
+				_data = tmp;
+				if (_old_size == 0) {
+					release_old();
+				}
+			};
+
+			void	migrate( size_type n ) {
+				for (; n && _moved < _old_size; n--, _moved++) {
+					_alloc.construct(_data + _moved, _old[_moved]);
+					_alloc.destroy(_old + _moved);
+				}
+				if (_moved >= _old_size) {
+					release_old();
+				}
+			};
+
+			void	finish_migration() {
+				if (_old) {
+					migrate(_old_size - _moved);
+				}
+			};
+
+			void	release_old() {
+				if (_old) {
+					_alloc.deallocate(_old, _old_capacity);
+				}
+				_old = NULL;
+				_old_capacity = 0;
+				_old_size = 0;
+				_moved = 0;
+			};
+	};
+
+	/******************************************/
+	/*****      NON-MEMBER FUNCTIONS      *****/
+	/******************************************/
+
+	template< class T, class Alloc >
+	bool operator==( const incremental_vector<T, Alloc>& lhs, const incremental_vector<T, Alloc>& rhs ) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	};
+
+	template< class T, class Alloc >
+	bool operator!=( const incremental_vector<T, Alloc>& lhs, const incremental_vector<T, Alloc>& rhs ) {
+		return !(lhs == rhs);
+	};
+
+	template< class T, class Alloc >
+	bool operator<( const incremental_vector<T, Alloc>& lhs, const incremental_vector<T, Alloc>& rhs ) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	};
+
+	template< class T, class Alloc >
+	bool operator<=( const incremental_vector<T, Alloc>& lhs, const incremental_vector<T, Alloc>& rhs ) {
+		return !(rhs < lhs);
+	};
+
+	template< class T, class Alloc >
+	bool operator>( const incremental_vector<T, Alloc>& lhs, const incremental_vector<T, Alloc>& rhs ) {
+		return rhs < lhs;
+	};
+
+	template< class T, class Alloc >
+	bool operator>=( const incremental_vector<T, Alloc>& lhs, const incremental_vector<T, Alloc>& rhs ) {
+		return !(lhs < rhs);
+	};
+
+	template< class T, class Alloc >
+	void swap( incremental_vector<T, Alloc>& lhs, incremental_vector<T, Alloc>& rhs ) {
+		lhs.swap(rhs);
+	};
+
+}; // namespace ft
+
+#endif /* INCREMENTAL_VECTOR_HPP */
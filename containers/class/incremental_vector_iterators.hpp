@@ -0,0 +1,174 @@
+#pragma once
+
+#ifndef INCREMENTAL_VECTOR_ITERATORS_HPP
+# define INCREMENTAL_VECTOR_ITERATORS_HPP
+
+namespace ft {
+
+	/*
+	**	Incremental_vector_iterators
+	**
+	**	Random access iterator over an incremental_vector: the vector and an index,
+	**	since during a migration the elements live in two blocks of memory.
+	*/
+
+	template < typename Vector, typename T >
+		class incremental_vector_iterators {
+
+			public:
+
+				/**********************************/
+				/*****      MEMBER TYPES      *****/
+				/**********************************/
+
+				typedef T                               	value_type;
+				typedef T*                              	pointer;
+				typedef T&                              	reference;
+				typedef std::ptrdiff_t                  	difference_type;
+				typedef std::size_t                     	size_type;
+				typedef std::random_access_iterator_tag 	iterator_category;
+
+			private:
+
+				/**************************************/
+				/*****      MEMBER ATTRIBUTES     *****/
+				/**************************************/
+
+				const Vector		*_vec;
+				difference_type	_index;
+
+			public:
+
+				/**************************************/
+				/*****      MEMBER FUNCTIONS      *****/
+				/**************************************/
+
+				incremental_vector_iterators()
+					: _vec(NULL), _index(0) {
+				};
+
+				incremental_vector_iterators( const Vector *vec, difference_type index )
+					: _vec(vec), _index(index) {
+				};
+
+				incremental_vector_iterators( const incremental_vector_iterators &other )
+					: _vec(other._vec), _index(other._index) {
+				};
+
+				virtual ~incremental_vector_iterators() {
+				};
+
+				incremental_vector_iterators &operator=( const incremental_vector_iterators &other ) {
+					_vec = other._vec;
+					_index = other._index;
+					return *this;
+				};
+
+				incremental_vector_iterators &operator+=( difference_type n ) {
+					_index += n;
+					return *this;
+				};
+
+				incremental_vector_iterators &operator-=( difference_type n ) {
+					_index -= n;
+					return *this;
+				};
+
+
+
+				/************************************/
+				/*****      ELEMENT ACCESS      *****/
+				/************************************/
+
+
+
+				operator incremental_vector_iterators<Vector, T const>() const {
+					return incremental_vector_iterators<Vector, T const>(_vec, _index);
+				};
+
+				reference operator*() const {
+					return *_vec->slot(_index);
+				};
+
+				pointer operator->() const {
+					return _vec->slot(_index);
+				};
+
+				reference operator[]( difference_type n ) const {
+					return *_vec->slot(_index + n);
+				};
+
+
+
+				/*******************************/
+				/*****      OPERATORS      *****/
+				/*******************************/
+
+
+
+				incremental_vector_iterators& operator++() {
+					_index++;
+					return *this;
+				};
+
+				incremental_vector_iterators operator++(int) {
+					incremental_vector_iterators temp = *this;
+					_index++;
+					return temp;
+				};
+
+				incremental_vector_iterators& operator--() {
+					_index--;
+					return *this;
+				};
+
+				incremental_vector_iterators operator--(int) {
+					incremental_vector_iterators temp = *this;
+					_index--;
+					return temp;
+				};
+
+				incremental_vector_iterators operator+( difference_type n ) const {
+					return incremental_vector_iterators(_vec, _index + n);
+				};
+
+				incremental_vector_iterators operator-( difference_type n ) const {
+					return incremental_vector_iterators(_vec, _index - n);
+				};
+
+				difference_type operator-( const incremental_vector_iterators& other ) const {
+					return _index - other._index;
+				};
+
+				friend incremental_vector_iterators operator+( difference_type n, const incremental_vector_iterators& it ) {
+					return it + n;
+				};
+
+				friend bool operator==( const incremental_vector_iterators& lhs, const incremental_vector_iterators& rhs ) {
+					return lhs._index == rhs._index && lhs._vec == rhs._vec;
+				};
+
+				friend bool operator!=( const incremental_vector_iterators& lhs, const incremental_vector_iterators& rhs ) {
+					return !(lhs == rhs);
+				};
+
+				friend bool operator<( const incremental_vector_iterators& lhs, const incremental_vector_iterators& rhs ) {
+					return lhs._index < rhs._index;
+				};
+
+				friend bool operator>( const incremental_vector_iterators& lhs, const incremental_vector_iterators& rhs ) {
+					return rhs < lhs;
+				};
+
+				friend bool operator<=( const incremental_vector_iterators& lhs, const incremental_vector_iterators& rhs ) {
+					return !(rhs < lhs);
+				};
+
+				friend bool operator>=( const incremental_vector_iterators& lhs, const incremental_vector_iterators& rhs ) {
+					return !(lhs < rhs);
+				};
+	};
+
+}; // namespace ft
+
+#endif /* INCREMENTAL_VECTOR_ITERATORS_HPP */
@@ -0,0 +1,69 @@
+#pragma once
+
+#ifndef IS_TRANSPARENT_HPP
+# define IS_TRANSPARENT_HPP
+
+# include "enable_if.hpp"
+
+/*
+**	Is_transparent
+**
+**	Checks whether the comparator Compare declares a member type is_transparent.
+**	Provides the member constant value which is equal to true if it does, false otherwise.
+**	The sorted containers use it to enable their heterogeneous lookup overloads:
+**	find, count, lower_bound, upper_bound and equal_range then accept any type
+**	the comparator can compare with a key, without building a temporary key.
+*/
+
+namespace ft {
+
+	template < class Compare >
+	struct is_transparent {
+		private:
+
+			typedef char	yes;
+			typedef char	no[2];
+
+			template < class C >
+			static yes&	test( typename C::is_transparent * );
+
+			template < class C >
+			static no&	test( ... );
+
+		public:
+
+			static const bool value = sizeof(test<Compare>(0)) == sizeof(yes);
+	};
+
+	/*
+	**	Enable_if_transparent
+	**
+	**	Has a member typedef type, equal to T, if Compare is transparent.
+	**	K is the argument type of the lookup overload: depending on it delays the check
+	**	until the overload is considered, so that it is removed by SFINAE instead of
+	**	failing when the container is instantiated.
+	*/
+
+	template < class Compare, class K, class T >
+	struct enable_if_transparent : enable_if<is_transparent<Compare>::value, T> {
+	};
+
+	/*
+	**	Transparent_less
+	**
+	**	Transparent version of std::less: compares any two types with operator<.
+	**	ft::map<std::string, T, ft::transparent_less> can be searched with a const char *.
+	*/
+
+	struct transparent_less {
+		typedef void	is_transparent;
+
+		template < class T, class U >
+		bool operator()( const T& lhs, const U& rhs ) const {
+			return lhs < rhs;
+		};
+	};
+
+} // namespace ft
+
+#endif /* IS_TRANSPARENT_HPP */
@@ -0,0 +1,259 @@
+#pragma once
+
+#ifndef KEY_GENERATOR_HPP
+# define KEY_GENERATOR_HPP
+
+# include <vector>
+# include <string>
+# include <algorithm>
+# include <math.h>
+
+/*
+**	Zipf normalization
+**
+**	The first KEY_ZETA_EXACT terms of the sum are added one by one, the others are
+**	approximated by an integral. Override it with -D KEY_ZETA_EXACT=n.
+*/
+
+# ifndef KEY_ZETA_EXACT
+#  define KEY_ZETA_EXACT 1000000
+# endif
+
+namespace ft {
+
+	/*
+	**	Key_distribution
+	**
+	**		- key_uniform: every key of [0, range) equally likely.
+	**		- key_zipf: a few keys drawn most of the time, like the hot keys of a
+	**		 cache. The popular keys are scattered over the range, not the smallest ones.
+	**		- key_sorted, key_reverse_sorted: n distinct keys spread evenly over
+	**		 the range, in increasing or decreasing order.
+	**		- key_nearly_sorted: sorted, then a few keys swapped with a close neighbour.
+	**		- key_clustered: runs of consecutive keys around random points of the
+	**		 range, in random order.
+	**	Uniform, zipf and clustered keys may repeat.
+	*/
+
+	enum key_distribution
+	{
+		key_uniform,
+		key_zipf,
+		key_sorted,
+		key_reverse_sorted,
+		key_nearly_sorted,
+		key_clustered,
+		key_distribution_count
+	};
+
+	/*
+	**	Key_generator
+	**
+	**	Keys for the tests and benchmarks, from its own pseudo-random generator
+	**	(splitmix64) rather than rand(): the same seed gives the same keys on
+	**	every libc. The key size is the integer type asked for and the range of
+	**	its values, or the length of the strings. Like perf.hpp, it only uses the
+	**	standard containers.
+	**
+	**		ft::key_generator gen(42);
+	**		std::vector<int> keys = gen.integers<int>(ft::key_zipf, 100000, 1000000);
+	**		std::vector<std::string> names = gen.strings(1000, 8, 32);
+	*/
+
+	class key_generator
+	{
+		private:
+
+			unsigned long long	_state;
+			double							_zipf_skew;
+			std::size_t					_cluster_size;
+			std::size_t					_swap_percent;
+			// Sum of 1 / i^skew for i in [1, range], cached for the last range and skew
+			double							_zeta;
+			unsigned long long	_zeta_range;
+			double							_zeta_skew;
+
+			// Sum of 1 / i^skew for i in [1, range]: exact for the first KEY_ZETA_EXACT terms, the rest
+			// from the integral of 1 / x^skew with the trapezoid correction, so a 2^32 range costs no more
+			static double	zeta( unsigned long long range, double skew ) {
+				unsigned long long exact = range < KEY_ZETA_EXACT ? range : KEY_ZETA_EXACT;
+				double sum = 0;
+				for (unsigned long long i = 1; i <= exact; i++) {
+					sum += 1.0 / pow(static_cast<double>(i), skew);
+				}
+				if (range > exact) {
+					double a = static_cast<double>(exact);
+					double b = static_cast<double>(range);
+					sum += (pow(b, 1.0 - skew) - pow(a, 1.0 - skew)) / (1.0 - skew);
+					sum += 0.5 * (1.0 / pow(b, skew) - 1.0 / pow(a, skew));
+				}
+				return sum;
+			};
+
+			// Zipf rank in [0, range), after Gray et al., "Quickly generating billion-record synthetic databases"
+			unsigned long long	zipf_rank( unsigned long long range ) {
+				if (_zeta_range != range || _zeta_skew != _zipf_skew) {
+					_zeta = zeta(range, _zipf_skew);
+					_zeta_range = range;
+					_zeta_skew = _zipf_skew;
+				}
+				double zeta2 = 1.0 + 1.0 / pow(2.0, _zipf_skew);
+				double alpha = 1.0 / (1.0 - _zipf_skew);
+				double eta = (1.0 - pow(2.0 / range, 1.0 - _zipf_skew)) / (1.0 - zeta2 / _zeta);
+				double u = unit();
+				double uz = u * _zeta;
+				if (uz < 1.0 || range < 2) {
+					return 0;
+				}
+				if (uz < zeta2) {
+					return 1;
+				}
+				unsigned long long rank = static_cast<unsigned long long>(range * pow(eta * u - eta + 1.0, alpha));
+				return rank < range ? rank : range - 1;
+			};
+
+			// a * b % m without overflow, by doubling: a and b below m
+			static unsigned long long	mulmod( unsigned long long a, unsigned long long b, unsigned long long m ) {
+				unsigned long long result = 0;
+				for (; b; b >>= 1) {
+					if (b & 1) {
+						result = result >= m - a ? result - (m - a) : result + a;
+					}
+					a = a >= m - a ? a - (m - a) : a + a;
+				}
+				return result;
+			};
+
+			// Bijection of [0, range) that scatters the ranks, as range cannot be a multiple of this prime
+			static unsigned long long	scatter( unsigned long long rank, unsigned long long range ) {
+				return mulmod((rank + 1) % range, 2305843009213693951ULL % range, range);
+			};
+
+		public:
+
+			explicit key_generator( unsigned long long seed = 42 )
+				: _state(seed), _zipf_skew(0.99), _cluster_size(64), _swap_percent(5),
+				_zeta(0), _zeta_range(0), _zeta_skew(0) {
+			};
+
+			void	seed( unsigned long long seed ) {
+				_state = seed;
+			};
+
+			// Between 0 and 1 excluded: the higher, the more the hot keys are drawn
+			void	set_zipf_skew( double skew ) {
+				_zipf_skew = skew;
+			};
+
+			void	set_cluster_size( std::size_t size ) {
+				_cluster_size = size ? size : 1;
+			};
+
+			// Percentage of the keys of key_nearly_sorted out of place
+			void	set_swap_percent( std::size_t percent ) {
+				_swap_percent = percent;
+			};
+
+			unsigned long long	next() {
+				unsigned long long z = (_state += 0x9e3779b97f4a7c15ULL);
+				z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+				z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+				return z ^ (z >> 31);
+			};
+
+			// In [0, n), n > 0
+			unsigned long long	below( unsigned long long n ) {
+				return next() % n;
+			};
+
+			// In [0, 1)
+			double	unit() {
+				return (next() >> 11) * (1.0 / 9007199254740992.0);
+			};
+
+			/*
+			**	Integers
+			**
+			**	n keys of the distribution, in [0, range): range must hold in T.
+			**	The sorted distributions need range >= n for their keys to be distinct,
+			**	and n below 2^32. Zipf handles any range: past KEY_ZETA_EXACT keys, its
+			**	normalization constant is approximated, far within 1e-9 of the exact sum.
+			*/
+
+			template < class T >
+			std::vector<T>	integers( key_distribution distribution, std::size_t n, unsigned long long range ) {
+				if (n == 0 || range == 0) {
+					return std::vector<T>();
+				}
+				std::vector<T> keys(n);
+				std::size_t cluster = _cluster_size;
+				unsigned long long base = 0;
+				switch (distribution) {
+					case key_zipf:
+						for (std::size_t i = 0; i < n; i++) {
+							keys[i] = static_cast<T>(scatter(zipf_rank(range), range));
+						}
+						break;
+					case key_sorted:
+					case key_reverse_sorted:
+					case key_nearly_sorted:
+						// i * range / n, split so that no product exceeds n * n
+						for (std::size_t i = 0; i < n; i++) {
+							keys[i] = static_cast<T>(i * (range / n) + i * (range % n) / n);
+						}
+						if (distribution == key_reverse_sorted) {
+							std::reverse(keys.begin(), keys.end());
+						}
+						else if (distribution == key_nearly_sorted) {
+							for (std::size_t s = 0; s < n * _swap_percent / 200; s++) {
+								std::size_t i = below(n);
+								std::size_t j = i + below(16) + 1;
+								if (j < n) {
+									std::swap(keys[i], keys[j]);
+								}
+							}
+						}
+						break;
+					case key_clustered:
+						for (std::size_t i = 0; i < n; i++) {
+							if (i % cluster == 0) {
+								base = below(range);
+							}
+							keys[i] = static_cast<T>((base + i % cluster) % range);
+						}
+						for (std::size_t i = n - 1; i > 0; i--) {
+							std::swap(keys[i], keys[below(i + 1)]);
+						}
+						break;
+					default:
+						for (std::size_t i = 0; i < n; i++) {
+							keys[i] = static_cast<T>(below(range));
+						}
+						break;
+				}
+				return keys;
+			};
+
+			// n random strings of letters and digits, of length in [min_length, max_length]
+			std::vector<std::string>	strings( std::size_t n, std::size_t min_length, std::size_t max_length ) {
+				static const char	alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+				std::vector<std::string> keys(n);
+				for (std::size_t i = 0; i < n; i++) {
+					std::size_t length = min_length + (max_length > min_length ? below(max_length - min_length + 1) : 0);
+					keys[i].resize(length);
+					for (std::size_t c = 0; c < length; c++) {
+						keys[i][c] = alphabet[below(sizeof(alphabet) - 1)];
+					}
+				}
+				return keys;
+			};
+
+			static const char	*name( key_distribution distribution ) {
+				static const char *names[key_distribution_count] = { "uniform", "zipf", "sorted", "reverse", "nearly_sorted", "clustered" };
+				return distribution < key_distribution_count ? names[distribution] : "unknown";
+			};
+	};
+
+}; // namespace ft
+
+#endif /* KEY_GENERATOR_HPP */
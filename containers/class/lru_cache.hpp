@@ -0,0 +1,382 @@
+#pragma once
+
+#ifndef LRU_CACHE_HPP
+# define LRU_CACHE_HPP
+
+# include "utils.hpp"
+# include <stdexcept>
+
+namespace ft {
+
+	/*
+	**	Monotonic_clock
+	**
+	**	Default clock of lru_cache: nanoseconds from CLOCK_MONOTONIC. A clock is any
+	**	type with a static now() returning nanoseconds that never go backwards.
+	*/
+
+	struct monotonic_clock
+	{
+		static long long now() {
+			struct timespec ts;
+			clock_gettime(CLOCK_MONOTONIC, &ts);
+			return static_cast<long long>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+		};
+	};
+
+	struct lru_cache_stats
+	{
+		std::size_t	hits;
+		std::size_t	misses;
+		std::size_t	evictions;
+		std::size_t	expirations;
+	};
+
+	/*
+	**	Lru_entry
+	**
+	**	Mapped value of the map of an lru_cache. Besides the value it holds the links
+	**	of two intrusive lists through the nodes of the map: recency order and
+	**	expiry order. The nodes of ft::map never move, so the links stay valid until
+	**	the element is erased, and an entry costs nothing but its tree node. A node
+	**	is also an iterator of the map, which erases it without searching its key.
+	*/
+
+	template< typename Key, typename T >
+	struct lru_entry
+	{
+		typedef ft::pair<const Key, lru_entry>	element;
+		typedef tree_node<element>							node;
+
+		T						_value;
+		long long		_expires;
+		node				*_newer;
+		node				*_older;
+		node				*_later;
+		node				*_earlier;
+
+		lru_entry()
+			: _value(), _expires(0), _newer(NULL), _older(NULL), _later(NULL), _earlier(NULL) {
+		};
+
+		lru_entry( const T& value, long long expires )
+			: _value(value), _expires(expires), _newer(NULL), _older(NULL), _later(NULL), _earlier(NULL) {
+		};
+	};
+
+	/*
+	**	Lru_cache
+	**
+	**	Key-value cache holding at most capacity elements on an ft::map.
+	**		- get() and put() move the element to the front of the recency list in O(1);
+	**		 inserting into a full cache evicts the least recently used element.
+	**		- With a ttl (nanoseconds, 0 for none), an element expires ttl after its last
+	**		 put(). Every element lives for the same ttl, so the expiry list is ordered
+	**		 by the time of the puts: expire() removes its expired prefix and stops at
+	**		 the first live element. put() calls it first.
+	**		- Evictions, expirations and get() of an expired key erase the element
+	**		 through its node: no second lookup, only the rebalancing of the tree.
+	**		- stats() counts hits, misses, evictions and expirations.
+	**	Clock provides the time, see monotonic_clock.
+	*/
+
+	template < typename Key, typename T, typename Compare = std::less<Key>,
+		typename Allocator = std::allocator<ft::pair<const Key, lru_entry<Key, T> > >, typename Clock = monotonic_clock >
+	class lru_cache
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef T																														mapped_type;
+			typedef std::size_t																									size_type;
+			typedef Compare																											key_compare;
+			typedef Allocator																										allocator_type;
+			typedef Clock																												clock_type;
+
+		private:
+
+			typedef lru_entry<Key, T>																						entry;
+			typedef typename entry::node																				node;
+			typedef ft::map<Key, entry, Compare, Allocator>											map_type;
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			map_type				_map;
+			size_type				_capacity;
+			long long				_ttl;
+			node						*_newest;
+			node						*_oldest;
+			node						*_firstExpiry;
+			node						*_lastExpiry;
+			lru_cache_stats	_stats;
+
+			// The links point into the map of this cache, a copy would share them
+			lru_cache( const lru_cache& );
+			lru_cache& operator=( const lru_cache& );
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+			explicit lru_cache( size_type capacity, long long ttl = 0, const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _map(comp, alloc), _capacity(capacity), _ttl(ttl), _newest(NULL), _oldest(NULL), _firstExpiry(NULL), _lastExpiry(NULL) {
+				if (capacity == 0) {
+					throw std::invalid_argument("lru_cache: the capacity must not be 0");
+				}
+				reset_stats();
+			};
+
+			~lru_cache() {
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return _map.empty();
+			};
+
+			size_type	size() const {
+				return _map.size();
+			};
+
+			size_type	capacity() const {
+				return _capacity;
+			};
+
+			long long	ttl() const {
+				return _ttl;
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			/*
+			**	Get
+			**
+			**	Returns the value of key and makes it the most recently used element,
+			**	or NULL when key is absent or expired (an expired element is removed).
+			**	The pointer stays valid until the element is erased or evicted.
+			*/
+
+			T	*get( const Key& key ) {
+				typename map_type::iterator it = _map.find(key);
+				if (it == _map.end()) {
+					_stats.misses++;
+					return NULL;
+				}
+				node *e = it.getnode();
+				if (_ttl && e->_data.second._expires <= Clock::now()) {
+					_stats.misses++;
+					_stats.expirations++;
+					remove(e);
+					return NULL;
+				}
+				_stats.hits++;
+				unlink_recency(e);
+				push_recency(e);
+				return &e->_data.second._value;
+			};
+
+			// Same as get(), without touching the recency order nor the counters
+			const T	*peek( const Key& key ) const {
+				typename map_type::const_iterator it = _map.find(key);
+				if (it == _map.end() || (_ttl && it->second._expires <= Clock::now())) {
+					return NULL;
+				}
+				return &it->second._value;
+			};
+
+			bool contains( const Key& key ) const {
+				return peek(key) != NULL;
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			/*
+			**	Put
+			**
+			**	Inserts or replaces the value of key, makes it the most recently used
+			**	element and restarts its ttl. Expired elements are removed first; then,
+			**	if the cache is full, the least recently used element is evicted.
+			*/
+
+			void put( const Key& key, const T& value ) {
+				long long now = _ttl ? Clock::now() : 0;
+				if (_ttl) {
+					expire_before(now);
+				}
+				ft::pair<typename map_type::iterator, bool> ins = _map.insert(ft::make_pair(key, entry(value, now + _ttl)));
+				node *e = ins.first.getnode();
+				if (!ins.second) {
+					e->_data.second._value = value;
+					e->_data.second._expires = now + _ttl;
+					unlink_recency(e);
+					unlink_expiry(e);
+				}
+				push_recency(e);
+				push_expiry(e);
+				if (_map.size() > _capacity) {
+					_stats.evictions++;
+					remove(_oldest);
+				}
+			};
+
+			bool erase( const Key& key ) {
+				typename map_type::iterator it = _map.find(key);
+				if (it == _map.end()) {
+					return false;
+				}
+				remove(it.getnode());
+				return true;
+			};
+
+			// Removes the expired elements and returns how many
+			size_type expire() {
+				return _ttl ? expire_before(Clock::now()) : 0;
+			};
+
+			void clear() {
+				_map.clear();
+				_newest = NULL;
+				_oldest = NULL;
+				_firstExpiry = NULL;
+				_lastExpiry = NULL;
+			};
+
+
+
+			/********************************/
+			/*****      STATISTICS      *****/
+			/********************************/
+
+
+
+			const lru_cache_stats&	stats() const {
+				return _stats;
+			};
+
+			void	reset_stats() {
+				_stats.hits = 0;
+				_stats.misses = 0;
+				_stats.evictions = 0;
+				_stats.expirations = 0;
+			};
+
+			// Least recently used key, which the next eviction removes
+			const Key	*oldest() const {
+				return _oldest ? &_oldest->_data.first : NULL;
+			};
+
+
+
+			/*************************************/
+			/*****      INTRUSIVE LISTS      *****/
+			/*************************************/
+
+		private:
+
+			size_type	expire_before( long long now ) {
+				size_type n = 0;
+				while (_firstExpiry && _firstExpiry->_data.second._expires <= now) {
+					remove(_firstExpiry);
+					n++;
+				}
+				_stats.expirations += n;
+				return n;
+			};
+
+			void	remove( node *e ) {
+				unlink_recency(e);
+				unlink_expiry(e);
+				_map.erase(typename map_type::iterator(e));
+			};
+
+			void	push_recency( node *e ) {
+				e->_data.second._newer = NULL;
+				e->_data.second._older = _newest;
+				if (_newest) {
+					_newest->_data.second._newer = e;
+				}
+				else {
+					_oldest = e;
+				}
+				_newest = e;
+			};
+
+			void	unlink_recency( node *e ) {
+				node *newer = e->_data.second._newer;
+				node *older = e->_data.second._older;
+				if (newer) {
+					newer->_data.second._older = older;
+				}
+				else {
+					_newest = older;
+				}
+				if (older) {
+					older->_data.second._newer = newer;
+				}
+				else {
+					_oldest = newer;
+				}
+			};
+
+			void	push_expiry( node *e ) {
+				e->_data.second._later = NULL;
+				e->_data.second._earlier = _lastExpiry;
+				if (_lastExpiry) {
+					_lastExpiry->_data.second._later = e;
+				}
+				else {
+					_firstExpiry = e;
+				}
+				_lastExpiry = e;
+			};
+
+			void	unlink_expiry( node *e ) {
+				node *later = e->_data.second._later;
+				node *earlier = e->_data.second._earlier;
+				if (later) {
+					later->_data.second._earlier = earlier;
+				}
+				else {
+					_lastExpiry = earlier;
+				}
+				if (earlier) {
+					earlier->_data.second._later = later;
+				}
+				else {
+					_firstExpiry = later;
+				}
+			};
+
+	};
+
+}; // namespace ft
+
+#endif /*LRU_CACHE_HPP*/
@@ -7,17 +7,6 @@
 
 namespace ft {
 
-	template< typename T >
-	struct node
-	{
-		T				*_data;
-		node		*_left;
-		node		*_right;
-		node		*_parent;
-		node		*_end;
-		int			_height;
-	};
-
 	template < typename Key, typename T, typename Compare = std::less<Key>, typename Allocator = std::allocator<ft::pair<const Key, T> > >
 	class map
 	{
@@ -42,15 +31,14 @@ namespace ft {
 
 			typedef typename allocator_type::pointer														pointer;
 			typedef typename allocator_type::const_pointer											const_pointer;
-			typedef map_iterators<Compare, node<value_type>, value_type>				iterator;
-			typedef map_iterators<Compare, node<value_type>, const value_type>	const_iterator;
+			typedef tree_iterators<tree_node<value_type>, value_type>						iterator;
+			typedef tree_iterators<tree_node<value_type>, const value_type>			const_iterator;
 			typedef ft::reverse_iterator<iterator>															reverse_iterator;
 			typedef ft::reverse_iterator<const_iterator>												const_reverse_iterator;
 
 		protected:
 
-			typedef node<value_type>																						tnode;
-			typedef typename allocator_type::template rebind<tnode>::other			node_alloc;
+			typedef tree<Key, value_type, select_first<value_type>, Compare, Allocator, true>	tree_type;
 
 
 		public:
@@ -89,12 +77,7 @@ namespace ft {
 			/*****      MEMBER ATTRIBUTES      *****/
 			/***************************************/
 
-			node_alloc			_allocNode;
-			tnode						*_root;
-			tnode						*_end;
-			allocator_type	_alloc;
-			size_type				_size;
-			Compare					_comp;
+			tree_type				_tree;
 
 		public:
 
@@ -117,21 +100,17 @@ namespace ft {
 			*/
 
 			explicit map( const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
-				: _allocNode(node_alloc()), _root(NULL), _end(NULL), _alloc(alloc), _size(0), _comp(comp) {
-					initialize_end();
+				: _tree(comp, alloc) {
 			};
 
 			template< class InputIt >
 			map( InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
-				: _allocNode(node_alloc()), _root(NULL), _end(NULL), _alloc(alloc), _size(0), _comp(comp) {
-				initialize_end();
+				: _tree(comp, alloc) {
 				insert(first, last);
 			};
 
 			map( const map& other )
-				: _allocNode(other._allocNode), _root(NULL), _end(NULL), _alloc(other._alloc), _size(0), _comp(other._comp) {
-				initialize_end();
-				insert(other.begin(), other.end());
+				: _tree(other._tree) {
 			};
 
 
@@ -143,10 +122,6 @@ namespace ft {
 			*/
 
 			~map() {
-				clear();
-				_alloc.deallocate(_end->_data, 1);
-				_allocNode.deallocate(_end, 1);
-				_allocNode.destroy(_end);
 			};
 
 
@@ -158,11 +133,7 @@ namespace ft {
 			*/
 
 			map& operator=( const map& other ) {
-				clear();
-				_allocNode = other._allocNode;
-				_alloc = other._alloc;
-				_comp = other._comp;
-				insert(other.begin(), other.end());
+				_tree = other._tree;
 				return *this;
 			};
 
@@ -174,7 +145,7 @@ namespace ft {
 			*/
 
 			allocator_type	get_allocator() const {
-				return _alloc;
+				return _tree.get_allocator();
 			};
 
 
@@ -194,7 +165,7 @@ namespace ft {
 
 			T& at( const Key& key ) {
 				iterator it = find(key);
-				if (it != end() && it->first == key) {
+				if (it != end()) {
 					return it->second;
 				}
 				throw std::out_of_range("Key not found");
@@ -202,7 +173,7 @@ namespace ft {
 
 			const T& at( const Key& key ) const {
 				const_iterator it = find(key);
-				if (it != end() && it->first == key) {
+				if (it != end()) {
 					return it->second;
 				}
 				throw std::out_of_range("Key not found");
@@ -222,13 +193,7 @@ namespace ft {
 			*/
 
 			T& operator[]( const Key& key ) {
-				iterator it = find(key);
-				if (it == end()) {
-					value_type add(key, T());
-					insert(add);
-				}
-				it = find(key);
-				return it->second;
+				return insert(value_type(key, T())).first->second;
 			};
 
 
@@ -247,17 +212,11 @@ namespace ft {
 			*/
 
 			iterator begin() {
-				if (_size == 0) {
-					return iterator(_end);
-				}
-				return iterator(node_value_min(_root));
+				return _tree.begin();
 			};
 
 			const_iterator begin() const {
-				if (_size == 0) {
-					return const_iterator(_end);
-				}
-				return const_iterator(node_value_min(_root));
+				return _tree.begin();
 			};
 
 
@@ -269,11 +228,11 @@ namespace ft {
 			*/
 
 			iterator end() {
-				return iterator(_end);
+				return _tree.end();
 			};
 
 			const_iterator end() const {
-				return const_iterator(_end);
+				return _tree.end();
 			};
 
 
@@ -325,7 +284,7 @@ namespace ft {
 			*/
 
 			bool empty() const {
-				return _size == 0;
+				return _tree.empty();
 			};
 
 
@@ -336,7 +295,7 @@ namespace ft {
 			*/
 
 			size_type	size() const {
-				return _size;
+				return _tree.size();
 			};
 
 
@@ -349,7 +308,7 @@ namespace ft {
 			*/
 
 			size_type	max_size() const {
-				return _alloc.max_size();
+				return _tree.max_size();
 			};
 
 
@@ -369,9 +328,7 @@ namespace ft {
 			*/
 
 			void clear() {
-				if (_size) {
-					destroy_tree(_root);
-				}
+				_tree.clear();
 			};
 
 
@@ -389,36 +346,24 @@ namespace ft {
 			**
 			**		3) Inserts elements from range [first, last). If multiple elements in the range
 			**		 have keys that compare equivalent, it is unspecified which element is inserted (pending LWG2844).
+			**	The position of (2) is searched from hint up to the closest common ancestor:
+			**	O(log d) comparisons for an element inserted d positions away from hint,
+			**	O(1) when it goes right before hint, right after it, or at the end with hint end().
+			**	Keeping the iterator returned by the previous insertion as hint makes
+			**	a nearly sorted stream cost O(1) amortized comparisons per element.
 			*/
 
 			pair<iterator, bool> insert( const value_type& value ) {
-				size_type temp = _size;
-
-				_root = insert_node(_root, value, NULL);
-				if (_end->_parent == NULL) {
-					_end->_parent = _root;
-					_end->_left = _root;
-				}
-				else {
-					tnode *new_max = node_value_max(_root);
-					if (_comp(_end->_parent->_data->first, new_max->_data->first)) {
-						_end->_parent = new_max;
-						_end->_left = new_max;
-					}
-				}
-				return pair<iterator, bool>(find(value.first), temp != size());
+				return _tree.insert(value);
 			};
 
 			template< class InputIt >
 			void insert( InputIt first, InputIt last ) {
-				for (; first != last; ++first)
-					insert(*first);
+				_tree.insert(first, last);
 			};
 
 			iterator	insert( iterator hint, const value_type& value ) {
-				(void)hint;
-				insert(value);
-				return find(value.first);
+				return _tree.insert(hint, value).first;
 			};
 
 
@@ -436,41 +381,15 @@ namespace ft {
 			*/
 
 			void erase( iterator pos ) {
-				_root = deleteNode(_root, *pos.getnode()->_data);
-				if (_root) {
-					tnode *new_max = node_value_max(_root);
-					_end->_parent = new_max;
-					_end->_left = new_max;
-				}
-				else {
-					_end->_parent = NULL;
-					_end->_left = NULL;
-				}
+				_tree.erase(pos);
 			};
 
 			void erase( iterator first, iterator last ) {
-				map tmp(first, last);
-				iterator it = tmp.begin();
-				iterator ite = tmp.end();
-				ite--;
-				for (; it != ite;) {
-					erase(it);
-					it++;
-				}
-				erase(it);
-				if (!_size) {
-						_end->_parent = NULL;
-						_end->_left = NULL;
-				}
+				_tree.erase(first, last);
 			};
 
 			size_type erase( const Key& key ) {
-				iterator it = find(key);
-				if (it == end()) {
-					return 0;
-				}
-				erase(it);
-				return 1;
+				return _tree.erase(key);
 			};
 
 
@@ -484,25 +403,100 @@ namespace ft {
 			*/
 
 			void swap( map& other ) {
-				node_alloc			tmp_allocNode = _allocNode;
-				tnode						*tmp_root = _root;
-				tnode						*tmp_end = _end;
-				allocator_type	tmp_alloc = _alloc;
-				size_type				tmp_size = _size;
-				Compare					tmp_comp = _comp;
+				_tree.swap(other._tree);
+			};
 
-				_allocNode = other._allocNode;
-				_root = other._root;
-				_end = other._end;
-				_alloc = other._alloc;
-				_size = other._size;
-				_comp = other._comp;
-				other._allocNode = tmp_allocNode;
-				other._root = tmp_root;
-				other._end = tmp_end;
-				other._alloc = tmp_alloc;
-				other._size = tmp_size;
-				other._comp = tmp_comp;
+
+			/*
+			**	Compact
+			**
+			**	Moves every element to one contiguous block, in key order (compact_in_order,
+			**	fastest scans) or in van Emde Boas order (compact_veb, fastest lookups),
+			**	and rebalances the tree perfectly. Meant for long-lived maps whose nodes
+			**	got scattered over the heap by insertions and erasures.
+			**	Every iterator, pointer and reference to an element is invalidated.
+			*/
+
+			void compact( compact_layout layout = compact_in_order ) {
+				_tree.compact(layout);
+			};
+
+
+
+			/************************************/
+			/*****      SPLIT AND JOIN      *****/
+			/************************************/
+
+
+
+			/*
+			**	Split
+			**
+			**	Moves every element whose key is not less than key into greater, whose previous
+			**	contents are erased. *this keeps the elements whose key is less than key.
+			**	The tree is cut along the search path of key and the pieces are joined back,
+			**	so no element is copied, in O(log n). Only built with FT_MAP_ORDER_STATISTICS:
+			**	without the subtree sizes, the size of each part would take O(n) to count.
+			**	Iterators to the moved elements now belong to greater.
+			*/
+
+# ifdef FT_MAP_ORDER_STATISTICS
+			void split( const Key& key, map& greater ) {
+				_tree.split(key, greater._tree);
+			};
+# endif
+
+
+			/*
+			**	Join
+			**
+			**	Moves every element of other into *this in O(log n). All the keys of other must be
+			**	greater than all the keys of *this, or all less; otherwise std::invalid_argument is thrown.
+			**	Both maps must use equal allocators. other is left empty.
+			*/
+
+			void join( map& other ) {
+				_tree.join(other._tree, "map::join: key ranges overlap");
+			};
+
+
+
+			/************************************/
+			/*****      SET OPERATIONS      *****/
+			/************************************/
+
+
+
+			/*
+			**	Set operations
+			**
+			**	Bulk operations between two maps, by divide and conquer on split and join:
+			**	the other tree is split around the root of this one and both halves are
+			**	processed recursively before being joined back. Elements are moved, never copied,
+			**	in O(m log(n / m + 1)) for maps of sizes m <= n: the sizes are counted during
+			**	the recursion, with or without FT_MAP_ORDER_STATISTICS. Both maps must use equal allocators.
+			**		- merge: moves the elements of other whose key is not in *this into *this,
+			**		 the others stay in other (like std::map::merge).
+			**		- set_union: same as merge, then the duplicates left in other are destroyed.
+			**		- set_intersection: keeps in *this the elements whose key is in other.
+			**		- set_difference: keeps in *this the elements whose key is not in other.
+			**	Except for merge, other is left empty. On equivalent keys, the element of *this is kept.
+			*/
+
+			void merge( map& other ) {
+				_tree.merge(other._tree);
+			};
+
+			void set_union( map& other ) {
+				_tree.set_union(other._tree);
+			};
+
+			void set_intersection( map& other ) {
+				_tree.set_intersection(other._tree);
+			};
+
+			void set_difference( map& other ) {
+				_tree.set_difference(other._tree);
 			};
 
 
@@ -519,10 +513,18 @@ namespace ft {
 			**	Returns the number of elements with key that compares equivalent to the specified argument,
 			**	which is either 1 or 0 since this container does not allow duplicates.
 			**	Returns the number of elements with key key.
+			**	The overloads taking a K compare the keys to x. They participate in overload resolution
+			**	only if Compare::is_transparent is valid and denotes a type, and allow calling
+			**	this function without constructing an instance of Key.
 			*/
 
 			size_type count( const Key& key ) const {
-				return find(key) == end() ? 0 : 1;
+				return _tree.count(key);
+			};
+
+			template< class K >
+			typename ft::enable_if_transparent<Compare, K, size_type>::type count( const K& x ) const {
+				return _tree.count(x);
 			};
 
 
@@ -530,14 +532,43 @@ namespace ft {
 			**	Find
 			**
 			**	Finds an element with key equivalent to key.
+			**	The overloads taking a K compare the keys to x. They participate in overload resolution
+			**	only if Compare::is_transparent is valid and denotes a type, and allow calling
+			**	this function without constructing an instance of Key.
 			*/
 
 			iterator find( const Key& key ) {
-				return (find_in_tree(_root, key));
+				return _tree.find(key);
 			};
 
 			const_iterator find( const Key& key ) const {
-				return (find_in_tree(_root, key));
+				return _tree.find(key);
+			};
+
+			/*
+			**	Find with a hint
+			**
+			**	Same as find, but the search starts from hint and only climbs as far as needed:
+			**	O(log d) comparisons for a key d positions away from hint. Passing the result
+			**	of the previous lookup as hint makes nearly sorted lookups cheap.
+			*/
+
+			iterator find( const_iterator hint, const Key& key ) {
+				return _tree.find(hint, key);
+			};
+
+			const_iterator find( const_iterator hint, const Key& key ) const {
+				return _tree.find(hint, key);
+			};
+
+			template< class K >
+			typename ft::enable_if_transparent<Compare, K, iterator>::type find( const K& x ) {
+				return _tree.find(x);
+			};
+
+			template< class K >
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type find( const K& x ) const {
+				return _tree.find(x);
 			};
 
 
@@ -549,14 +580,27 @@ namespace ft {
 			**	that is not less than key and another pointing to the first element greater than key.
 			**	Alternatively, the first iterator may be obtained with lower_bound(), and the second with upper_bound().
 			**	Compares the keys to key.
+			**	The overloads taking a K compare the keys to x. They participate in overload resolution
+			**	only if Compare::is_transparent is valid and denotes a type, and allow calling
+			**	this function without constructing an instance of Key.
 			*/
 
 			ft::pair<iterator,iterator> equal_range( const Key& key ) {
-				return ft::pair<iterator,iterator>(lower_bound(key), upper_bound(key));
+				return _tree.equal_range(key);
 			};
 
 			ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const {
-				return ft::pair<const_iterator,const_iterator>(lower_bound(key), upper_bound(key));
+				return _tree.equal_range(key);
+			};
+
+			template< class K >
+			typename ft::enable_if_transparent<Compare, K, ft::pair<iterator, iterator> >::type equal_range( const K& x ) {
+				return _tree.equal_range(x);
+			};
+
+			template< class K >
+			typename ft::enable_if_transparent<Compare, K, ft::pair<const_iterator, const_iterator> >::type equal_range( const K& x ) const {
+				return _tree.equal_range(x);
 			};
 
 
@@ -564,28 +608,27 @@ namespace ft {
 			**	Lower_bound
 			**
 			**	Returns an iterator pointing to the first element that is not less than (i.e. greater or equal to) key.
+			**	The overloads taking a K compare the keys to x. They participate in overload resolution
+			**	only if Compare::is_transparent is valid and denotes a type, and allow calling
+			**	this function without constructing an instance of Key.
 			*/
 
 			iterator lower_bound( const Key& key ) {
-				iterator it = begin();
-				while (it != end()) {
-					if (it->first >= key) {
-						return it;
-					}
-					++it;
-				}
-				return it;
+				return _tree.lower_bound(key);
 			};
 
 			const_iterator lower_bound( const Key& key ) const {
-				const_iterator it = begin();
-				while (it != end()) {
-					if (it->first >= key) {
-						return it;
-					}
-					++it;
-				}
-				return it;
+				return _tree.lower_bound(key);
+			};
+
+			template< class K >
+			typename ft::enable_if_transparent<Compare, K, iterator>::type lower_bound( const K& x ) {
+				return _tree.lower_bound(x);
+			};
+
+			template< class K >
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type lower_bound( const K& x ) const {
+				return _tree.lower_bound(x);
 			};
 
 
@@ -593,354 +636,159 @@ namespace ft {
 			**	Upper_bound
 			**
 			**	Returns an iterator pointing to the first element that is greater than key.
+			**	The overloads taking a K compare the keys to x. They participate in overload resolution
+			**	only if Compare::is_transparent is valid and denotes a type, and allow calling
+			**	this function without constructing an instance of Key.
 			*/
 
 			iterator upper_bound( const Key& key ) {
-				iterator it = begin();
-				while (it != end()) {
-					if (it->first > key)
-						return it;
-					++it;
-				}
-				return it;
+				return _tree.upper_bound(key);
 			};
 
 			const_iterator upper_bound( const Key& key ) const {
-				const_iterator it = begin();
-				while (it != end()) {
-					if (it->first > key)
-						return it;
-					++it;
-				}
-				return it;
+				return _tree.upper_bound(key);
 			};
 
+			template< class K >
+			typename ft::enable_if_transparent<Compare, K, iterator>::type upper_bound( const K& x ) {
+				return _tree.upper_bound(x);
+			};
 
-
-			/*******************************/
-			/*****      OBSERVERS      *****/
-			/*******************************/
+			template< class K >
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type upper_bound( const K& x ) const {
+				return _tree.upper_bound(x);
+			};
 
 
 
 			/*
-			**	Key_comp
+			**	Find_many
 			**
-			**	Returns the function object that compares the keys,
-			**	which is a copy of this container's constructor argument comp.
+			**	Finds every key of [first, last) and writes, in the same order, an iterator to
+			**	its element or end() to out. Returns out past the last iterator written.
+			**	Batches of keys are searched together: their descents are interleaved and each
+			**	one prefetches its next node, so the cache misses overlap. Throughput on large
+			**	batches is higher than calling find() in a loop, the latency of one key is not.
+			**	The keys are read several times, so ForwardIt must be a forward iterator.
 			*/
 
-			key_compare key_comp() const {
-				return _comp;
+			template< class ForwardIt, class OutputIt >
+			OutputIt find_many( ForwardIt first, ForwardIt last, OutputIt out ) {
+				return _tree.find_many(first, last, out);
+			};
+
+			template< class ForwardIt, class OutputIt >
+			OutputIt find_many( ForwardIt first, ForwardIt last, OutputIt out ) const {
+				return _tree.find_many(first, last, out);
 			};
 
 
+
+			/**************************************/
+			/*****      ORDER STATISTICS      *****/
+			/**************************************/
+
+
+
 			/*
-			**	Value_comp
+			**	Nth
 			**
-			**	Returns a function object that compares objects of type std::map::value_type
-			**	(key-value pairs) by using key_comp to compare the first components of the pairs.
+			**	Returns an iterator to the element at position k in key order (0 is begin()),
+			**	or end() if k >= size().
 			*/
 
-			value_compare value_comp() const {
-				return value_compare(Compare());
+			iterator nth( size_type k ) {
+				return _tree.nth(k);
 			};
 
+			const_iterator nth( size_type k ) const {
+				return _tree.nth(k);
+			};
 
 
-			/*************************/
-			/*****      AVL      *****/
-			/*************************/
-
-		private:
+			/*
+			**	Rank
+			**
+			**	Returns the number of elements whose key is less than key,
+			**	which is the position of lower_bound(key).
+			*/
 
-			int	max( int a, int b ) {
-				return (a > b) ? a : b;
+			size_type rank( const Key& key ) const {
+				return _tree.rank(key);
 			};
 
-			int height( tnode *nd ) {
-				if (nd == NULL) {
-					return 0;
-				}
-				return nd->_height;
-			};
-
-			void destroy_tree( tnode *nd ) {
-				if (nd != NULL) {
-					destroy_tree(nd->_left);
-					destroy_tree(nd->_right);
-					_size--;
-					if (_size == 0) {
-						_end->_parent = NULL;
-						_end->_left = NULL;
-					}
-					free_node(nd);
-				}
-				_root = NULL;
-			};
 
-			iterator find_in_tree( tnode *nd, const Key& key ) {
-				if (nd == NULL) {
-					return end();
-				}
-				if (nd->_data->first == key) {
-					return iterator(nd);
-				}
-				else if (_comp(key, nd->_data->first)) {
-					return find_in_tree(nd->_left, key);
-				}
-				else {
-					return find_in_tree(nd->_right, key);
-				}
-			};
+			/*
+			**	Count_range
+			**
+			**	Returns the number of elements whose key is in [lo, hi).
+			*/
 
-			const_iterator find_in_tree( tnode *nd, const Key& key ) const {
-				if (nd == NULL) {
-					return end();
-				}
-				if (nd->_data->first == key) {
-					return iterator(nd);
-				}
-				else if (_comp(key, nd->_data->first)) {
-					return find_in_tree(nd->_left, key);
-				}
-				else {
-					return find_in_tree(nd->_right, key);
-				}
+			size_type count_range( const Key& lo, const Key& hi ) const {
+				return _tree.count_range(lo, hi);
 			};
 
-			tnode	*new_node( const value_type& value, tnode *parent ) {
-				tnode *nd = _allocNode.allocate(1);
-				_allocNode.construct(nd, tnode());
-				nd->_left = NULL;
-				nd->_right = NULL;
-				nd->_parent = parent;
-				nd->_end = _end;
-				nd->_height = 1;
-				nd->_data = _alloc.allocate(1);
-				_alloc.construct(nd->_data, value);
-				return (nd);
-			};
 
-			void	free_node( tnode *nd ) {
-				if (nd->_data) {
-					_alloc.deallocate(nd->_data, 1);
-					nd->_data = NULL;
-				}
-				_allocNode.deallocate(nd, 1);
-				_allocNode.destroy(nd);
-				nd = NULL;
-			};
 
-			tnode *rightRotate( tnode *y ) {
-				tnode *x = y->_left;
-				tnode *xr = x->_right;
+			/*******************************/
+			/*****      OBSERVERS      *****/
+			/*******************************/
 
-				x->_parent = y->_parent;
-				y->_parent = x;
-				x->_right = y;
-				y->_left = xr;
-				if (xr) {
-					xr->_parent = y;
-				}
-				y->_height = max(height(y->_left), height(y->_right)) + 1;
-				x->_height = max(height(x->_left), height(x->_right)) + 1;
-				return x;
-			};
 
-			tnode *leftRotate( tnode *x ) {
-				tnode *y = x->_right;
-				tnode *yl = y->_left;
 
-				y->_parent = x->_parent;
-				x->_parent = y;
-				y->_left = x;
-				x->_right = yl;
-				if (yl) {
-					yl->_parent = x;
-				}
-				x->_height = max(height(x->_left), height(x->_right)) + 1;
-				y->_height = max(height(y->_left), height(y->_right)) + 1;
-				return y;
-			};
+			/*
+			**	Key_comp
+			**
+			**	Returns the function object that compares the keys,
+			**	which is a copy of this container's constructor argument comp.
+			*/
 
-			int getBalanceFactor( tnode *nd ) {
-				if (nd == NULL) {
-					return 0;
-				}
-				return height(nd->_left) - height(nd->_right);
+			key_compare key_comp() const {
+				return _tree.key_comp();
 			};
 
-			/* Insert a node in a recursive way
-			/ 1- Find the correct position and Insert new node
-			/ 2- Check the balance and rotate if necessary
+
+			/*
+			**	Value_comp
+			**
+			**	Returns a function object that compares objects of type std::map::value_type
+			**	(key-value pairs) by using key_comp to compare the first components of the pairs.
 			*/
-			tnode *insert_node( tnode *root, const value_type value, tnode *parent ) {
-				if (root == NULL) {
-					_size++;
-					return (new_node(value, parent));
-				}
-				if (_comp(value.first, root->_data->first)) {
-					root->_left = insert_node(root->_left, value, root);
-				}
-				else {
-					if (value.first == root->_data->first) {
-						return root;
-					}
-					root->_right = insert_node(root->_right, value, root);
-				}
-				root->_height = 1 + max(height(root->_left), height(root->_right));
-				int balanceFactor = getBalanceFactor(root);
-				if (balanceFactor > 1) {
-					if (_comp(value.first, root->_left->_data->first)) {
-						return rightRotate(root);
-					}
-					else {
-						root->_left = leftRotate(root->_left);
-						return rightRotate(root);
-					}
-				}
-				if (balanceFactor < -1) {
-					if (!(_comp(value.first, root->_right->_data->first))) {
-						return leftRotate(root);
-					}
-					else {
-						root->_right = rightRotate(root->_right);
-						return leftRotate(root);
-					}
-				}
-				return root;
-			};
 
-			tnode *node_value_min( tnode *nd ) const {
-				tnode *temp = nd;
-				while (temp->_left != NULL) {
-					temp = temp->_left;
-				}
-				return temp;
+			value_compare value_comp() const {
+				return value_compare(key_comp());
 			};
 
-			tnode *node_value_max( tnode *nd ) const {
-				tnode *temp = nd;
-				while (temp->_right != NULL) {
-					temp = temp->_right;
-				}
-				return temp;
+# ifdef FT_MAP_STATS
+
+
+
+			/***************************/
+			/*****      STATS      *****/
+			/***************************/
+
+
+
+			/*
+			**	Stats
+			**
+			**	Returns the operation counters of the map since its construction or the
+			**	last reset_stats(), with its current height and depth histogram (O(n)).
+			**	Only built with -D FT_MAP_STATS, see tree.hpp.
+			*/
+
+			tree_stats stats() const {
+				return _tree.stats();
 			};
 
-			tnode *deleteNode( tnode *root, const value_type value ) {
-				if (root == NULL) {
-					return root;
-				}
-				if (_comp(value.first, root->_data->first)) {
-					root->_left = deleteNode(root->_left, value);
-				}
-				else if (value.first != root->_data->first) {
-					root->_right = deleteNode(root->_right, value);
-				}
-				else {
-					if ((root->_left == NULL) || (root->_right == NULL)) {
-						tnode *temp = root->_left ? root->_left : root->_right;
-						if (temp == NULL) {
-							temp = root;
-							root = NULL;
-						}
-						else {
-							tnode swap;
-							swap._data = root->_data;
-							root->_data = temp->_data;
-							root->_left = temp->_left;
-							root->_right = temp->_right;
-							temp->_data = swap._data;
-						}
-						_size--;
-						free_node(temp);
-					}
-					else {
-						tnode swap;
-						swap._data = root->_data;
-						tnode *temp = node_value_min(root->_right);
-						if (temp->_data->first == root->_right->_data->first) {
-							root->_right = root->_right->_right;
-						}
-						else {
-							temp->_parent->_left = NULL;
-						}
-						root->_data = temp->_data;
-						temp->_data = swap._data;
-						if (temp->_right) {
-							temp->_right->_parent = root;
-						}
-						_size--;
-						free_node(temp);
-					}
-				}
-				if (root == NULL) {
-					return root;
-				}
-				root->_height = 1 + max(height(root->_left), height(root->_right));
-				int balanceFactor = getBalanceFactor(root);
-				if (balanceFactor > 1) {
-					if (getBalanceFactor(root->_left) >= 0) {
-						return rightRotate(root);
-					}
-					else {
-						root->_left = leftRotate(root->_left);
-						return rightRotate(root);
-					}
-				}
-				if (balanceFactor < -1)	{
-					if (getBalanceFactor(root->_right) <= 0) {
-						return leftRotate(root);
-					}
-					else {
-						root->_right = rightRotate(root->_right);
-						return leftRotate(root);
-					}
-				}
-				return root;
-			};
-
-			void	initialize_end() {
-				_end = new_node(value_type(key_type(), mapped_type()), NULL);
-			};
-
-			// Print the tree
-			void printTree( tnode *root, std::string indent, bool last ) {
-				if (root != NULL) {
-					std::cout << indent;
-					if (last) {
-						std::cout << "R----";
-						indent += "   ";
-					}
-					else {
-						std::cout << "L----";
-						indent += "|  ";
-					}
-					std::cout << root->_data->first << std::endl;
-					printInfoNode(root);
-					printTree(root->_left, indent, false);
-					printTree(root->_right, indent, true);
-				}
+			void reset_stats() {
+				_tree.reset_stats();
 			};
 
-			void printInfoNode( tnode *nd ) {
-				std::cout << "ndODE " << nd->_data->first;
-				//  std::cout << "ndODE " << nd->_data->first << " HEIGHT LEFT = " << height(nd->_left) << " HEIGHT RIGHT = " << height(nd->_right) << " HEIGHT = " << height(nd->_left) - height(nd->_right);
-				if (nd->_left) {
-					std::cout<< " Value nd->_left "<< nd->_left->_data->first;
-				}
-				if (nd->_right) {
-					std::cout<< " Value nd->_right "<< nd->_right->_data->first;
-				}
-				if (nd->_parent) {
-					std::cout << " DAD = " << nd->_parent->_data->first;
-				}
-				else {
-					std::cout << " DAD = NULL ";
-				}
-				std::cout<< std::endl;
+			void dump_stats( std::ostream& out = std::cout ) const {
+				stats().dump(out);
 			};
+# endif
 
 	};
 
@@ -0,0 +1,313 @@
+#pragma once
+
+#ifndef MULTISET_HPP
+# define MULTISET_HPP
+
+# include "utils.hpp"
+
+namespace ft {
+
+	/*
+	**	Multiset
+	**
+	**	Sorted set of keys on the AVL tree shared with ft::map, equivalent keys allowed.
+	**	Equivalent keys are kept in insertion order. A node stores only the key.
+	**	Split, join and the set operations need unique keys and are not provided.
+	*/
+
+	template < typename Key, typename Compare = std::less<Key>, typename Allocator = std::allocator<Key> >
+	class multiset
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef Key																													value_type;
+
+			typedef std::size_t																									size_type;
+			typedef std::ptrdiff_t																							difference_type;
+
+			typedef Compare																											key_compare;
+			typedef Compare																											value_compare;
+			typedef Allocator																										allocator_type;
+			typedef value_type&																									reference;
+			typedef const value_type&																						const_reference;
+
+			typedef typename allocator_type::pointer														pointer;
+			typedef typename allocator_type::const_pointer											const_pointer;
+			typedef tree_iterators<tree_node<value_type>, const value_type>			iterator;
+			typedef tree_iterators<tree_node<value_type>, const value_type>			const_iterator;
+			typedef ft::reverse_iterator<iterator>															reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>												const_reverse_iterator;
+
+		protected:
+
+			typedef tree<Key, value_type, identity<value_type>, Compare, Allocator, false>	tree_type;
+
+		private:
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			tree_type				_tree;
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+
+
+			explicit multiset( const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _tree(comp, alloc) {
+			};
+
+			template< class InputIt >
+			multiset( InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _tree(comp, alloc) {
+				insert(first, last);
+			};
+
+			multiset( const multiset& other )
+				: _tree(other._tree) {
+			};
+
+			~multiset() {
+			};
+
+			multiset& operator=( const multiset& other ) {
+				_tree = other._tree;
+				return *this;
+			};
+
+			allocator_type	get_allocator() const {
+				return _tree.get_allocator();
+			};
+
+
+
+			/******************************/
+			/*****      ITERATOR      *****/
+			/******************************/
+
+
+
+			iterator begin() const {
+				return const_cast<const tree_type&>(_tree).begin();
+			};
+
+			iterator end() const {
+				return const_cast<const tree_type&>(_tree).end();
+			};
+
+			reverse_iterator rbegin() const {
+				return reverse_iterator(end());
+			};
+
+			reverse_iterator rend() const {
+				return reverse_iterator(begin());
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return _tree.empty();
+			};
+
+			size_type	size() const {
+				return _tree.size();
+			};
+
+			size_type	max_size() const {
+				return _tree.max_size();
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			void clear() {
+				_tree.clear();
+			};
+
+
+			/*
+			**	Insert
+			**
+			**	Inserts value after the elements with an equivalent key
+			**	and returns an iterator to it.
+			**	A hint only shortens the search, the value still goes after every equivalent
+			**	element: unlike std::multiset, a hint inside a run of equivalent keys is not
+			**	a position, and the search then starts from the root.
+			*/
+
+			iterator insert( const value_type& value ) {
+				return _tree.insert(value).first;
+			};
+
+			iterator	insert( iterator hint, const value_type& value ) {
+				return _tree.insert(hint, value).first;
+			};
+
+			template< class InputIt >
+			void insert( InputIt first, InputIt last ) {
+				_tree.insert(first, last);
+			};
+
+
+			/*
+			**	Erase
+			**
+			**	Removes the element at pos, the elements in [first, last), or every element
+			**	equivalent to key and returns how many. Other iterators are not affected.
+			*/
+
+			void erase( iterator pos ) {
+				_tree.erase(pos);
+			};
+
+			void erase( iterator first, iterator last ) {
+				_tree.erase(first, last);
+			};
+
+			size_type erase( const Key& key ) {
+				return _tree.erase(key);
+			};
+
+			void swap( multiset& other ) {
+				_tree.swap(other._tree);
+			};
+
+
+			// Moves every element to one contiguous block, see map::compact(); invalidates every iterator
+			void compact( compact_layout layout = compact_in_order ) {
+				_tree.compact(layout);
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			size_type count( const Key& key ) const {
+				return _tree.count(key);
+			};
+
+			// First element equivalent to key
+			iterator find( const Key& key ) const {
+				return const_cast<const tree_type&>(_tree).find(key);
+			};
+
+			ft::pair<iterator,iterator> equal_range( const Key& key ) const {
+				return ft::pair<iterator,iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			iterator lower_bound( const Key& key ) const {
+				return const_cast<const tree_type&>(_tree).lower_bound(key);
+			};
+
+			iterator upper_bound( const Key& key ) const {
+				return const_cast<const tree_type&>(_tree).upper_bound(key);
+			};
+
+
+
+			/**************************************/
+			/*****      ORDER STATISTICS      *****/
+			/**************************************/
+
+
+
+			iterator nth( size_type k ) const {
+				return const_cast<const tree_type&>(_tree).nth(k);
+			};
+
+			size_type rank( const Key& key ) const {
+				return _tree.rank(key);
+			};
+
+			size_type count_range( const Key& lo, const Key& hi ) const {
+				return _tree.count_range(lo, hi);
+			};
+
+
+
+			/*******************************/
+			/*****      OBSERVERS      *****/
+			/*******************************/
+
+
+
+			key_compare key_comp() const {
+				return _tree.key_comp();
+			};
+
+			value_compare value_comp() const {
+				return _tree.key_comp();
+			};
+
+	};
+
+	/******************************************/
+	/*****      NON-MEMBER FUNCTIONS      *****/
+	/******************************************/
+
+
+
+	template< class Key, class Compare, class Alloc >
+	bool operator==( const ft::multiset<Key,Compare,Alloc>& lhs, const ft::multiset<Key,Compare,Alloc>& rhs ) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator!=( const ft::multiset<Key,Compare,Alloc>& lhs, const ft::multiset<Key,Compare,Alloc>& rhs ) {
+		return !(lhs == rhs);
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator<( const ft::multiset<Key,Compare,Alloc>& lhs, const ft::multiset<Key,Compare,Alloc>& rhs ) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator<=( const ft::multiset<Key,Compare,Alloc>& lhs, const ft::multiset<Key,Compare,Alloc>& rhs ) {
+		return !(rhs < lhs);
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator>( const ft::multiset<Key,Compare,Alloc>& lhs, const ft::multiset<Key,Compare,Alloc>& rhs ) {
+		return (rhs < lhs);
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator>=( const ft::multiset<Key,Compare,Alloc>& lhs, const ft::multiset<Key,Compare,Alloc>& rhs ) {
+		return !(lhs < rhs);
+	};
+
+	template< class Key, class Compare, class Alloc >
+	void swap( ft::multiset<Key,Compare,Alloc>& lhs, ft::multiset<Key,Compare,Alloc>& rhs ) {
+		lhs.swap(rhs);
+	};
+
+}; // namespace ft
+
+#endif /*MULTISET_HPP*/
@@ -0,0 +1,343 @@
+#pragma once
+
+#ifndef PERF_HPP
+# define PERF_HPP
+
+# include <vector>
+# include <algorithm>
+# include <math.h>
+# include <time.h>
+# include <errno.h>
+# include <string.h>
+# include <unistd.h>
+# ifdef __linux__
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+# endif
+
+namespace ft {
+
+	/*
+	**	Perf
+	**
+	**	Measurement harness of the tests and benchmarks. It uses the standard
+	**	containers internally, so a bug in the ft:: containers cannot skew the numbers.
+	*/
+
+	// Nanoseconds from CLOCK_MONOTONIC, which never goes backwards
+	inline long long	perf_now() {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return static_cast<long long>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+	};
+
+	/*
+	**	Do_not_optimize / clobber_memory
+	**
+	**	Compiler barriers. do_not_optimize() makes the compiler assume value is read,
+	**	so the code computing it is not removed. clobber_memory() makes it assume
+	**	all memory is read and written, so stores are not moved across it.
+	*/
+
+	template< typename T >
+	inline void	do_not_optimize( const T& value ) {
+		__asm__ __volatile__("" : : "r"(&value) : "memory");
+	};
+
+	inline void	clobber_memory() {
+		__asm__ __volatile__("" : : : "memory");
+	};
+
+	/*
+	**	Perf_counters
+	**
+	**	Hardware counters of the calling thread, in user space, through Linux
+	**	perf_event_open. Each event has its own file descriptor, so the events the
+	**	CPU or the permissions refuse (perf_event_paranoid, containers, virtual
+	**	machines without a PMU) are just unavailable, and the others still count.
+	**	When there are more events than hardware counters the kernel multiplexes
+	**	them: read() scales each count by the time its event was enabled over the
+	**	time it actually ran.
+	*/
+
+	enum perf_event_id
+	{
+		perf_cycles,
+		perf_instructions,
+		perf_l1d_misses,
+		perf_llc_misses,
+		perf_branch_misses,
+		perf_dtlb_misses,
+		perf_event_count
+	};
+
+	// Raw values of every event: count, time enabled and time running
+	struct perf_reading
+	{
+		unsigned long long	value[perf_event_count][3];
+	};
+
+	class perf_counters
+	{
+		private:
+
+			int		_fds[perf_event_count];
+			int		_error;
+
+			perf_counters( const perf_counters& );
+			perf_counters& operator=( const perf_counters& );
+
+		public:
+
+			perf_counters()
+				: _error(0) {
+				for (int e = 0; e < perf_event_count; e++) {
+					_fds[e] = open_event(e);
+					if (_fds[e] < 0 && !_error) {
+						_error = errno;
+					}
+				}
+			};
+
+			~perf_counters() {
+				for (int e = 0; e < perf_event_count; e++) {
+					if (_fds[e] >= 0) {
+						close(_fds[e]);
+					}
+				}
+			};
+
+			bool	available( int event ) const {
+				return _fds[event] >= 0;
+			};
+
+			bool	any() const {
+				for (int e = 0; e < perf_event_count; e++) {
+					if (_fds[e] >= 0) {
+						return true;
+					}
+				}
+				return false;
+			};
+
+			// Why the first unavailable event could not be opened, NULL if all are there
+			const char	*error() const {
+				return _error ? strerror(_error) : NULL;
+			};
+
+			static const char	*name( int event ) {
+				static const char *names[perf_event_count] = { "cycles", "instructions", "L1d-misses", "LLC-misses", "branch-misses", "dTLB-misses" };
+				return names[event];
+			};
+
+			void	read( perf_reading& r ) const {
+				for (int e = 0; e < perf_event_count; e++) {
+					if (_fds[e] < 0 || ::read(_fds[e], r.value[e], sizeof(r.value[e])) != sizeof(r.value[e])) {
+						r.value[e][0] = 0;
+						r.value[e][1] = 0;
+						r.value[e][2] = 0;
+					}
+				}
+			};
+
+			// Count of event between two readings, scaled when it was multiplexed
+			static double	delta( const perf_reading& from, const perf_reading& to, int event ) {
+				double count = static_cast<double>(to.value[event][0] - from.value[event][0]);
+				double enabled = static_cast<double>(to.value[event][1] - from.value[event][1]);
+				double running = static_cast<double>(to.value[event][2] - from.value[event][2]);
+				return running > 0 && running < enabled ? count * enabled / running : count;
+			};
+
+		private:
+
+# ifdef __linux__
+			static int	open_event( int event ) {
+				static const unsigned long long cache_read_miss = (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+				struct perf_event_attr attr;
+				memset(&attr, 0, sizeof(attr));
+				attr.size = sizeof(attr);
+				attr.type = PERF_TYPE_HARDWARE;
+				attr.exclude_kernel = 1;
+				attr.exclude_hv = 1;
+				attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+				switch (event) {
+					case perf_cycles:					attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+					case perf_instructions:		attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+					case perf_branch_misses:	attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+					case perf_l1d_misses:
+						attr.type = PERF_TYPE_HW_CACHE;
+						attr.config = PERF_COUNT_HW_CACHE_L1D | cache_read_miss;
+						break;
+					case perf_llc_misses:
+						attr.type = PERF_TYPE_HW_CACHE;
+						attr.config = PERF_COUNT_HW_CACHE_LL | cache_read_miss;
+						break;
+					default:
+						attr.type = PERF_TYPE_HW_CACHE;
+						attr.config = PERF_COUNT_HW_CACHE_DTLB | cache_read_miss;
+						break;
+				}
+				return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+			};
+# else
+			static int	open_event( int ) {
+				errno = ENOSYS;
+				return -1;
+			};
+# endif
+	};
+
+	/*
+	**	Perf_stats
+	**
+	**	Summary of the samples of a measurement, in nanoseconds per operation.
+	**	Percentiles use the nearest rank. events holds the hardware counters per
+	**	operation when the measurement had a perf_counters, -1 for the others.
+	*/
+
+	struct perf_stats
+	{
+		std::size_t	samples;
+		double			min;
+		double			median;
+		double			p90;
+		double			p99;
+		double			mean;
+		double			stddev;
+		double			events[perf_event_count];
+	};
+
+	inline double	perf_percentile( const std::vector<double>& sorted, double p ) {
+		std::size_t rank = static_cast<std::size_t>(ceil(p * sorted.size()));
+		return sorted[rank ? rank - 1 : 0];
+	};
+
+	inline perf_stats	perf_summarize( std::vector<double> samples ) {
+		perf_stats s = perf_stats();
+		s.samples = samples.size();
+		for (int e = 0; e < perf_event_count; e++) {
+			s.events[e] = -1;
+		}
+		if (samples.empty()) {
+			return s;
+		}
+		std::sort(samples.begin(), samples.end());
+		double sum = 0;
+		for (std::size_t i = 0; i < samples.size(); i++) {
+			sum += samples[i];
+		}
+		s.mean = sum / samples.size();
+		double var = 0;
+		for (std::size_t i = 0; i < samples.size(); i++) {
+			var += (samples[i] - s.mean) * (samples[i] - s.mean);
+		}
+		s.stddev = sqrt(var / samples.size());
+		s.min = samples.front();
+		s.median = perf_percentile(samples, 0.5);
+		s.p90 = perf_percentile(samples, 0.9);
+		s.p99 = perf_percentile(samples, 0.99);
+		return s;
+	};
+
+	/*
+	**	Perf_timer
+	**
+	**	Runs the body of a loop warmup times untimed, then repetitions times timed:
+	**
+	**		ft::perf_timer t(50, 5, 1000);
+	**		while (t.next()) {
+	**			v.clear();			// setup
+	**			t.start();
+	**			for (int i = 0; i < 1000; i++)
+	**				v.push_back(i);
+	**			t.stop();
+	**		}
+	**		ft::perf_stats s = t.stats();
+	**
+	**	start() and stop() are optional: without them the whole body is timed.
+	**	Each sample is divided by ops, the number of operations of one iteration.
+	**	With counters, the timer also sums the hardware events of the timed parts.
+	*/
+
+	class perf_timer
+	{
+		private:
+
+			std::size_t					_repetitions;
+			std::size_t					_warmup;
+			std::size_t					_ops;
+			std::size_t					_iteration;
+			long long						_start;
+			long long						_stop;
+			std::vector<double>	_samples;
+			const perf_counters	*_counters;
+			perf_reading				_begin;
+			perf_reading				_end;
+			double							_events[perf_event_count];
+
+		public:
+
+			explicit perf_timer( std::size_t repetitions = 15, std::size_t warmup = 2, std::size_t ops = 1, const perf_counters *counters = NULL )
+				: _repetitions(repetitions), _warmup(warmup), _ops(ops ? ops : 1), _iteration(0), _start(0), _stop(-1), _counters(counters) {
+				_samples.reserve(repetitions);
+				for (int e = 0; e < perf_event_count; e++) {
+					_events[e] = 0;
+				}
+			};
+
+			// Records the iteration that ends and returns whether another one runs
+			bool	next() {
+				if (_iteration > _warmup) {
+					long long end = _stop < 0 ? perf_now() : _stop;
+					_samples.push_back(static_cast<double>(end - _start) / _ops);
+					if (_counters) {
+						if (_stop < 0) {
+							_counters->read(_end);
+						}
+						for (int e = 0; e < perf_event_count; e++) {
+							_events[e] += perf_counters::delta(_begin, _end, e);
+						}
+					}
+				}
+				if (_iteration++ == _warmup + _repetitions) {
+					return false;
+				}
+				_stop = -1;
+				start();
+				return true;
+			};
+
+			void	start() {
+				if (_counters) {
+					_counters->read(_begin);
+				}
+				clobber_memory();
+				_start = perf_now();
+			};
+
+			void	stop() {
+				_stop = perf_now();
+				clobber_memory();
+				if (_counters) {
+					_counters->read(_end);
+				}
+			};
+
+			const std::vector<double>&	samples() const {
+				return _samples;
+			};
+
+			perf_stats	stats() const {
+				perf_stats s = perf_summarize(_samples);
+				for (int e = 0; _counters && !_samples.empty() && e < perf_event_count; e++) {
+					if (_counters->available(e)) {
+						s.events[e] = _events[e] / (_samples.size() * _ops);
+					}
+				}
+				return s;
+			};
+	};
+
+}; // namespace ft
+
+#endif /*PERF_HPP*/
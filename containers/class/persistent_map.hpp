@@ -0,0 +1,722 @@
+#pragma once
+
+#ifndef PERSISTENT_MAP_HPP
+# define PERSISTENT_MAP_HPP
+
+# include "utils.hpp"
+
+namespace ft {
+
+	template< typename T >
+	struct persistent_node
+	{
+		T									_data;
+		persistent_node		*_left;
+		persistent_node		*_right;
+		int								_height;
+		long							_refs;
+	};
+
+	/*
+	**	Persistent_map
+	**
+	**	Immutable AVL map whose versions share their nodes. insert(), insert_or_assign()
+	**	and erase() leave the map untouched and return a new version: only the nodes on
+	**	the search path are copied (path copying), so each version costs O(log n) memory
+	**	and every older version stays valid and readable. Copying a persistent_map is
+	**	a snapshot and costs O(1).
+	**
+	**	Nodes are reference counted (number of parents plus versions using them as root).
+	**	A node referenced once belongs to a single version and is updated in place, so
+	**	building a map with m = m.insert(x) only copies what another version still sees.
+	**	Reference counts are updated atomically: versions sharing nodes can be read and
+	**	destroyed from different threads, although a single persistent_map object must
+	**	not be assigned while another thread reads it.
+	*/
+
+	template < typename Key, typename T, typename Compare = std::less<Key>, typename Allocator = std::allocator<ft::pair<const Key, T> > >
+	class persistent_map
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef T																														mapped_type;
+			typedef typename ft::pair<const Key, T>															value_type;
+
+			typedef std::size_t																									size_type;
+			typedef std::ptrdiff_t																							difference_type;
+
+			typedef Compare																											key_compare;
+			typedef Allocator																										allocator_type;
+			typedef value_type&																									reference;
+			typedef const value_type&																						const_reference;
+
+			typedef typename allocator_type::pointer														pointer;
+			typedef typename allocator_type::const_pointer											const_pointer;
+
+		protected:
+
+			typedef persistent_node<value_type>																	tnode;
+			typedef typename allocator_type::template rebind<tnode>::other			node_alloc;
+
+		public:
+
+			typedef persistent_map_iterators<tnode, const value_type>						const_iterator;
+			typedef const_iterator																							iterator;
+			typedef ft::reverse_iterator<const_iterator>												const_reverse_iterator;
+			typedef const_reverse_iterator																			reverse_iterator;
+
+			/************************************/
+			/*****      MEMBER CLASSES      *****/
+			/************************************/
+
+			/*
+			**	Value_compare
+			**
+			**	Compares objects of type value_type (key-value pairs) by comparing
+			**	of the first components of the pairs.
+			*/
+
+			class value_compare : public std::binary_function<value_type, value_type, bool>
+			{
+				protected:
+
+					Compare comp;
+
+				public:
+
+					value_compare( Compare c )
+						: comp(c) {
+					};
+
+					bool operator()( const value_type& x, const value_type& y ) const {
+						return comp(x.first, y.first);
+					};
+			};
+
+		private:
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			node_alloc			_allocNode;
+			allocator_type	_alloc;
+			tnode						*_root;
+			size_type				_size;
+			Compare					_comp;
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+
+
+			/*
+			**	Constructors
+			**
+			**		1) Constructs an empty container.
+			**		2) Constructs the container with the contents of the range [first, last).
+			**		3) Copy constructor. Shares the nodes of other: O(1).
+			*/
+
+			explicit persistent_map( const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _allocNode(alloc), _alloc(alloc), _root(NULL), _size(0), _comp(comp) {
+			};
+
+			template< class InputIt >
+			persistent_map( InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _allocNode(alloc), _alloc(alloc), _root(NULL), _size(0), _comp(comp) {
+				for (; first != last; ++first) {
+					insert_version(*first);
+				}
+			};
+
+			persistent_map( const persistent_map& other )
+				: _allocNode(other._allocNode), _alloc(other._alloc), _root(acquire(other._root)), _size(other._size), _comp(other._comp) {
+			};
+
+
+			/*
+			**	Destructor
+			**
+			**	Drops this version. Nodes still used by another version are kept.
+			*/
+
+			~persistent_map() {
+				release(_root);
+			};
+
+
+			/*
+			**	Operator=
+			**
+			**	Makes this object the same version as other: O(1).
+			*/
+
+			persistent_map& operator=( const persistent_map& other ) {
+				tnode *root = acquire(other._root);
+				release(_root);
+				_root = root;
+				_size = other._size;
+				_comp = other._comp;
+				return *this;
+			};
+
+
+			/*
+			**	Snapshot
+			**
+			**	Returns the current version, sharing all its nodes: O(1).
+			*/
+
+			persistent_map snapshot() const {
+				return *this;
+			};
+
+
+			/*
+			**	Get_allocator
+			**
+			**	Returns the allocator associated with the container.
+			*/
+
+			allocator_type	get_allocator() const {
+				return _alloc;
+			};
+
+
+
+			/************************************/
+			/*****      ELEMENT ACCESS      *****/
+			/************************************/
+
+
+
+			/*
+			**	At
+			**
+			**	Returns a reference to the mapped value of the element with key equivalent to key.
+			**	If no such element exists, an exception of type std::out_of_range is thrown.
+			*/
+
+			const T& at( const Key& key ) const {
+				tnode *nd = find_node(key);
+				if (nd == NULL) {
+					throw std::out_of_range("Key not found");
+				}
+				return nd->_data.second;
+			};
+
+
+
+			/******************************/
+			/*****      ITERATOR      *****/
+			/******************************/
+
+
+
+			const_iterator begin() const {
+				const_iterator it(_root);
+				if (_root) {
+					it.push(_root);
+					it.push_spine(false);
+				}
+				return it;
+			};
+
+			const_iterator end() const {
+				return const_iterator(_root);
+			};
+
+			const_reverse_iterator rbegin() const {
+				return const_reverse_iterator(end());
+			};
+
+			const_reverse_iterator rend() const {
+				return const_reverse_iterator(begin());
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return _size == 0;
+			};
+
+			size_type	size() const {
+				return _size;
+			};
+
+			size_type	max_size() const {
+				return _allocNode.max_size();
+			};
+
+
+
+			/******************************/
+			/*****      VERSIONS      *****/
+			/******************************/
+
+
+
+			/*
+			**	Insert
+			**
+			**	Returns a version that also contains value, unless an element with an
+			**	equivalent key already exists, in which case the version is this one.
+			**	The range overload inserts every element of [first, last).
+			*/
+
+			persistent_map insert( const value_type& value ) const {
+				persistent_map version(*this);
+				version.insert_version(value);
+				return version;
+			};
+
+			template< class InputIt >
+			persistent_map insert( InputIt first, InputIt last ) const {
+				persistent_map version(*this);
+				for (; first != last; ++first) {
+					version.insert_version(*first);
+				}
+				return version;
+			};
+
+
+			/*
+			**	Insert_or_assign
+			**
+			**	Returns a version where key is mapped to obj, whether key was present or not.
+			*/
+
+			persistent_map insert_or_assign( const Key& key, const T& obj ) const {
+				persistent_map version(*this);
+				if (find_node(key)) {
+					version._root = version.assign_node(version._root, value_type(key, obj));
+				}
+				else {
+					version.insert_version(value_type(key, obj));
+				}
+				return version;
+			};
+
+
+			/*
+			**	Erase
+			**
+			**	Returns a version without the element with key equivalent to key, if any.
+			*/
+
+			persistent_map erase( const Key& key ) const {
+				persistent_map version(*this);
+				if (find_node(key)) {
+					version._root = version.erase_node(version._root, key);
+					version._size--;
+				}
+				return version;
+			};
+
+
+			/*
+			**	Clear
+			**
+			**	Returns an empty version.
+			*/
+
+			persistent_map clear() const {
+				return persistent_map(_comp, _alloc);
+			};
+
+
+			/*
+			**	Swap
+			**
+			**	Exchanges the versions held by this object and other.
+			*/
+
+			void swap( persistent_map& other ) {
+				std::swap(_root, other._root);
+				std::swap(_size, other._size);
+				std::swap(_comp, other._comp);
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			size_type count( const Key& key ) const {
+				return find_node(key) ? 1 : 0;
+			};
+
+			const_iterator find( const Key& key ) const {
+				const_iterator it(_root);
+				tnode *nd = _root;
+				while (nd != NULL) {
+					it.push(nd);
+					if (_comp(key, nd->_data.first)) {
+						nd = nd->_left;
+					}
+					else if (_comp(nd->_data.first, key)) {
+						nd = nd->_right;
+					}
+					else {
+						return it;
+					}
+				}
+				return end();
+			};
+
+			ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const {
+				return ft::pair<const_iterator,const_iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			const_iterator lower_bound( const Key& key ) const {
+				return bound(key, false);
+			};
+
+			const_iterator upper_bound( const Key& key ) const {
+				return bound(key, true);
+			};
+
+
+
+			/*******************************/
+			/*****      OBSERVERS      *****/
+			/*******************************/
+
+
+
+			key_compare key_comp() const {
+				return _comp;
+			};
+
+			value_compare value_comp() const {
+				return value_compare(_comp);
+			};
+
+
+
+			/***************************/
+			/*****      NODES      *****/
+			/***************************/
+
+
+
+		private:
+
+			int	max( int a, int b ) {
+				return (a > b) ? a : b;
+			};
+
+			int height( tnode *nd ) {
+				if (nd == NULL) {
+					return 0;
+				}
+				return nd->_height;
+			};
+
+			void update( tnode *nd ) {
+				nd->_height = max(height(nd->_left), height(nd->_right)) + 1;
+			};
+
+			int getBalanceFactor( tnode *nd ) {
+				if (nd == NULL) {
+					return 0;
+				}
+				return height(nd->_left) - height(nd->_right);
+			};
+
+			tnode *find_node( const Key& key ) const {
+				tnode *nd = _root;
+				while (nd != NULL) {
+					if (_comp(key, nd->_data.first)) {
+						nd = nd->_left;
+					}
+					else if (_comp(nd->_data.first, key)) {
+						nd = nd->_right;
+					}
+					else {
+						return nd;
+					}
+				}
+				return NULL;
+			};
+
+			// Path to the first element not less than (or greater than, if upper) key
+			const_iterator bound( const Key& key, bool upper ) const {
+				const_iterator it(_root);
+				tnode *nd = _root;
+				int depth = 0;
+				int found = 0;
+				while (nd != NULL) {
+					it.push(nd);
+					depth++;
+					if (upper ? _comp(key, nd->_data.first) : !_comp(nd->_data.first, key)) {
+						found = depth;
+						nd = nd->_left;
+					}
+					else {
+						nd = nd->_right;
+					}
+				}
+				it.truncate(found);
+				return it;
+			};
+
+			/* Reference counting
+			/ acquire() and release() add and remove a reference to a node, release()
+			/ freeing the node and releasing its children when the last one goes away.
+			/ own() turns a reference to a node into a reference to a node used by no
+			/ one else: the node itself if the reference is the only one, a copy otherwise.
+			/ Every function below takes and returns owned references, and only writes
+			/ to nodes obtained through own().
+			*/
+
+			static tnode *acquire( tnode *nd ) {
+				if (nd) {
+					__sync_add_and_fetch(&nd->_refs, 1);
+				}
+				return nd;
+			};
+
+			void release( tnode *nd ) {
+				while (nd && __sync_sub_and_fetch(&nd->_refs, 1) == 0) {
+					tnode *right = nd->_right;
+					release(nd->_left);
+					free_node(nd);
+					nd = right;
+				}
+			};
+
+			tnode *own( tnode *nd ) {
+				if (__sync_add_and_fetch(&nd->_refs, 0) == 1) {
+					return nd;
+				}
+				tnode *copy = new_node(nd->_data, acquire(nd->_left), acquire(nd->_right));
+				copy->_height = nd->_height;
+				release(nd);
+				return copy;
+			};
+
+			tnode	*new_node( const value_type& value, tnode *left, tnode *right ) {
+				tnode *nd = _allocNode.allocate(1);
+				nd->_left = left;
+				nd->_right = right;
+				nd->_refs = 1;
+				_alloc.construct(&nd->_data, value);
+				update(nd);
+				return nd;
+			};
+
+			void	free_node( tnode *nd ) {
+				_alloc.destroy(&nd->_data);
+				_allocNode.deallocate(nd, 1);
+			};
+
+			/* Rotations
+			/ Same rotations as ft::map, minus the parent links. The rotated node must
+			/ be owned; the child moving up is made owned before it is rewired.
+			*/
+
+			tnode *rightRotate( tnode *y ) {
+				tnode *x = own(y->_left);
+				tnode *xr = x->_right;
+
+				x->_right = y;
+				y->_left = xr;
+				update(y);
+				update(x);
+				return x;
+			};
+
+			tnode *leftRotate( tnode *x ) {
+				tnode *y = own(x->_right);
+				tnode *yl = y->_left;
+
+				y->_left = x;
+				x->_right = yl;
+				update(x);
+				update(y);
+				return y;
+			};
+
+			tnode *balance( tnode *root ) {
+				update(root);
+				int balanceFactor = getBalanceFactor(root);
+				if (balanceFactor > 1) {
+					if (getBalanceFactor(root->_left) >= 0) {
+						return rightRotate(root);
+					}
+					else {
+						root->_left = leftRotate(own(root->_left));
+						return rightRotate(root);
+					}
+				}
+				if (balanceFactor < -1)	{
+					if (getBalanceFactor(root->_right) <= 0) {
+						return leftRotate(root);
+					}
+					else {
+						root->_right = rightRotate(own(root->_right));
+						return leftRotate(root);
+					}
+				}
+				return root;
+			};
+
+			// Insert value in this version, return false if its key is already there
+			bool insert_version( const value_type& value ) {
+				if (find_node(value.first)) {
+					return false;
+				}
+				_root = insert_node(_root, value);
+				_size++;
+				return true;
+			};
+
+			tnode *insert_node( tnode *root, const value_type& value ) {
+				if (root == NULL) {
+					return new_node(value, NULL, NULL);
+				}
+				root = own(root);
+				if (_comp(value.first, root->_data.first)) {
+					root->_left = insert_node(root->_left, value);
+				}
+				else {
+					root->_right = insert_node(root->_right, value);
+				}
+				return balance(root);
+			};
+
+			// Replace the node holding the key of value, the shape of the tree does not change
+			tnode *assign_node( tnode *root, const value_type& value ) {
+				if (_comp(value.first, root->_data.first)) {
+					root = own(root);
+					root->_left = assign_node(root->_left, value);
+					return root;
+				}
+				if (_comp(root->_data.first, value.first)) {
+					root = own(root);
+					root->_right = assign_node(root->_right, value);
+					return root;
+				}
+				tnode *nd = new_node(value, acquire(root->_left), acquire(root->_right));
+				release(root);
+				return nd;
+			};
+
+			// Unlink the minimum of the subtree nd into min and return the rebalanced rest
+			tnode *detach_min( tnode *nd, tnode *&min ) {
+				nd = own(nd);
+				if (nd->_left == NULL) {
+					min = nd;
+					tnode *right = nd->_right;
+					nd->_right = NULL;
+					return right;
+				}
+				nd->_left = detach_min(nd->_left, min);
+				return balance(nd);
+			};
+
+			/* Delete a node in a recursive way
+			/ 1- The nodes above the key are made owned on the way down
+			/ 2- The node of the key is dropped, its children are kept;
+			/    if it had two, its in-order successor takes its place
+			/ 3- Check the balance and rotate if necessary on the way back
+			*/
+			tnode *erase_node( tnode *root, const Key& key ) {
+				if (_comp(key, root->_data.first)) {
+					root = own(root);
+					root->_left = erase_node(root->_left, key);
+					return balance(root);
+				}
+				if (_comp(root->_data.first, key)) {
+					root = own(root);
+					root->_right = erase_node(root->_right, key);
+					return balance(root);
+				}
+				tnode *left = acquire(root->_left);
+				tnode *right = acquire(root->_right);
+				release(root);
+				if (left == NULL || right == NULL) {
+					return left ? left : right;
+				}
+				tnode *succ = NULL;
+				right = detach_min(right, succ);
+				succ->_left = left;
+				succ->_right = right;
+				return balance(succ);
+			};
+
+	};
+
+	/******************************************/
+	/*****      NON-MEMBER FUNCTIONS      *****/
+	/******************************************/
+
+
+
+	/*
+	**	Operators
+	**
+	**	Compares the contents of two persistent_maps, like the ft::map operators.
+	*/
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator==( const ft::persistent_map<Key,T,Compare,Alloc>& lhs, const ft::persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator!=( const ft::persistent_map<Key,T,Compare,Alloc>& lhs, const ft::persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		return !(lhs == rhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<( const ft::persistent_map<Key,T,Compare,Alloc>& lhs, const ft::persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<=( const ft::persistent_map<Key,T,Compare,Alloc>& lhs, const ft::persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		return !(rhs < lhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>( const ft::persistent_map<Key,T,Compare,Alloc>& lhs, const ft::persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		return (rhs < lhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>=( const ft::persistent_map<Key,T,Compare,Alloc>& lhs, const ft::persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		return !(lhs < rhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	void swap( ft::persistent_map<Key,T,Compare,Alloc>& lhs, ft::persistent_map<Key,T,Compare,Alloc>& rhs ) {
+		lhs.swap(rhs);
+	};
+
+}; // namespace ft
+
+#endif /*PERSISTENT_MAP_HPP*/
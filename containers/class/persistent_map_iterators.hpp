@@ -0,0 +1,191 @@
+#pragma once
+
+#ifndef PERSISTENT_MAP_ITERATORS_HPP
+# define PERSISTENT_MAP_ITERATORS_HPP
+
+/*
+**	Maximum height of a persistent_map tree. An AVL tree of height 64 holds
+**	more than 2^44 elements, far beyond what fits in memory.
+*/
+
+# ifndef FT_PERSISTENT_MAX_HEIGHT
+#  define FT_PERSISTENT_MAX_HEIGHT 64
+# endif
+
+namespace ft {
+
+	/*
+	**	Persistent_map_iterators
+	**
+	**	Nodes of a persistent_map are shared between versions, so they have no parent
+	**	pointer: the iterator keeps the path from the root to the current node instead.
+	**	An empty path is the past-the-end iterator, which can still be decremented
+	**	since the root of the version is kept aside.
+	*/
+
+	template < typename node, typename T >
+		class persistent_map_iterators {
+
+			public:
+
+				/**********************************/
+				/*****      MEMBER TYPES      *****/
+				/**********************************/
+
+				typedef T                               	value_type;
+				typedef T*                              	pointer;
+				typedef T&                              	reference;
+				typedef std::ptrdiff_t                  	difference_type;
+				typedef std::size_t                     	size_type;
+				typedef std::bidirectional_iterator_tag 	iterator_category;
+
+			private:
+
+				/**************************************/
+				/*****      MEMBER ATTRIBUTES     *****/
+				/**************************************/
+
+				node	*_root;
+				node	*_path[FT_PERSISTENT_MAX_HEIGHT];
+				int		_depth;
+
+			public:
+
+				/**************************************/
+				/*****      MEMBER FUNCTIONS      *****/
+				/**************************************/
+
+				persistent_map_iterators()
+					: _root(NULL), _depth(0) {
+				};
+
+				explicit persistent_map_iterators( node *root )
+					: _root(root), _depth(0) {
+				};
+
+				persistent_map_iterators( const persistent_map_iterators &other )
+					: _root(other._root), _depth(other._depth) {
+					for (int i = 0; i < _depth; i++) {
+						_path[i] = other._path[i];
+					}
+				};
+
+				virtual ~persistent_map_iterators() {
+				};
+
+				persistent_map_iterators &operator=( const persistent_map_iterators &other ) {
+					if ( this != &other ) {
+						_root = other._root;
+						_depth = other._depth;
+						for (int i = 0; i < _depth; i++) {
+							_path[i] = other._path[i];
+						}
+					}
+					return *this;
+				};
+
+
+
+				/************************************/
+				/*****      ELEMENT ACCESS      *****/
+				/************************************/
+
+
+
+				reference operator*() const {
+					return _path[_depth - 1]->_data;
+				};
+
+				pointer operator->() const {
+					return &_path[_depth - 1]->_data;
+				};
+
+
+
+				/*******************************/
+				/*****      OPERATORS      *****/
+				/*******************************/
+
+
+
+				persistent_map_iterators& operator++() {
+					node *current = _path[_depth - 1];
+					if (current->_right) {
+						push(current->_right);
+						push_spine(false);
+					}
+					else {
+						while (_depth > 1 && _path[_depth - 2]->_right == _path[_depth - 1]) {
+							_depth--;
+						}
+						_depth--;
+					}
+					return *this;
+				};
+
+				persistent_map_iterators operator++(int) {
+					persistent_map_iterators temp = *this;
+					++(*this);
+					return temp;
+				};
+
+				persistent_map_iterators& operator--() {
+					if (_depth == 0) {
+						push(_root);
+						push_spine(true);
+					}
+					else if (_path[_depth - 1]->_left) {
+						push(_path[_depth - 1]->_left);
+						push_spine(true);
+					}
+					else {
+						while (_depth > 1 && _path[_depth - 2]->_left == _path[_depth - 1]) {
+							_depth--;
+						}
+						_depth--;
+					}
+					return *this;
+				};
+
+				persistent_map_iterators operator--(int) {
+					persistent_map_iterators temp = *this;
+					--(*this);
+					return temp;
+				};
+
+				// Append nd to the path
+				void	push( node *nd ) {
+					_path[_depth++] = nd;
+				};
+
+				// Drop the path below depth
+				void	truncate( int depth ) {
+					_depth = depth;
+				};
+
+				// Follow the left (or right) children from the current node down to a leaf
+				void	push_spine( bool right ) {
+					node *nd = right ? _path[_depth - 1]->_right : _path[_depth - 1]->_left;
+					while (nd) {
+						push(nd);
+						nd = right ? nd->_right : nd->_left;
+					}
+				};
+
+				friend bool operator==( const persistent_map_iterators& lhs, const persistent_map_iterators& rhs ) {
+					if (lhs._depth == 0 || rhs._depth == 0) {
+						return lhs._depth == rhs._depth;
+					}
+					return lhs._path[lhs._depth - 1] == rhs._path[rhs._depth - 1];
+				};
+
+				friend bool operator!=( const persistent_map_iterators& lhs, const persistent_map_iterators& rhs ) {
+					return !(lhs == rhs);
+				};
+
+		}; // persistent_map_iterators
+
+}; // namespace ft
+
+
+#endif /* PERSISTENT_MAP_ITERATORS_HPP */
@@ -0,0 +1,907 @@
+#pragma once
+
+#ifndef RADIX_MAP_HPP
+# define RADIX_MAP_HPP
+
+# include <cstring>
+# include <stdexcept>
+# include "utils.hpp"
+
+namespace ft {
+
+	/*
+	**	Radix_map
+	**
+	**	Ordered map for integral keys on an adaptive radix tree (see radix_node).
+	**	A key is turned into an unsigned code whose bytes, most significant first,
+	**	sort like the keys (the sign bit of signed keys is flipped), and the tree
+	**	branches on one byte per level: a lookup costs at most sizeof(Key) steps and
+	**	no key comparison until the leaf. Inner nodes grow from node4 to node256 and
+	**	shrink back as children come and go, so sparse and dense key sets both stay
+	**	compact; a node holding a single child is merged into it.
+	**	The leaves are chained in key order, which gives O(1) iterator steps and lets
+	**	insertions find their neighbours in the node where they branch off.
+	**	Inserting and erasing never move a value: iterators to the other elements stay valid.
+	*/
+
+	template < typename Key, typename T, typename Allocator = std::allocator<ft::pair<const Key, T> > >
+	class radix_map
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef T																														mapped_type;
+			typedef typename ft::pair<const Key, T>															value_type;
+
+			typedef std::size_t																									size_type;
+			typedef std::ptrdiff_t																							difference_type;
+
+			typedef std::less<Key>																							key_compare;
+			typedef Allocator																										allocator_type;
+			typedef value_type&																									reference;
+			typedef const value_type&																						const_reference;
+
+			typedef typename allocator_type::pointer														pointer;
+			typedef typename allocator_type::const_pointer											const_pointer;
+			typedef radix_map_iterators<radix_leaf<value_type>, value_type>			iterator;
+			typedef radix_map_iterators<radix_leaf<value_type>, const value_type>	const_iterator;
+			typedef ft::reverse_iterator<iterator>															reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>												const_reverse_iterator;
+
+		protected:
+
+			typedef radix_leaf<value_type>																			leaf;
+			typedef unsigned long long																					code_type;
+			typedef typename allocator_type::template rebind<leaf>::other				leaf_alloc;
+			typedef typename allocator_type::template rebind<radix_node4>::other	node4_alloc;
+			typedef typename allocator_type::template rebind<radix_node16>::other	node16_alloc;
+			typedef typename allocator_type::template rebind<radix_node48>::other	node48_alloc;
+			typedef typename allocator_type::template rebind<radix_node256>::other	node256_alloc;
+
+			// Compilation fails here when Key is not an integral type
+			typedef char	radix_map_requires_integral_key[ft::is_integral<Key>::value ? 1 : -1];
+
+		private:
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			allocator_type	_alloc;
+			leaf_alloc			_allocLeaf;
+			node4_alloc			_alloc4;
+			node16_alloc		_alloc16;
+			node48_alloc		_alloc48;
+			node256_alloc		_alloc256;
+			void						*_root;
+			leaf						*_end;
+			size_type				_size;
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+
+
+			/*
+			**	Constructors
+			**
+			**		1) Constructs an empty container.
+			**		2) Constructs the container with the contents of the range [first, last).
+			**		3) Copy constructor. Constructs the container with the copy of the contents of other.
+			*/
+
+			explicit radix_map( const Allocator& alloc = Allocator() )
+				: _alloc(alloc), _allocLeaf(alloc), _alloc4(alloc), _alloc16(alloc), _alloc48(alloc), _alloc256(alloc),
+				_root(NULL), _end(NULL), _size(0) {
+				initialize_end();
+			};
+
+			template< class InputIt >
+			radix_map( InputIt first, InputIt last, const Allocator& alloc = Allocator() )
+				: _alloc(alloc), _allocLeaf(alloc), _alloc4(alloc), _alloc16(alloc), _alloc48(alloc), _alloc256(alloc),
+				_root(NULL), _end(NULL), _size(0) {
+				initialize_end();
+				insert(first, last);
+			};
+
+			radix_map( const radix_map& other )
+				: _alloc(other._alloc), _allocLeaf(other._allocLeaf), _alloc4(other._alloc4), _alloc16(other._alloc16),
+				_alloc48(other._alloc48), _alloc256(other._alloc256), _root(NULL), _end(NULL), _size(0) {
+				initialize_end();
+				insert(other.begin(), other.end());
+			};
+
+
+			/*
+			**	Destructor
+			*/
+
+			~radix_map() {
+				clear();
+				_allocLeaf.deallocate(_end, 1);
+			};
+
+
+			/*
+			**	Operator=
+			**
+			**	Copy assignment operator. Replaces the contents with a copy of the contents of other.
+			*/
+
+			radix_map& operator=( const radix_map& other ) {
+				if (this != &other) {
+					clear();
+					insert(other.begin(), other.end());
+				}
+				return *this;
+			};
+
+			allocator_type	get_allocator() const {
+				return _alloc;
+			};
+
+
+
+			/************************************/
+			/*****      ELEMENT ACCESS      *****/
+			/************************************/
+
+
+
+			T& at( const Key& key ) {
+				leaf *l = find_leaf(encode(key));
+				if (l == NULL) {
+					throw std::out_of_range("radix_map::at: key not found");
+				}
+				return l->_data.second;
+			};
+
+			const T& at( const Key& key ) const {
+				leaf *l = find_leaf(encode(key));
+				if (l == NULL) {
+					throw std::out_of_range("radix_map::at: key not found");
+				}
+				return l->_data.second;
+			};
+
+			T& operator[]( const Key& key ) {
+				return insert(value_type(key, T())).first->second;
+			};
+
+
+
+			/******************************/
+			/*****      ITERATOR      *****/
+			/******************************/
+
+
+
+			iterator begin() {
+				return iterator(_end->_next);
+			};
+
+			const_iterator begin() const {
+				return const_iterator(_end->_next);
+			};
+
+			iterator end() {
+				return iterator(_end);
+			};
+
+			const_iterator end() const {
+				return const_iterator(_end);
+			};
+
+			reverse_iterator rbegin() {
+				return reverse_iterator(end());
+			};
+
+			const_reverse_iterator rbegin() const {
+				return const_reverse_iterator(end());
+			};
+
+			reverse_iterator rend() {
+				return reverse_iterator(begin());
+			};
+
+			const_reverse_iterator rend() const {
+				return const_reverse_iterator(begin());
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return _size == 0;
+			};
+
+			size_type	size() const {
+				return _size;
+			};
+
+			size_type	max_size() const {
+				return _allocLeaf.max_size();
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			void clear() {
+				free_subtree(_root);
+				_root = NULL;
+				_size = 0;
+				_end->_prev = _end;
+				_end->_next = _end;
+			};
+
+
+			/*
+			**	Insert
+			**
+			**	Inserts value if the container doesn't already contain an element with an equivalent key.
+			**	The tree is walked down byte by byte; the new leaf hangs either from the node
+			**	where its first distinct byte has no child yet, or from a new node4 that splits
+			**	a compressed prefix or a leaf. Its neighbours in key order come from the
+			**	smallest or largest leaf of a sibling in that same node.
+			**	The hint is ignored: the leaves keep no link to the nodes above them to
+			**	start from, and a descent costs at most sizeof(Key) byte steps anyway.
+			*/
+
+			pair<iterator, bool> insert( const value_type& value ) {
+				code_type code = encode(value.first);
+				void **ref = &_root;
+				int depth = 0;
+				for (;;) {
+					void *nd = *ref;
+					if (nd == NULL) {
+						leaf *l = new_leaf(value);
+						link_after(l, _end);
+						*ref = tag(l);
+						return pair<iterator, bool>(iterator(l), true);
+					}
+					if (is_leaf(nd)) {
+						leaf *old = to_leaf(nd);
+						code_type old_code = encode(old->_data.first);
+						if (old_code == code) {
+							return pair<iterator, bool>(iterator(old), false);
+						}
+						int p = 0;
+						while (byte(old_code, depth + p) == byte(code, depth + p)) {
+							p++;
+						}
+						leaf *l = new_leaf(value);
+						radix_node4 *n4 = new_node4(p, code, depth);
+						add_child4(n4, byte(old_code, depth + p), nd);
+						add_child4(n4, byte(code, depth + p), tag(l));
+						if (code < old_code) {
+							link_after(l, old->_prev);
+						}
+						else {
+							link_after(l, old);
+						}
+						*ref = n4;
+						return pair<iterator, bool>(iterator(l), true);
+					}
+					radix_inner *in = static_cast<radix_inner *>(nd);
+					int p = 0;
+					while (p < in->prefix_len && in->prefix[p] == byte(code, depth + p)) {
+						p++;
+					}
+					if (p < in->prefix_len) {
+						unsigned char old_byte = in->prefix[p];
+						leaf *l = new_leaf(value);
+						radix_node4 *n4 = new_node4(p, code, depth);
+						in->prefix_len -= p + 1;
+						std::memmove(in->prefix, in->prefix + p + 1, in->prefix_len);
+						add_child4(n4, old_byte, in);
+						add_child4(n4, byte(code, depth + p), tag(l));
+						if (byte(code, depth + p) < old_byte) {
+							link_after(l, min_leaf(in)->_prev);
+						}
+						else {
+							link_after(l, max_leaf(in));
+						}
+						*ref = n4;
+						return pair<iterator, bool>(iterator(l), true);
+					}
+					depth += in->prefix_len;
+					unsigned char b = byte(code, depth);
+					void **slot = radix_find_child(in, b);
+					if (slot) {
+						ref = slot;
+						depth++;
+						continue;
+					}
+					leaf *l = new_leaf(value);
+					void *smaller = radix_prev_child(in, b);
+					if (smaller) {
+						link_after(l, max_leaf(smaller));
+					}
+					else {
+						link_after(l, min_leaf(radix_next_child(in, b))->_prev);
+					}
+					add_child(ref, in, b, tag(l));
+					return pair<iterator, bool>(iterator(l), true);
+				}
+			};
+
+			iterator	insert( iterator hint, const value_type& value ) {
+				(void)hint;
+				return insert(value).first;
+			};
+
+			template< class InputIt >
+			void insert( InputIt first, InputIt last ) {
+				for (; first != last; ++first) {
+					insert(*first);
+				}
+			};
+
+
+			/*
+			**	Erase
+			**
+			**	Removes the element at pos, the elements in [first, last), or the element
+			**	with key equivalent to key. Only the iterators to the erased elements are invalidated.
+			*/
+
+			void erase( iterator pos ) {
+				erase(pos->first);
+			};
+
+			void erase( iterator first, iterator last ) {
+				while (first != last) {
+					erase(first++);
+				}
+			};
+
+			size_type erase( const Key& key ) {
+				code_type code = encode(key);
+				void **ref = &_root;
+				void **parent_ref = NULL;
+				radix_inner *parent = NULL;
+				unsigned char parent_byte = 0;
+				int depth = 0;
+				for (;;) {
+					void *nd = *ref;
+					if (nd == NULL) {
+						return 0;
+					}
+					if (is_leaf(nd)) {
+						leaf *l = to_leaf(nd);
+						if (encode(l->_data.first) != code) {
+							return 0;
+						}
+						l->_prev->_next = l->_next;
+						l->_next->_prev = l->_prev;
+						free_leaf(l);
+						if (parent == NULL) {
+							_root = NULL;
+						}
+						else {
+							remove_child(parent_ref, parent, parent_byte);
+						}
+						return 1;
+					}
+					radix_inner *in = static_cast<radix_inner *>(nd);
+					depth += in->prefix_len;
+					unsigned char b = byte(code, depth);
+					void **slot = radix_find_child(in, b);
+					if (slot == NULL) {
+						return 0;
+					}
+					parent_ref = ref;
+					parent = in;
+					parent_byte = b;
+					ref = slot;
+					depth++;
+				}
+			};
+
+			void swap( radix_map& other ) {
+				std::swap(_root, other._root);
+				std::swap(_end, other._end);
+				std::swap(_size, other._size);
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			size_type count( const Key& key ) const {
+				return find_leaf(encode(key)) ? 1 : 0;
+			};
+
+
+			/*
+			**	Find
+			**
+			**	Follows one child per byte of the key; the compressed prefixes are skipped
+			**	without being checked, the leaf reached is compared with the key once.
+			*/
+
+			iterator find( const Key& key ) {
+				leaf *l = find_leaf(encode(key));
+				return iterator(l ? l : _end);
+			};
+
+			const_iterator find( const Key& key ) const {
+				leaf *l = find_leaf(encode(key));
+				return const_iterator(l ? l : _end);
+			};
+
+			ft::pair<iterator,iterator> equal_range( const Key& key ) {
+				return ft::pair<iterator,iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const {
+				return ft::pair<const_iterator,const_iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			iterator lower_bound( const Key& key ) {
+				return iterator(lower_bound_leaf(encode(key)));
+			};
+
+			const_iterator lower_bound( const Key& key ) const {
+				return const_iterator(lower_bound_leaf(encode(key)));
+			};
+
+			iterator upper_bound( const Key& key ) {
+				return iterator(upper_bound_leaf(encode(key)));
+			};
+
+			const_iterator upper_bound( const Key& key ) const {
+				return const_iterator(upper_bound_leaf(encode(key)));
+			};
+
+
+
+			/*******************************/
+			/*****      OBSERVERS      *****/
+			/*******************************/
+
+
+
+			key_compare key_comp() const {
+				return key_compare();
+			};
+
+
+
+			/*********************************/
+			/*****      RADIX TREE       *****/
+			/*********************************/
+
+		private:
+
+			// Unsigned code of key whose bytes, most significant first, sort like the keys
+			static code_type	encode( const Key& key ) {
+				code_type code = static_cast<code_type>(key);
+				if (Key(-1) < Key(1)) {
+					code ^= static_cast<code_type>(1) << (8 * sizeof(Key) - 1);
+				}
+				return code & (~static_cast<code_type>(0) >> (64 - 8 * sizeof(Key)));
+			};
+
+			// Byte of code at depth, 0 being the most significant byte of the key
+			static unsigned char	byte( code_type code, int depth ) {
+				return static_cast<unsigned char>(code >> (8 * (static_cast<int>(sizeof(Key)) - 1 - depth)));
+			};
+
+			static bool	is_leaf( const void *nd ) {
+				return reinterpret_cast<std::size_t>(nd) & 1;
+			};
+
+			static leaf	*to_leaf( void *nd ) {
+				return reinterpret_cast<leaf *>(reinterpret_cast<std::size_t>(nd) & ~static_cast<std::size_t>(1));
+			};
+
+			static void	*tag( leaf *l ) {
+				return reinterpret_cast<void *>(reinterpret_cast<std::size_t>(l) | 1);
+			};
+
+			static leaf	*min_leaf( void *nd ) {
+				while (!is_leaf(nd)) {
+					nd = radix_next_child(static_cast<radix_inner *>(nd), -1);
+				}
+				return to_leaf(nd);
+			};
+
+			static leaf	*max_leaf( void *nd ) {
+				while (!is_leaf(nd)) {
+					nd = radix_prev_child(static_cast<radix_inner *>(nd), 256);
+				}
+				return to_leaf(nd);
+			};
+
+			// Insert l in the list of leaves right after prev
+			static void	link_after( leaf *l, leaf *prev ) {
+				l->_prev = prev;
+				l->_next = prev->_next;
+				prev->_next->_prev = l;
+				prev->_next = l;
+			};
+
+			leaf	*find_leaf( code_type code ) const {
+				void *nd = _root;
+				int depth = 0;
+				while (nd != NULL) {
+					if (is_leaf(nd)) {
+						leaf *l = to_leaf(nd);
+						return encode(l->_data.first) == code ? l : NULL;
+					}
+					radix_inner *in = static_cast<radix_inner *>(nd);
+					depth += in->prefix_len;
+					void **slot = radix_find_child(in, byte(code, depth));
+					if (slot == NULL) {
+						return NULL;
+					}
+					nd = *slot;
+					depth++;
+				}
+				return NULL;
+			};
+
+			/* First leaf whose code is not less than code, or the sentinel
+			/ Once the key leaves the tree, at a prefix byte or at a missing child, the
+			/ answer is the smallest leaf of the first subtree on the right of the key,
+			/ which is the successor of the largest leaf on its left.
+			*/
+			leaf	*lower_bound_leaf( code_type code ) const {
+				void *nd = _root;
+				int depth = 0;
+				if (nd == NULL) {
+					return _end;
+				}
+				for (;;) {
+					if (is_leaf(nd)) {
+						leaf *l = to_leaf(nd);
+						return encode(l->_data.first) >= code ? l : l->_next;
+					}
+					radix_inner *in = static_cast<radix_inner *>(nd);
+					for (int i = 0; i < in->prefix_len; i++) {
+						unsigned char b = byte(code, depth + i);
+						if (in->prefix[i] != b) {
+							return in->prefix[i] > b ? min_leaf(in) : max_leaf(in)->_next;
+						}
+					}
+					depth += in->prefix_len;
+					unsigned char b = byte(code, depth);
+					void **slot = radix_find_child(in, b);
+					if (slot) {
+						nd = *slot;
+						depth++;
+						continue;
+					}
+					void *bigger = radix_next_child(in, b);
+					return bigger ? min_leaf(bigger) : max_leaf(in)->_next;
+				}
+			};
+
+			leaf	*upper_bound_leaf( code_type code ) const {
+				leaf *l = lower_bound_leaf(code);
+				if (l != _end && encode(l->_data.first) == code) {
+					return l->_next;
+				}
+				return l;
+			};
+
+			leaf	*new_leaf( const value_type& value ) {
+				leaf *l = _allocLeaf.allocate(1);
+				_alloc.construct(&l->_data, value);
+				_size++;
+				return l;
+			};
+
+			void	free_leaf( leaf *l ) {
+				_alloc.destroy(&l->_data);
+				_allocLeaf.deallocate(l, 1);
+				_size--;
+			};
+
+			// New node4 whose prefix is the p bytes of code from depth
+			radix_node4	*new_node4( int p, code_type code, int depth ) {
+				radix_node4 *n4 = _alloc4.allocate(1);
+				n4->type = radix_node4_type;
+				n4->count = 0;
+				n4->prefix_len = static_cast<unsigned char>(p);
+				for (int i = 0; i < p; i++) {
+					n4->prefix[i] = byte(code, depth + i);
+				}
+				return n4;
+			};
+
+			// Copy the header of from into a new node of type, with no children yet
+			template< class Node, class Alloc >
+			Node	*new_node( Alloc& alloc, unsigned char type, radix_inner *from ) {
+				Node *n = alloc.allocate(1);
+				static_cast<radix_inner&>(*n) = *from;
+				n->type = type;
+				n->count = 0;
+				return n;
+			};
+
+			void	free_node( radix_inner *in ) {
+				switch (in->type) {
+					case radix_node4_type:
+						_alloc4.deallocate(static_cast<radix_node4 *>(in), 1);
+						break;
+					case radix_node16_type:
+						_alloc16.deallocate(static_cast<radix_node16 *>(in), 1);
+						break;
+					case radix_node48_type:
+						_alloc48.deallocate(static_cast<radix_node48 *>(in), 1);
+						break;
+					default:
+						_alloc256.deallocate(static_cast<radix_node256 *>(in), 1);
+				}
+			};
+
+			void	free_subtree( void *nd ) {
+				if (nd == NULL) {
+					return;
+				}
+				if (is_leaf(nd)) {
+					free_leaf(to_leaf(nd));
+					return;
+				}
+				radix_inner *in = static_cast<radix_inner *>(nd);
+				void **children;
+				int slots;
+				switch (in->type) {
+					case radix_node4_type:
+						children = static_cast<radix_node4 *>(in)->children;
+						slots = in->count;
+						break;
+					case radix_node16_type:
+						children = static_cast<radix_node16 *>(in)->children;
+						slots = in->count;
+						break;
+					case radix_node48_type:
+						children = static_cast<radix_node48 *>(in)->children;
+						slots = 48;
+						break;
+					default:
+						children = static_cast<radix_node256 *>(in)->children;
+						slots = 256;
+				}
+				for (int i = 0; i < slots; i++) {
+					free_subtree(children[i]);
+				}
+				free_node(in);
+			};
+
+			// Insert child under b in the sorted arrays of a node4 or node16 that has room
+			template< class Node >
+			static void	add_sorted( Node *n, unsigned char b, void *child ) {
+				int i = n->count;
+				while (i > 0 && n->keys[i - 1] > b) {
+					n->keys[i] = n->keys[i - 1];
+					n->children[i] = n->children[i - 1];
+					i--;
+				}
+				n->keys[i] = b;
+				n->children[i] = child;
+				n->count++;
+			};
+
+			static void	add_child4( radix_node4 *n4, unsigned char b, void *child ) {
+				add_sorted(n4, b, child);
+			};
+
+			/* Add child under b to the node *ref
+			/ A full node is replaced by the next larger type, which takes over its prefix
+			/ and children, before the child is added.
+			*/
+			void	add_child( void **ref, radix_inner *in, unsigned char b, void *child ) {
+				switch (in->type) {
+					case radix_node4_type: {
+						radix_node4 *n4 = static_cast<radix_node4 *>(in);
+						if (n4->count < 4) {
+							return add_sorted(n4, b, child);
+						}
+						radix_node16 *n16 = new_node<radix_node16>(_alloc16, radix_node16_type, n4);
+						for (int i = 0; i < 4; i++) {
+							add_sorted(n16, n4->keys[i], n4->children[i]);
+						}
+						add_sorted(n16, b, child);
+						_alloc4.deallocate(n4, 1);
+						*ref = n16;
+						return;
+					}
+					case radix_node16_type: {
+						radix_node16 *n16 = static_cast<radix_node16 *>(in);
+						if (n16->count < 16) {
+							return add_sorted(n16, b, child);
+						}
+						radix_node48 *n48 = new_node<radix_node48>(_alloc48, radix_node48_type, n16);
+						std::memset(n48->index, 0, sizeof(n48->index));
+						std::memset(n48->children, 0, sizeof(n48->children));
+						for (int i = 0; i < 16; i++) {
+							n48->children[i] = n16->children[i];
+							n48->index[n16->keys[i]] = static_cast<unsigned char>(i + 1);
+						}
+						n48->count = 16;
+						_alloc16.deallocate(n16, 1);
+						*ref = n48;
+						return add_child(ref, n48, b, child);
+					}
+					case radix_node48_type: {
+						radix_node48 *n48 = static_cast<radix_node48 *>(in);
+						if (n48->count < 48) {
+							int slot = 0;
+							while (n48->children[slot]) {
+								slot++;
+							}
+							n48->children[slot] = child;
+							n48->index[b] = static_cast<unsigned char>(slot + 1);
+							n48->count++;
+							return;
+						}
+						radix_node256 *n256 = new_node<radix_node256>(_alloc256, radix_node256_type, n48);
+						std::memset(n256->children, 0, sizeof(n256->children));
+						for (int i = 0; i < 256; i++) {
+							if (n48->index[i]) {
+								n256->children[i] = n48->children[n48->index[i] - 1];
+							}
+						}
+						n256->count = 48;
+						_alloc48.deallocate(n48, 1);
+						*ref = n256;
+						return add_child(ref, n256, b, child);
+					}
+					default: {
+						radix_node256 *n256 = static_cast<radix_node256 *>(in);
+						n256->children[b] = child;
+						n256->count++;
+					}
+				}
+			};
+
+			template< class Node >
+			static void	remove_sorted( Node *n, unsigned char b ) {
+				int i = 0;
+				while (n->keys[i] != b) {
+					i++;
+				}
+				for (n->count--; i < n->count; i++) {
+					n->keys[i] = n->keys[i + 1];
+					n->children[i] = n->children[i + 1];
+				}
+			};
+
+			/* Remove the child under b from the node *ref
+			/ A node that becomes sparse enough is replaced by the next smaller type;
+			/ a node4 left with one child is replaced by that child, which prepends the
+			/ prefix of the node and the byte of the child to its own prefix.
+			*/
+			void	remove_child( void **ref, radix_inner *in, unsigned char b ) {
+				switch (in->type) {
+					case radix_node4_type: {
+						radix_node4 *n4 = static_cast<radix_node4 *>(in);
+						remove_sorted(n4, b);
+						if (n4->count > 1) {
+							return;
+						}
+						void *child = n4->children[0];
+						if (!is_leaf(child)) {
+							radix_inner *c = static_cast<radix_inner *>(child);
+							int shift = n4->prefix_len + 1;
+							std::memmove(c->prefix + shift, c->prefix, c->prefix_len);
+							std::memcpy(c->prefix, n4->prefix, n4->prefix_len);
+							c->prefix[n4->prefix_len] = n4->keys[0];
+							c->prefix_len = static_cast<unsigned char>(c->prefix_len + shift);
+						}
+						_alloc4.deallocate(n4, 1);
+						*ref = child;
+						return;
+					}
+					case radix_node16_type: {
+						radix_node16 *n16 = static_cast<radix_node16 *>(in);
+						remove_sorted(n16, b);
+						if (n16->count > 3) {
+							return;
+						}
+						radix_node4 *n4 = new_node<radix_node4>(_alloc4, radix_node4_type, n16);
+						for (int i = 0; i < n16->count; i++) {
+							add_sorted(n4, n16->keys[i], n16->children[i]);
+						}
+						_alloc16.deallocate(n16, 1);
+						*ref = n4;
+						return;
+					}
+					case radix_node48_type: {
+						radix_node48 *n48 = static_cast<radix_node48 *>(in);
+						n48->children[n48->index[b] - 1] = NULL;
+						n48->index[b] = 0;
+						n48->count--;
+						if (n48->count > 12) {
+							return;
+						}
+						radix_node16 *n16 = new_node<radix_node16>(_alloc16, radix_node16_type, n48);
+						for (int i = 0; i < 256; i++) {
+							if (n48->index[i]) {
+								add_sorted(n16, static_cast<unsigned char>(i), n48->children[n48->index[i] - 1]);
+							}
+						}
+						_alloc48.deallocate(n48, 1);
+						*ref = n16;
+						return;
+					}
+					default: {
+						radix_node256 *n256 = static_cast<radix_node256 *>(in);
+						n256->children[b] = NULL;
+						n256->count--;
+						if (n256->count > 40) {
+							return;
+						}
+						radix_node48 *n48 = new_node<radix_node48>(_alloc48, radix_node48_type, n256);
+						std::memset(n48->index, 0, sizeof(n48->index));
+						std::memset(n48->children, 0, sizeof(n48->children));
+						for (int i = 0; i < 256; i++) {
+							if (n256->children[i]) {
+								n48->children[n48->count] = n256->children[i];
+								n48->index[i] = static_cast<unsigned char>(++n48->count);
+							}
+						}
+						_alloc256.deallocate(n256, 1);
+						*ref = n48;
+					}
+				}
+			};
+
+			// The sentinel leaf holds no value, it only closes the list of leaves
+			void	initialize_end() {
+				_end = _allocLeaf.allocate(1);
+				_end->_prev = _end;
+				_end->_next = _end;
+			};
+
+	};
+
+	/******************************************/
+	/*****      NON-MEMBER FUNCTIONS      *****/
+	/******************************************/
+
+
+
+	template< class Key, class T, class Alloc >
+	bool operator==( const ft::radix_map<Key,T,Alloc>& lhs, const ft::radix_map<Key,T,Alloc>& rhs ) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	};
+
+	template< class Key, class T, class Alloc >
+	bool operator!=( const ft::radix_map<Key,T,Alloc>& lhs, const ft::radix_map<Key,T,Alloc>& rhs ) {
+		return !(lhs == rhs);
+	};
+
+	template< class Key, class T, class Alloc >
+	void swap( ft::radix_map<Key,T,Alloc>& lhs, ft::radix_map<Key,T,Alloc>& rhs ) {
+		lhs.swap(rhs);
+	};
+
+}; // namespace ft
+
+#endif /*RADIX_MAP_HPP*/
@@ -0,0 +1,135 @@
+#pragma once
+
+#ifndef RADIX_MAP_ITERATORS_HPP
+# define RADIX_MAP_ITERATORS_HPP
+
+namespace ft {
+
+	/*
+	**	Radix_map_iterators
+	**
+	**	Bidirectional iterator over the leaves of a radix_map. The leaves form a
+	**	circular list in key order through a sentinel leaf, the past-the-end
+	**	iterator: incrementing and decrementing never walk the tree.
+	*/
+
+	template < typename Leaf, typename T >
+		class radix_map_iterators {
+
+			public:
+
+				/**********************************/
+				/*****      MEMBER TYPES      *****/
+				/**********************************/
+
+				typedef T                               	value_type;
+				typedef T*                              	pointer;
+				typedef T&                              	reference;
+				typedef std::ptrdiff_t                  	difference_type;
+				typedef std::size_t                     	size_type;
+				typedef std::bidirectional_iterator_tag 	iterator_category;
+
+			private:
+
+				/**************************************/
+				/*****      MEMBER ATTRIBUTES     *****/
+				/**************************************/
+
+				Leaf	*_leaf;
+
+			public:
+
+				/**************************************/
+				/*****      MEMBER FUNCTIONS      *****/
+				/**************************************/
+
+				radix_map_iterators()
+					: _leaf(NULL) {
+				};
+
+				radix_map_iterators( Leaf *leaf )
+					: _leaf(leaf) {
+				};
+
+				radix_map_iterators( const radix_map_iterators &other )
+					: _leaf(other._leaf) {
+				};
+
+				virtual ~radix_map_iterators() {
+				};
+
+				radix_map_iterators &operator=( const radix_map_iterators &other ) {
+					if ( this != &other ) {
+						_leaf = other._leaf;
+					}
+					return *this;
+				};
+
+
+
+				/************************************/
+				/*****      ELEMENT ACCESS      *****/
+				/************************************/
+
+
+
+				operator radix_map_iterators<Leaf, T const>() const {
+					return radix_map_iterators<Leaf, T const>(_leaf);
+				};
+
+				reference operator*() const {
+					return _leaf->_data;
+				};
+
+				pointer operator->() const {
+					return &_leaf->_data;
+				};
+
+
+
+				/*******************************/
+				/*****      OPERATORS      *****/
+				/*******************************/
+
+
+
+				radix_map_iterators& operator++() {
+					_leaf = _leaf->_next;
+					return *this;
+				};
+
+				radix_map_iterators operator++(int) {
+					radix_map_iterators temp = *this;
+					++(*this);
+					return temp;
+				};
+
+				radix_map_iterators& operator--() {
+					_leaf = _leaf->_prev;
+					return *this;
+				};
+
+				radix_map_iterators operator--(int) {
+					radix_map_iterators temp = *this;
+					--(*this);
+					return temp;
+				};
+
+				Leaf	*getleaf() const {
+					return _leaf;
+				};
+
+				friend bool operator==( const radix_map_iterators& lhs, const radix_map_iterators& rhs ) {
+					return lhs._leaf == rhs._leaf;
+				};
+
+				friend bool operator!=( const radix_map_iterators& lhs, const radix_map_iterators& rhs ) {
+					return !(lhs == rhs);
+				};
+
+		}; // radix_map_iterators
+
+}; // namespace ft
+
+
+#endif /* RADIX_MAP_ITERATORS_HPP */
@@ -0,0 +1,222 @@
+#pragma once
+
+#ifndef RADIX_NODE_HPP
+# define RADIX_NODE_HPP
+
+# include <cstddef>
+
+# ifdef __SSE2__
+#  include <emmintrin.h>
+# endif
+
+/*
+**	Radix_node
+**
+**	Nodes of ft::radix_map, an adaptive radix tree. A key is read as a string of
+**	bytes, most significant first, and every inner node branches on one byte.
+**	Inner nodes adapt their layout to their number of children:
+**		- node4 and node16: sorted arrays of up to 4 or 16 bytes and children,
+**		 node16 is searched with one SSE2 compare of its 16 bytes.
+**		- node48: a 256-entry index from byte to one of 48 child slots.
+**		- node256: 256 children indexed by the byte.
+**	An inner node also holds the bytes shared by every key below it (path
+**	compression): keys are at most 8 bytes so the whole prefix always fits.
+**	Children are inner nodes or leaves; a leaf pointer has its low bit set.
+**	Leaves hold the values and are chained in key order.
+*/
+
+namespace ft {
+
+	static const unsigned char	radix_node4_type = 0;
+	static const unsigned char	radix_node16_type = 1;
+	static const unsigned char	radix_node48_type = 2;
+	static const unsigned char	radix_node256_type = 3;
+	static const int						radix_max_prefix = 8;
+
+	struct radix_inner
+	{
+		unsigned char		type;
+		unsigned char		prefix_len;
+		unsigned short	count;
+		unsigned char		prefix[radix_max_prefix];
+	};
+
+	struct radix_node4 : radix_inner
+	{
+		unsigned char	keys[4];
+		void					*children[4];
+	};
+
+	struct radix_node16 : radix_inner
+	{
+		unsigned char	keys[16];
+		void					*children[16];
+	};
+
+	struct radix_node48 : radix_inner
+	{
+		unsigned char	index[256];
+		void					*children[48];
+	};
+
+	struct radix_node256 : radix_inner
+	{
+		void					*children[256];
+	};
+
+	template< typename T >
+	struct radix_leaf
+	{
+		T						_data;
+		radix_leaf	*_prev;
+		radix_leaf	*_next;
+	};
+
+	// Index of byte b in the sorted bytes of a node16, or -1
+	inline int	radix_node16_find( const unsigned char *keys, int count, unsigned char b ) {
+# ifdef __SSE2__
+		__m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(b)), _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys)));
+		int mask = _mm_movemask_epi8(cmp) & ((1 << count) - 1);
+		return mask ? __builtin_ctz(mask) : -1;
+# else
+		for (int i = 0; i < count; i++) {
+			if (keys[i] == b) {
+				return i;
+			}
+		}
+		return -1;
+# endif
+	};
+
+	// Index of the first byte greater than b in the sorted bytes of a node16, or count
+	inline int	radix_node16_upper( const unsigned char *keys, int count, unsigned char b ) {
+# ifdef __SSE2__
+		// Unsigned bytes are compared as signed ones once their sign bit is flipped
+		__m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+		__m128i k = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(b)), bias);
+		__m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys)), bias);
+		int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(v, k)) & ((1 << count) - 1);
+		return mask ? __builtin_ctz(mask) : count;
+# else
+		int i = 0;
+		while (i < count && keys[i] <= b) {
+			i++;
+		}
+		return i;
+# endif
+	};
+
+	// Slot of the child of n for byte b, or NULL
+	inline void	**radix_find_child( radix_inner *n, unsigned char b ) {
+		switch (n->type) {
+			case radix_node4_type: {
+				radix_node4 *n4 = static_cast<radix_node4 *>(n);
+				for (int i = 0; i < n4->count; i++) {
+					if (n4->keys[i] == b) {
+						return n4->children + i;
+					}
+				}
+				return NULL;
+			}
+			case radix_node16_type: {
+				radix_node16 *n16 = static_cast<radix_node16 *>(n);
+				int i = radix_node16_find(n16->keys, n16->count, b);
+				return i < 0 ? NULL : n16->children + i;
+			}
+			case radix_node48_type: {
+				radix_node48 *n48 = static_cast<radix_node48 *>(n);
+				return n48->index[b] ? n48->children + n48->index[b] - 1 : NULL;
+			}
+			default: {
+				radix_node256 *n256 = static_cast<radix_node256 *>(n);
+				return n256->children[b] ? n256->children + b : NULL;
+			}
+		}
+	};
+
+	// Child of n with the smallest byte greater than b (-1 for the first child), or NULL
+	inline void	*radix_next_child( radix_inner *n, int b ) {
+		switch (n->type) {
+			case radix_node4_type: {
+				radix_node4 *n4 = static_cast<radix_node4 *>(n);
+				for (int i = 0; i < n4->count; i++) {
+					if (n4->keys[i] > b) {
+						return n4->children[i];
+					}
+				}
+				return NULL;
+			}
+			case radix_node16_type: {
+				radix_node16 *n16 = static_cast<radix_node16 *>(n);
+				if (b < 0) {
+					return n16->children[0];
+				}
+				int i = radix_node16_upper(n16->keys, n16->count, static_cast<unsigned char>(b));
+				return i < n16->count ? n16->children[i] : NULL;
+			}
+			case radix_node48_type: {
+				radix_node48 *n48 = static_cast<radix_node48 *>(n);
+				for (int i = b + 1; i < 256; i++) {
+					if (n48->index[i]) {
+						return n48->children[n48->index[i] - 1];
+					}
+				}
+				return NULL;
+			}
+			default: {
+				radix_node256 *n256 = static_cast<radix_node256 *>(n);
+				for (int i = b + 1; i < 256; i++) {
+					if (n256->children[i]) {
+						return n256->children[i];
+					}
+				}
+				return NULL;
+			}
+		}
+	};
+
+	// Child of n with the greatest byte less than b (256 for the last child), or NULL
+	inline void	*radix_prev_child( radix_inner *n, int b ) {
+		switch (n->type) {
+			case radix_node4_type: {
+				radix_node4 *n4 = static_cast<radix_node4 *>(n);
+				for (int i = n4->count - 1; i >= 0; i--) {
+					if (n4->keys[i] < b) {
+						return n4->children[i];
+					}
+				}
+				return NULL;
+			}
+			case radix_node16_type: {
+				radix_node16 *n16 = static_cast<radix_node16 *>(n);
+				for (int i = n16->count - 1; i >= 0; i--) {
+					if (n16->keys[i] < b) {
+						return n16->children[i];
+					}
+				}
+				return NULL;
+			}
+			case radix_node48_type: {
+				radix_node48 *n48 = static_cast<radix_node48 *>(n);
+				for (int i = b - 1; i >= 0; i--) {
+					if (n48->index[i]) {
+						return n48->children[n48->index[i] - 1];
+					}
+				}
+				return NULL;
+			}
+			default: {
+				radix_node256 *n256 = static_cast<radix_node256 *>(n);
+				for (int i = b - 1; i >= 0; i--) {
+					if (n256->children[i]) {
+						return n256->children[i];
+					}
+				}
+				return NULL;
+			}
+		}
+	};
+
+}; // namespace ft
+
+#endif /* RADIX_NODE_HPP */
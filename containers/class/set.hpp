@@ -0,0 +1,376 @@
+#pragma once
+
+#ifndef SET_HPP
+# define SET_HPP
+
+# include "utils.hpp"
+
+namespace ft {
+
+	/*
+	**	Set
+	**
+	**	Sorted set of unique keys on the AVL tree shared with ft::map.
+	**	A node stores only the key: no mapped value and no pair.
+	**	Keys cannot be modified through an iterator, so iterator and const_iterator
+	**	are the same type.
+	*/
+
+	template < typename Key, typename Compare = std::less<Key>, typename Allocator = std::allocator<Key> >
+	class set
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef Key																													value_type;
+
+			typedef std::size_t																									size_type;
+			typedef std::ptrdiff_t																							difference_type;
+
+			typedef Compare																											key_compare;
+			typedef Compare																											value_compare;
+			typedef Allocator																										allocator_type;
+			typedef value_type&																									reference;
+			typedef const value_type&																						const_reference;
+
+			typedef typename allocator_type::pointer														pointer;
+			typedef typename allocator_type::const_pointer											const_pointer;
+			typedef tree_iterators<tree_node<value_type>, const value_type>			iterator;
+			typedef tree_iterators<tree_node<value_type>, const value_type>			const_iterator;
+			typedef ft::reverse_iterator<iterator>															reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>												const_reverse_iterator;
+
+		protected:
+
+			typedef tree<Key, value_type, identity<value_type>, Compare, Allocator, true>	tree_type;
+
+		private:
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			tree_type				_tree;
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+
+
+			/*
+			**	Constructors
+			**
+			**	1) Constructs an empty container.
+			**	2) Constructs the container with the contents of the range [first, last).
+			**	3) Copy constructor.
+			*/
+
+			explicit set( const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _tree(comp, alloc) {
+			};
+
+			template< class InputIt >
+			set( InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _tree(comp, alloc) {
+				insert(first, last);
+			};
+
+			set( const set& other )
+				: _tree(other._tree) {
+			};
+
+			~set() {
+			};
+
+			set& operator=( const set& other ) {
+				_tree = other._tree;
+				return *this;
+			};
+
+			allocator_type	get_allocator() const {
+				return _tree.get_allocator();
+			};
+
+
+
+			/******************************/
+			/*****      ITERATOR      *****/
+			/******************************/
+
+
+
+			iterator begin() const {
+				return const_cast<const tree_type&>(_tree).begin();
+			};
+
+			iterator end() const {
+				return const_cast<const tree_type&>(_tree).end();
+			};
+
+			reverse_iterator rbegin() const {
+				return reverse_iterator(end());
+			};
+
+			reverse_iterator rend() const {
+				return reverse_iterator(begin());
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return _tree.empty();
+			};
+
+			size_type	size() const {
+				return _tree.size();
+			};
+
+			size_type	max_size() const {
+				return _tree.max_size();
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			void clear() {
+				_tree.clear();
+			};
+
+
+			/*
+			**	Insert
+			**
+			**	Inserts value if the container doesn't already contain an equivalent key.
+			**	Returns an iterator to the inserted element, or to the element that prevented
+			**	the insertion, and whether the insertion took place.
+			*/
+
+			pair<iterator, bool> insert( const value_type& value ) {
+				pair<typename tree_type::iterator, bool> ret = _tree.insert(value);
+				return pair<iterator, bool>(ret.first, ret.second);
+			};
+
+			iterator	insert( iterator hint, const value_type& value ) {
+				return _tree.insert(hint, value).first;
+			};
+
+			template< class InputIt >
+			void insert( InputIt first, InputIt last ) {
+				_tree.insert(first, last);
+			};
+
+
+			/*
+			**	Erase
+			**
+			**	Removes the element at pos, the elements in [first, last),
+			**	or the element equivalent to key. Other iterators are not affected.
+			*/
+
+			void erase( iterator pos ) {
+				_tree.erase(pos);
+			};
+
+			void erase( iterator first, iterator last ) {
+				_tree.erase(first, last);
+			};
+
+			size_type erase( const Key& key ) {
+				return _tree.erase(key);
+			};
+
+			void swap( set& other ) {
+				_tree.swap(other._tree);
+			};
+
+
+			// Moves every element to one contiguous block, see map::compact(); invalidates every iterator
+			void compact( compact_layout layout = compact_in_order ) {
+				_tree.compact(layout);
+			};
+
+
+
+			/************************************/
+			/*****      SPLIT AND JOIN      *****/
+			/************************************/
+
+
+
+			/*
+			**	Split and join
+			**
+			**	Same as ft::map::split and ft::map::join: split moves the keys not less than key
+			**	into greater in O(log n), with FT_MAP_ORDER_STATISTICS only, join moves every
+			**	key of a set whose keys are all greater, or all less, than the keys of *this.
+			*/
+
+# ifdef FT_MAP_ORDER_STATISTICS
+			void split( const Key& key, set& greater ) {
+				_tree.split(key, greater._tree);
+			};
+# endif
+
+			void join( set& other ) {
+				_tree.join(other._tree, "set::join: key ranges overlap");
+			};
+
+
+
+			/************************************/
+			/*****      SET OPERATIONS      *****/
+			/************************************/
+
+
+
+			/*
+			**	Set operations
+			**
+			**	Same as the ft::map set operations, on keys.
+			*/
+
+			void merge( set& other ) {
+				_tree.merge(other._tree);
+			};
+
+			void set_union( set& other ) {
+				_tree.set_union(other._tree);
+			};
+
+			void set_intersection( set& other ) {
+				_tree.set_intersection(other._tree);
+			};
+
+			void set_difference( set& other ) {
+				_tree.set_difference(other._tree);
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			size_type count( const Key& key ) const {
+				return _tree.count(key);
+			};
+
+			iterator find( const Key& key ) const {
+				return const_cast<const tree_type&>(_tree).find(key);
+			};
+
+			ft::pair<iterator,iterator> equal_range( const Key& key ) const {
+				return ft::pair<iterator,iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			iterator lower_bound( const Key& key ) const {
+				return const_cast<const tree_type&>(_tree).lower_bound(key);
+			};
+
+			iterator upper_bound( const Key& key ) const {
+				return const_cast<const tree_type&>(_tree).upper_bound(key);
+			};
+
+
+
+			/**************************************/
+			/*****      ORDER STATISTICS      *****/
+			/**************************************/
+
+
+
+			iterator nth( size_type k ) const {
+				return const_cast<const tree_type&>(_tree).nth(k);
+			};
+
+			size_type rank( const Key& key ) const {
+				return _tree.rank(key);
+			};
+
+			size_type count_range( const Key& lo, const Key& hi ) const {
+				return _tree.count_range(lo, hi);
+			};
+
+
+
+			/*******************************/
+			/*****      OBSERVERS      *****/
+			/*******************************/
+
+
+
+			key_compare key_comp() const {
+				return _tree.key_comp();
+			};
+
+			value_compare value_comp() const {
+				return _tree.key_comp();
+			};
+
+	};
+
+	/******************************************/
+	/*****      NON-MEMBER FUNCTIONS      *****/
+	/******************************************/
+
+
+
+	template< class Key, class Compare, class Alloc >
+	bool operator==( const ft::set<Key,Compare,Alloc>& lhs, const ft::set<Key,Compare,Alloc>& rhs ) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator!=( const ft::set<Key,Compare,Alloc>& lhs, const ft::set<Key,Compare,Alloc>& rhs ) {
+		return !(lhs == rhs);
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator<( const ft::set<Key,Compare,Alloc>& lhs, const ft::set<Key,Compare,Alloc>& rhs ) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator<=( const ft::set<Key,Compare,Alloc>& lhs, const ft::set<Key,Compare,Alloc>& rhs ) {
+		return !(rhs < lhs);
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator>( const ft::set<Key,Compare,Alloc>& lhs, const ft::set<Key,Compare,Alloc>& rhs ) {
+		return (rhs < lhs);
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator>=( const ft::set<Key,Compare,Alloc>& lhs, const ft::set<Key,Compare,Alloc>& rhs ) {
+		return !(lhs < rhs);
+	};
+
+	template< class Key, class Compare, class Alloc >
+	void swap( ft::set<Key,Compare,Alloc>& lhs, ft::set<Key,Compare,Alloc>& rhs ) {
+		lhs.swap(rhs);
+	};
+
+}; // namespace ft
+
+#endif /*SET_HPP*/
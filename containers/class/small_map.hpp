@@ -0,0 +1,565 @@
+#pragma once
+
+#ifndef SMALL_MAP_HPP
+# define SMALL_MAP_HPP
+
+# include <stdexcept>
+# include "utils.hpp"
+
+namespace ft {
+
+	/*
+	**	Small_map
+	**
+	**	Sorted key-value pairs stored inline, in a sorted array of N elements inside the
+	**	object, until an insertion finds the array full: the elements then move to an
+	**	ft::map, which holds them from then on (until clear()). A small map costs no
+	**	allocation at all, and its lookups scan a few contiguous elements.
+	**	The interface is the one of ft::map. While the map is small, insert and erase
+	**	shift the following elements and invalidate the iterators to them, like a vector;
+	**	the move to the tree invalidates every iterator. Once in the tree, iterators
+	**	behave as with ft::map.
+	*/
+
+	template < typename Key, typename T, std::size_t N = 8, typename Compare = std::less<Key>,
+		typename Allocator = std::allocator<ft::pair<const Key, T> > >
+	class small_map
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef T																														mapped_type;
+			typedef typename ft::pair<const Key, T>															value_type;
+
+			typedef std::size_t																									size_type;
+			typedef std::ptrdiff_t																							difference_type;
+
+			typedef Compare																											key_compare;
+			typedef Allocator																										allocator_type;
+			typedef value_type&																									reference;
+			typedef const value_type&																						const_reference;
+
+			typedef typename allocator_type::pointer														pointer;
+			typedef typename allocator_type::const_pointer											const_pointer;
+			typedef small_map_iterators<tree_node<value_type>, value_type>				iterator;
+			typedef small_map_iterators<tree_node<value_type>, const value_type>	const_iterator;
+			typedef ft::reverse_iterator<iterator>															reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>												const_reverse_iterator;
+
+		protected:
+
+			typedef ft::map<Key, T, Compare, Allocator>													map_type;
+			typedef typename allocator_type::template rebind<map_type>::other		map_alloc;
+
+		public:
+
+			/************************************/
+			/*****      MEMBER CLASSES      *****/
+			/************************************/
+
+			class value_compare : public std::binary_function<value_type, value_type, bool>
+			{
+				protected:
+
+					Compare comp;
+
+				public:
+
+					value_compare( Compare c )
+						: comp(c) {
+					};
+
+					bool operator()( const value_type& x, const value_type& y ) const {
+						return comp(x.first, y.first);
+					};
+			};
+
+		private:
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			// Raw storage for the inline elements, aligned for any of them
+			union storage
+			{
+				char				_bytes[N * sizeof(value_type)];
+				long double	_alignDouble;
+				long long		_alignLong;
+				void				*_alignPointer;
+			};
+
+			allocator_type	_alloc;
+			Compare					_comp;
+			map_type				*_tree;
+			size_type				_size;
+			storage					_inline;
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+
+
+			/*
+			**	Constructors
+			**
+			**		1) Constructs an empty container.
+			**		2) Constructs the container with the contents of the range [first, last).
+			**		3) Copy constructor. Constructs the container with the copy of the contents of other.
+			*/
+
+			explicit small_map( const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _alloc(alloc), _comp(comp), _tree(NULL), _size(0) {
+			};
+
+			template< class InputIt >
+			small_map( InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _alloc(alloc), _comp(comp), _tree(NULL), _size(0) {
+				insert(first, last);
+			};
+
+			small_map( const small_map& other )
+				: _alloc(other._alloc), _comp(other._comp), _tree(NULL), _size(0) {
+				insert(other.begin(), other.end());
+			};
+
+
+			/*
+			**	Destructor
+			*/
+
+			~small_map() {
+				clear();
+			};
+
+
+			/*
+			**	Operator=
+			**
+			**	Copy assignment operator. Replaces the contents with a copy of the contents of other.
+			*/
+
+			small_map& operator=( const small_map& other ) {
+				if (this != &other) {
+					clear();
+					_comp = other._comp;
+					insert(other.begin(), other.end());
+				}
+				return *this;
+			};
+
+			allocator_type	get_allocator() const {
+				return _alloc;
+			};
+
+			// True while the elements are stored inline
+			bool	is_small() const {
+				return _tree == NULL;
+			};
+
+
+
+			/************************************/
+			/*****      ELEMENT ACCESS      *****/
+			/************************************/
+
+
+
+			T& at( const Key& key ) {
+				iterator it = find(key);
+				if (it == end()) {
+					throw std::out_of_range("Key not found");
+				}
+				return it->second;
+			};
+
+			const T& at( const Key& key ) const {
+				const_iterator it = find(key);
+				if (it == end()) {
+					throw std::out_of_range("Key not found");
+				}
+				return it->second;
+			};
+
+			T& operator[]( const Key& key ) {
+				return insert(value_type(key, T())).first->second;
+			};
+
+
+
+			/******************************/
+			/*****      ITERATOR      *****/
+			/******************************/
+
+
+
+			iterator begin() {
+				return _tree ? iterator(_tree->begin()) : iterator(data());
+			};
+
+			const_iterator begin() const {
+				return _tree ? const_iterator(_tree->begin()) : const_iterator(data());
+			};
+
+			iterator end() {
+				return _tree ? iterator(_tree->end()) : iterator(data() + _size);
+			};
+
+			const_iterator end() const {
+				return _tree ? const_iterator(_tree->end()) : const_iterator(data() + _size);
+			};
+
+			reverse_iterator rbegin() {
+				return reverse_iterator(end());
+			};
+
+			const_reverse_iterator rbegin() const {
+				return const_reverse_iterator(end());
+			};
+
+			reverse_iterator rend() {
+				return reverse_iterator(begin());
+			};
+
+			const_reverse_iterator rend() const {
+				return const_reverse_iterator(begin());
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return size() == 0;
+			};
+
+			size_type	size() const {
+				return _tree ? _tree->size() : _size;
+			};
+
+			size_type	max_size() const {
+				return map_type(_comp, _alloc).max_size();
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			// Destroys every element and goes back to the inline array
+			void clear() {
+				if (_tree) {
+					map_alloc alloc_map(_alloc);
+					alloc_map.destroy(_tree);
+					alloc_map.deallocate(_tree, 1);
+					_tree = NULL;
+				}
+				for (size_type i = 0; i < _size; i++) {
+					_alloc.destroy(data() + i);
+				}
+				_size = 0;
+			};
+
+
+			/*
+			**	Insert
+			**
+			**	Inserts value if the container doesn't already contain an element with an equivalent key.
+			**	A small map shifts the greater elements one slot up; when the array is
+			**	full, every element moves to the tree first.
+			*/
+
+			pair<iterator, bool> insert( const value_type& value ) {
+				if (_tree == NULL) {
+					size_type i = lower_index(value.first);
+					if (i < _size && !_comp(value.first, data()[i].first)) {
+						return pair<iterator, bool>(iterator(data() + i), false);
+					}
+					if (_size < N) {
+						value_type *d = data();
+						for (size_type j = _size; j > i; j--) {
+							_alloc.construct(d + j, d[j - 1]);
+							_alloc.destroy(d + j - 1);
+						}
+						_alloc.construct(d + i, value);
+						_size++;
+						return pair<iterator, bool>(iterator(d + i), true);
+					}
+					grow();
+				}
+				ft::pair<typename map_type::iterator, bool> ins = _tree->insert(value);
+				return pair<iterator, bool>(iterator(ins.first), ins.second);
+			};
+
+			iterator	insert( iterator hint, const value_type& value ) {
+				if (_tree && hint.getptr() == NULL) {
+					return iterator(_tree->insert(hint.getnode(), value));
+				}
+				return insert(value).first;
+			};
+
+			template< class InputIt >
+			void insert( InputIt first, InputIt last ) {
+				for (; first != last; ++first) {
+					insert(end(), *first);
+				}
+			};
+
+
+			/*
+			**	Erase
+			**
+			**	Removes the element at pos, the elements in [first, last), or the element
+			**	with key equivalent to key. A small map shifts the greater elements down.
+			*/
+
+			void erase( iterator pos ) {
+				if (_tree) {
+					_tree->erase(pos.getnode());
+					return;
+				}
+				erase_slots(pos.getptr() - data(), 1);
+			};
+
+			void erase( iterator first, iterator last ) {
+				if (_tree) {
+					_tree->erase(first.getnode(), last.getnode());
+					return;
+				}
+				erase_slots(first.getptr() - data(), last.getptr() - first.getptr());
+			};
+
+			size_type erase( const Key& key ) {
+				if (_tree) {
+					return _tree->erase(key);
+				}
+				size_type i = lower_index(key);
+				if (i == _size || _comp(key, data()[i].first)) {
+					return 0;
+				}
+				erase_slots(i, 1);
+				return 1;
+			};
+
+			// Pointer swap once both maps are in their tree, element copies otherwise
+			void swap( small_map& other ) {
+				if (_tree && other._tree) {
+					std::swap(_tree, other._tree);
+					std::swap(_comp, other._comp);
+					return;
+				}
+				small_map temp(other);
+				other = *this;
+				*this = temp;
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			size_type count( const Key& key ) const {
+				return find(key) == end() ? 0 : 1;
+			};
+
+			iterator find( const Key& key ) {
+				if (_tree) {
+					return iterator(_tree->find(key));
+				}
+				size_type i = lower_index(key);
+				if (i == _size || _comp(key, data()[i].first)) {
+					return end();
+				}
+				return iterator(data() + i);
+			};
+
+			const_iterator find( const Key& key ) const {
+				if (_tree) {
+					return const_iterator(const_cast<const map_type *>(_tree)->find(key));
+				}
+				size_type i = lower_index(key);
+				if (i == _size || _comp(key, data()[i].first)) {
+					return end();
+				}
+				return const_iterator(data() + i);
+			};
+
+			ft::pair<iterator,iterator> equal_range( const Key& key ) {
+				return ft::pair<iterator,iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const {
+				return ft::pair<const_iterator,const_iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			iterator lower_bound( const Key& key ) {
+				if (_tree) {
+					return iterator(_tree->lower_bound(key));
+				}
+				return iterator(data() + lower_index(key));
+			};
+
+			const_iterator lower_bound( const Key& key ) const {
+				if (_tree) {
+					return const_iterator(const_cast<const map_type *>(_tree)->lower_bound(key));
+				}
+				return const_iterator(data() + lower_index(key));
+			};
+
+			iterator upper_bound( const Key& key ) {
+				if (_tree) {
+					return iterator(_tree->upper_bound(key));
+				}
+				return iterator(data() + upper_index(key));
+			};
+
+			const_iterator upper_bound( const Key& key ) const {
+				if (_tree) {
+					return const_iterator(const_cast<const map_type *>(_tree)->upper_bound(key));
+				}
+				return const_iterator(data() + upper_index(key));
+			};
+
+
+
+			/*******************************/
+			/*****      OBSERVERS      *****/
+			/*******************************/
+
+
+
+			key_compare key_comp() const {
+				return _comp;
+			};
+
+			value_compare value_comp() const {
+				return value_compare(_comp);
+			};
+
+
+
+			/**********************************/
+			/*****      INLINE ARRAY      *****/
+			/**********************************/
+
+		private:
+
+			value_type	*data() {
+				return reinterpret_cast<value_type *>(_inline._bytes);
+			};
+
+			const value_type	*data() const {
+				return reinterpret_cast<const value_type *>(_inline._bytes);
+			};
+
+			// Index of the first inline element whose key is not less than key; a linear
+			// scan beats a binary search on so few elements
+			size_type	lower_index( const Key& key ) const {
+				const value_type *d = data();
+				size_type i = 0;
+				while (i < _size && _comp(d[i].first, key)) {
+					i++;
+				}
+				return i;
+			};
+
+			size_type	upper_index( const Key& key ) const {
+				const value_type *d = data();
+				size_type i = 0;
+				while (i < _size && !_comp(key, d[i].first)) {
+					i++;
+				}
+				return i;
+			};
+
+			// Remove n inline elements from index i and shift the following ones down
+			void	erase_slots( size_type i, size_type n ) {
+				value_type *d = data();
+				for (size_type j = i; j < i + n; j++) {
+					_alloc.destroy(d + j);
+				}
+				for (size_type j = i + n; j < _size; j++) {
+					_alloc.construct(d + j - n, d[j]);
+					_alloc.destroy(d + j);
+				}
+				_size -= n;
+			};
+
+			// Move the inline elements, already sorted, to a new tree
+			void	grow() {
+				map_alloc alloc_map(_alloc);
+				map_type *tree = alloc_map.allocate(1);
+				alloc_map.construct(tree, map_type(_comp, _alloc));
+				value_type *d = data();
+				for (size_type i = 0; i < _size; i++) {
+					tree->insert(tree->end(), d[i]);
+					_alloc.destroy(d + i);
+				}
+				_size = 0;
+				_tree = tree;
+			};
+
+	};
+
+	/******************************************/
+	/*****      NON-MEMBER FUNCTIONS      *****/
+	/******************************************/
+
+
+
+	template< class Key, class T, std::size_t N, class Compare, class Alloc >
+	bool operator==( const ft::small_map<Key,T,N,Compare,Alloc>& lhs, const ft::small_map<Key,T,N,Compare,Alloc>& rhs ) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	};
+
+	template< class Key, class T, std::size_t N, class Compare, class Alloc >
+	bool operator!=( const ft::small_map<Key,T,N,Compare,Alloc>& lhs, const ft::small_map<Key,T,N,Compare,Alloc>& rhs ) {
+		return !(lhs == rhs);
+	};
+
+	template< class Key, class T, std::size_t N, class Compare, class Alloc >
+	bool operator<( const ft::small_map<Key,T,N,Compare,Alloc>& lhs, const ft::small_map<Key,T,N,Compare,Alloc>& rhs ) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	};
+
+	template< class Key, class T, std::size_t N, class Compare, class Alloc >
+	bool operator<=( const ft::small_map<Key,T,N,Compare,Alloc>& lhs, const ft::small_map<Key,T,N,Compare,Alloc>& rhs ) {
+		return !(rhs < lhs);
+	};
+
+	template< class Key, class T, std::size_t N, class Compare, class Alloc >
+	bool operator>( const ft::small_map<Key,T,N,Compare,Alloc>& lhs, const ft::small_map<Key,T,N,Compare,Alloc>& rhs ) {
+		return (rhs < lhs);
+	};
+
+	template< class Key, class T, std::size_t N, class Compare, class Alloc >
+	bool operator>=( const ft::small_map<Key,T,N,Compare,Alloc>& lhs, const ft::small_map<Key,T,N,Compare,Alloc>& rhs ) {
+		return !(lhs < rhs);
+	};
+
+	template< class Key, class T, std::size_t N, class Compare, class Alloc >
+	void swap( ft::small_map<Key,T,N,Compare,Alloc>& lhs, ft::small_map<Key,T,N,Compare,Alloc>& rhs ) {
+		lhs.swap(rhs);
+	};
+
+}; // namespace ft
+
+#endif /*SMALL_MAP_HPP*/
@@ -0,0 +1,159 @@
+#pragma once
+
+#ifndef SMALL_MAP_ITERATORS_HPP
+# define SMALL_MAP_ITERATORS_HPP
+
+namespace ft {
+
+	/*
+	**	Small_map_iterators
+	**
+	**	Bidirectional iterator over a small_map: a pointer into the inline array while
+	**	the map is small, a tree iterator once it has moved to its ft::map (_ptr is
+	**	then NULL).
+	*/
+
+	template < typename Node, typename T >
+		class small_map_iterators {
+
+			public:
+
+				/**********************************/
+				/*****      MEMBER TYPES      *****/
+				/**********************************/
+
+				typedef T                               	value_type;
+				typedef T*                              	pointer;
+				typedef T&                              	reference;
+				typedef std::ptrdiff_t                  	difference_type;
+				typedef std::size_t                     	size_type;
+				typedef std::bidirectional_iterator_tag 	iterator_category;
+				typedef tree_iterators<Node, T>						tree_iterator;
+
+			private:
+
+				/**************************************/
+				/*****      MEMBER ATTRIBUTES     *****/
+				/**************************************/
+
+				T							*_ptr;
+				tree_iterator	_node;
+
+			public:
+
+				/**************************************/
+				/*****      MEMBER FUNCTIONS      *****/
+				/**************************************/
+
+				small_map_iterators()
+					: _ptr(NULL), _node() {
+				};
+
+				small_map_iterators( T *ptr )
+					: _ptr(ptr), _node() {
+				};
+
+				small_map_iterators( const tree_iterator& node )
+					: _ptr(NULL), _node(node) {
+				};
+
+				small_map_iterators( const small_map_iterators &other )
+					: _ptr(other._ptr), _node(other._node) {
+				};
+
+				virtual ~small_map_iterators() {
+				};
+
+				small_map_iterators &operator=( const small_map_iterators &other ) {
+					if ( this != &other ) {
+						_ptr = other._ptr;
+						_node = other._node;
+					}
+					return *this;
+				};
+
+
+
+				/************************************/
+				/*****      ELEMENT ACCESS      *****/
+				/************************************/
+
+
+
+				operator small_map_iterators<Node, T const>() const {
+					if (_ptr) {
+						return small_map_iterators<Node, T const>(_ptr);
+					}
+					return small_map_iterators<Node, T const>(tree_iterators<Node, T const>(_node));
+				};
+
+				reference operator*() const {
+					return _ptr ? *_ptr : *_node;
+				};
+
+				pointer operator->() const {
+					return _ptr ? _ptr : &*_node;
+				};
+
+
+
+				/*******************************/
+				/*****      OPERATORS      *****/
+				/*******************************/
+
+
+
+				small_map_iterators& operator++() {
+					if (_ptr) {
+						++_ptr;
+					}
+					else {
+						++_node;
+					}
+					return *this;
+				};
+
+				small_map_iterators operator++(int) {
+					small_map_iterators temp = *this;
+					++(*this);
+					return temp;
+				};
+
+				small_map_iterators& operator--() {
+					if (_ptr) {
+						--_ptr;
+					}
+					else {
+						--_node;
+					}
+					return *this;
+				};
+
+				small_map_iterators operator--(int) {
+					small_map_iterators temp = *this;
+					--(*this);
+					return temp;
+				};
+
+				T	*getptr() const {
+					return _ptr;
+				};
+
+				const tree_iterator&	getnode() const {
+					return _node;
+				};
+
+				friend bool operator==( const small_map_iterators& lhs, const small_map_iterators& rhs ) {
+					return lhs._ptr == rhs._ptr && lhs._node == rhs._node;
+				};
+
+				friend bool operator!=( const small_map_iterators& lhs, const small_map_iterators& rhs ) {
+					return !(lhs == rhs);
+				};
+
+		}; // small_map_iterators
+
+}; // namespace ft
+
+
+#endif /* SMALL_MAP_ITERATORS_HPP */
@@ -0,0 +1,88 @@
+#pragma once
+
+#ifndef SWISS_GROUP_HPP
+# define SWISS_GROUP_HPP
+
+# ifdef __SSE2__
+#  include <emmintrin.h>
+# endif
+
+/*
+**	Swiss_group
+**
+**	Control bytes of ft::unordered_map. Every slot of the table has one control byte:
+**		- empty (0x80) and deleted (0xFE) have their sign bit set,
+**		- a full slot stores the 7 low bits of the hash of its key (h2), 0 to 127.
+**	The table is probed by groups of 16 slots: a swiss_group loads the 16 control
+**	bytes of a group and answers each question with a 16-bit mask, bit i standing
+**	for slot i of the group. With SSE2 each answer is a compare and a movemask;
+**	without it the same masks are built one byte at a time.
+*/
+
+namespace ft {
+
+	static const signed char	swiss_empty = -128;
+	static const signed char	swiss_deleted = -2;
+	static const int					swiss_width = 16;
+
+	struct swiss_group
+	{
+# ifdef __SSE2__
+		__m128i	ctrl;
+
+		explicit swiss_group( const signed char *pos )
+			: ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {
+		};
+
+		// Slots whose h2 is hash
+		int	match( signed char hash ) const {
+			return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(hash)));
+		};
+
+		int	match_empty() const {
+			return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(swiss_empty)));
+		};
+
+		int	match_empty_or_deleted() const {
+			return _mm_movemask_epi8(ctrl);
+		};
+
+		int	match_full() const {
+			return ~_mm_movemask_epi8(ctrl) & 0xFFFF;
+		};
+# else
+		const signed char	*ctrl;
+
+		explicit swiss_group( const signed char *pos )
+			: ctrl(pos) {
+		};
+
+		int	match( signed char hash ) const {
+			int mask = 0;
+			for (int i = 0; i < swiss_width; i++) {
+				mask |= (ctrl[i] == hash) << i;
+			}
+			return mask;
+		};
+
+		int	match_empty() const {
+			return match(swiss_empty);
+		};
+
+		int	match_empty_or_deleted() const {
+			int mask = 0;
+			for (int i = 0; i < swiss_width; i++) {
+				mask |= (ctrl[i] < 0) << i;
+			}
+			return mask;
+		};
+
+		int	match_full() const {
+			return ~match_empty_or_deleted() & 0xFFFF;
+		};
+# endif
+	};
+
+}; // namespace ft
+
+#endif /* SWISS_GROUP_HPP */
@@ -0,0 +1,454 @@
+#pragma once
+
+#ifndef TRACE_HPP
+# define TRACE_HPP
+
+# include <iostream>
+# include <algorithm>
+# include <cstddef>
+# include <cstdio>
+
+namespace ft {
+
+	/*
+	**	Trace
+	**
+	**	Operation sequences of one container, recorded in a service and replayed
+	**	offline, see bench/replay_bench.cpp. A trace is the magic "FTTR", a version
+	**	byte and the kind of the container, then one event per operation: the
+	**	operation byte, the key and the value. Keys and values are signed integers,
+	**	zigzag then varint encoded, so small ones take one byte: most events hold in
+	**	three to six bytes. Only containers of integral keys and values can be recorded.
+	*/
+
+	enum trace_container
+	{
+		trace_map = 1,
+		trace_vector,
+		trace_stack
+	};
+
+	/*
+	**	Trace_op
+	**
+	**		- map: insert, assign (operator[]), find, erase and iterate by key.
+	**		- vector: insert and erase at the index in key, push, pop, at and iterate.
+	**		- stack: push, pop and top.
+	**		- map and vector: clear.
+	*/
+
+	enum trace_op
+	{
+		trace_insert = 1,
+		trace_assign,
+		trace_find,
+		trace_erase,
+		trace_iterate,
+		trace_push,
+		trace_pop,
+		trace_at,
+		trace_top,
+		trace_clear,
+		trace_op_end
+	};
+
+	struct trace_event
+	{
+		trace_op		op;
+		long long		key;
+		long long		value;
+	};
+
+	/*
+	**	Trace_writer
+	**
+	**	Writes the header on construction, then one event per record(). The stream
+	**	must be opened in binary mode and outlive the writer.
+	*/
+
+	class trace_writer
+	{
+		private:
+
+			std::ostream	*_out;
+			std::size_t		_events;
+
+			trace_writer( const trace_writer& );
+			trace_writer& operator=( const trace_writer& );
+
+			void	put_varint( long long n ) {
+				unsigned long long z = (static_cast<unsigned long long>(n) << 1) ^ static_cast<unsigned long long>(n >> 63);
+				while (z >= 0x80) {
+					_out->put(static_cast<char>((z & 0x7f) | 0x80));
+					z >>= 7;
+				}
+				_out->put(static_cast<char>(z));
+			};
+
+		public:
+
+			trace_writer( std::ostream& out, trace_container container )
+				: _out(&out), _events(0) {
+				_out->write("FTTR", 4);
+				_out->put(1);
+				_out->put(static_cast<char>(container));
+			};
+
+			void	record( trace_op op, long long key = 0, long long value = 0 ) {
+				_out->put(static_cast<char>(op));
+				put_varint(key);
+				put_varint(value);
+				_events++;
+			};
+
+			std::size_t	events() const {
+				return _events;
+			};
+	};
+
+	/*
+	**	Trace_reader
+	**
+	**	Reads the header on construction: error() tells why a stream is not a
+	**	trace. next() then returns the events in order, false at the end of the
+	**	trace or on a truncated or unknown event, which error() reports too.
+	*/
+
+	class trace_reader
+	{
+		private:
+
+			std::istream		*_in;
+			trace_container	_container;
+			const char			*_error;
+
+			trace_reader( const trace_reader& );
+			trace_reader& operator=( const trace_reader& );
+
+			bool	get_varint( long long& n ) {
+				unsigned long long z = 0;
+				for (int shift = 0; shift < 64; shift += 7) {
+					int c = _in->get();
+					if (c == EOF) {
+						return false;
+					}
+					z |= static_cast<unsigned long long>(c & 0x7f) << shift;
+					if (!(c & 0x80)) {
+						n = static_cast<long long>(z >> 1) ^ -static_cast<long long>(z & 1);
+						return true;
+					}
+				}
+				return false;
+			};
+
+		public:
+
+			explicit trace_reader( std::istream& in )
+				: _in(&in), _container(trace_map), _error(NULL) {
+				char header[6];
+				if (!_in->read(header, 6) || !std::equal(header, header + 4, "FTTR")) {
+					_error = "not a trace";
+				}
+				else if (header[4] != 1) {
+					_error = "unknown trace version";
+				}
+				else if (header[5] < trace_map || header[5] > trace_stack) {
+					_error = "unknown container";
+				}
+				else {
+					_container = static_cast<trace_container>(header[5]);
+				}
+			};
+
+			const char	*error() const {
+				return _error;
+			};
+
+			trace_container	container() const {
+				return _container;
+			};
+
+			bool	next( trace_event& event ) {
+				if (_error) {
+					return false;
+				}
+				int op = _in->get();
+				if (op == EOF) {
+					return false;
+				}
+				if (op < trace_insert || op >= trace_op_end) {
+					_error = "unknown operation";
+					return false;
+				}
+				event.op = static_cast<trace_op>(op);
+				if (!get_varint(event.key) || !get_varint(event.value)) {
+					_error = "truncated event";
+					return false;
+				}
+				return true;
+			};
+	};
+
+	/*
+	**	Recording_map
+	**
+	**	Forwards the operations to a map and records them. apply() replays one event
+	**	on any map, ft:: or std::, and returns a value that depends on its result,
+	**	for the replay to keep. Erase and find of missing keys are replayed as such.
+	*/
+
+	template < class Map >
+	class recording_map
+	{
+		public:
+
+			typedef typename Map::key_type			key_type;
+			typedef typename Map::mapped_type		mapped_type;
+			typedef typename Map::value_type		value_type;
+			typedef typename Map::iterator			iterator;
+			typedef typename Map::size_type			size_type;
+
+		private:
+
+			Map						*_map;
+			trace_writer	*_trace;
+
+		public:
+
+			recording_map( Map& map, trace_writer& trace )
+				: _map(&map), _trace(&trace) {
+			};
+
+			typename Map::iterator	find( const key_type& key ) {
+				_trace->record(trace_find, key);
+				return _map->find(key);
+			};
+
+			void	insert( const value_type& value ) {
+				_trace->record(trace_insert, value.first, value.second);
+				_map->insert(value);
+			};
+
+			void	assign( const key_type& key, const mapped_type& value ) {
+				_trace->record(trace_assign, key, value);
+				(*_map)[key] = value;
+			};
+
+			size_type	erase( const key_type& key ) {
+				_trace->record(trace_erase, key);
+				return _map->erase(key);
+			};
+
+			template < class Function >
+			Function	for_each( Function f ) {
+				_trace->record(trace_iterate);
+				return std::for_each(_map->begin(), _map->end(), f);
+			};
+
+			void	clear() {
+				_trace->record(trace_clear);
+				_map->clear();
+			};
+
+			Map&	container() const {
+				return *_map;
+			};
+
+			static long long	apply( Map& map, const trace_event& e ) {
+				long long sum = 0;
+				typename Map::iterator it;
+				switch (e.op) {
+					case trace_insert:
+						return map.insert(value_type(static_cast<key_type>(e.key), static_cast<mapped_type>(e.value))).second;
+					case trace_assign:
+						map[static_cast<key_type>(e.key)] = static_cast<mapped_type>(e.value);
+						return 0;
+					case trace_find:
+						it = map.find(static_cast<key_type>(e.key));
+						return it == map.end() ? -1 : static_cast<long long>(it->second);
+					case trace_erase:
+						return map.erase(static_cast<key_type>(e.key));
+					case trace_iterate:
+						for (it = map.begin(); it != map.end(); ++it) {
+							sum += it->second;
+						}
+						return sum;
+					case trace_clear:
+						map.clear();
+						return 0;
+					default:
+						return 0;
+				}
+			};
+	};
+
+	/*
+	**	Recording_vector
+	**
+	**	Same for a vector, positions recorded as indexes. apply() ignores the
+	**	events whose index is out of the vector, which only a broken trace holds.
+	*/
+
+	template < class Vector >
+	class recording_vector
+	{
+		public:
+
+			typedef typename Vector::value_type			value_type;
+			typedef typename Vector::size_type			size_type;
+			typedef typename Vector::reference			reference;
+
+		private:
+
+			Vector				*_vec;
+			trace_writer	*_trace;
+
+		public:
+
+			recording_vector( Vector& vec, trace_writer& trace )
+				: _vec(&vec), _trace(&trace) {
+			};
+
+			void	push_back( const value_type& value ) {
+				_trace->record(trace_push, 0, value);
+				_vec->push_back(value);
+			};
+
+			void	pop_back() {
+				_trace->record(trace_pop);
+				_vec->pop_back();
+			};
+
+			reference	at( size_type index ) {
+				_trace->record(trace_at, index);
+				return _vec->at(index);
+			};
+
+			void	insert( size_type index, const value_type& value ) {
+				_trace->record(trace_insert, index, value);
+				_vec->insert(_vec->begin() + index, value);
+			};
+
+			void	erase( size_type index ) {
+				_trace->record(trace_erase, index);
+				_vec->erase(_vec->begin() + index);
+			};
+
+			template < class Function >
+			Function	for_each( Function f ) {
+				_trace->record(trace_iterate);
+				return std::for_each(_vec->begin(), _vec->end(), f);
+			};
+
+			void	clear() {
+				_trace->record(trace_clear);
+				_vec->clear();
+			};
+
+			Vector&	container() const {
+				return *_vec;
+			};
+
+			static long long	apply( Vector& vec, const trace_event& e ) {
+				long long sum = 0;
+				size_type index = static_cast<size_type>(e.key);
+				switch (e.op) {
+					case trace_push:
+						vec.push_back(static_cast<value_type>(e.value));
+						return 0;
+					case trace_pop:
+						if (!vec.empty()) {
+							vec.pop_back();
+						}
+						return 0;
+					case trace_at:
+						return index < vec.size() ? static_cast<long long>(vec[index]) : -1;
+					case trace_insert:
+						if (index <= vec.size()) {
+							vec.insert(vec.begin() + index, static_cast<value_type>(e.value));
+						}
+						return 0;
+					case trace_erase:
+						if (index < vec.size()) {
+							vec.erase(vec.begin() + index);
+						}
+						return 0;
+					case trace_iterate:
+						for (typename Vector::iterator it = vec.begin(); it != vec.end(); ++it) {
+							sum += *it;
+						}
+						return sum;
+					case trace_clear:
+						vec.clear();
+						return 0;
+					default:
+						return 0;
+				}
+			};
+	};
+
+	/*
+	**	Recording_stack
+	**
+	**	Same for a stack. apply() ignores pop and top on an empty stack.
+	*/
+
+	template < class Stack >
+	class recording_stack
+	{
+		public:
+
+			typedef typename Stack::value_type			value_type;
+			typedef typename Stack::reference				reference;
+
+		private:
+
+			Stack					*_stack;
+			trace_writer	*_trace;
+
+		public:
+
+			recording_stack( Stack& stack, trace_writer& trace )
+				: _stack(&stack), _trace(&trace) {
+			};
+
+			void	push( const value_type& value ) {
+				_trace->record(trace_push, 0, value);
+				_stack->push(value);
+			};
+
+			void	pop() {
+				_trace->record(trace_pop);
+				_stack->pop();
+			};
+
+			reference	top() {
+				_trace->record(trace_top);
+				return _stack->top();
+			};
+
+			Stack&	container() const {
+				return *_stack;
+			};
+
+			static long long	apply( Stack& stack, const trace_event& e ) {
+				switch (e.op) {
+					case trace_push:
+						stack.push(static_cast<value_type>(e.value));
+						return 0;
+					case trace_pop:
+						if (!stack.empty()) {
+							stack.pop();
+						}
+						return 0;
+					case trace_top:
+						return stack.empty() ? -1 : static_cast<long long>(stack.top());
+					default:
+						return 0;
+				}
+			};
+	};
+
+}; // namespace ft
+
+#endif /* TRACE_HPP */
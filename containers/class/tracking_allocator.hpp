@@ -0,0 +1,147 @@
+#pragma once
+
+#ifndef TRACKING_ALLOCATOR_HPP
+# define TRACKING_ALLOCATOR_HPP
+
+# include <memory>
+# include <cstddef>
+
+namespace ft {
+
+	/*
+	**	Allocation_stats
+	**
+	**	Counters of a tracking_allocator. Not synchronized: share one between
+	**	threads only behind the lock of the container.
+	*/
+
+	struct allocation_stats
+	{
+		std::size_t	allocations;
+		std::size_t	deallocations;
+		std::size_t	allocated_bytes;
+		std::size_t	live_bytes;
+		std::size_t	peak_bytes;
+
+		allocation_stats() {
+			reset();
+		};
+
+		void	reset() {
+			allocations = 0;
+			deallocations = 0;
+			allocated_bytes = 0;
+			live_bytes = 0;
+			peak_bytes = 0;
+		};
+
+		// Allocations not freed yet
+		std::size_t	live() const {
+			return allocations - deallocations;
+		};
+	};
+
+	// Counters shared by every tracking_allocator of a tag, whatever its value type
+	template < typename Tag >
+	struct allocation_tag
+	{
+		static allocation_stats	stats;
+	};
+
+	template < typename Tag >
+	allocation_stats	allocation_tag<Tag>::stats;
+
+	/*
+	**	Tracking_allocator
+	**
+	**	std::allocator that counts its allocations, frees, live and peak bytes.
+	**	A default-constructed allocator counts into the stats of its Tag; one built
+	**	from an allocation_stats counts into that object, so that a single
+	**	container can be observed. Copies and rebound copies (the node allocator
+	**	of ft::map, the container of ft::stack) count into the same stats as the
+	**	original. Two allocators are equal when they share their stats.
+	*/
+
+	template < typename T, typename Tag = void >
+	class tracking_allocator : public std::allocator<T>
+	{
+		public:
+
+			typedef std::size_t		size_type;
+			typedef T*						pointer;
+
+			template < class U >
+			struct rebind {
+				typedef tracking_allocator<U, Tag> other;
+			};
+
+		private:
+
+			allocation_stats	*_stats;
+
+		public:
+
+			tracking_allocator()
+				: std::allocator<T>(), _stats(&tag_stats()) {
+			};
+
+			explicit tracking_allocator( allocation_stats& stats )
+				: std::allocator<T>(), _stats(&stats) {
+			};
+
+			tracking_allocator( const tracking_allocator& other )
+				: std::allocator<T>(other), _stats(&other.stats()) {
+			};
+
+			template < class U >
+			tracking_allocator( const tracking_allocator<U, Tag>& other )
+				: std::allocator<T>(other), _stats(&other.stats()) {
+			};
+
+			~tracking_allocator() {
+			};
+
+			tracking_allocator&	operator=( const tracking_allocator& other ) {
+				_stats = &other.stats();
+				return *this;
+			};
+
+			pointer	allocate( size_type n, const void *hint = 0 ) {
+				pointer p = std::allocator<T>::allocate(n, hint);
+				_stats->allocations++;
+				_stats->allocated_bytes += n * sizeof(T);
+				_stats->live_bytes += n * sizeof(T);
+				if (_stats->live_bytes > _stats->peak_bytes) {
+					_stats->peak_bytes = _stats->live_bytes;
+				}
+				return p;
+			};
+
+			void	deallocate( pointer p, size_type n ) {
+				_stats->deallocations++;
+				_stats->live_bytes -= n * sizeof(T);
+				std::allocator<T>::deallocate(p, n);
+			};
+
+			allocation_stats&	stats() const {
+				return *_stats;
+			};
+
+			static allocation_stats&	tag_stats() {
+				return allocation_tag<Tag>::stats;
+			};
+	};
+
+	template < class T, class U, class Tag >
+	bool	operator==( const tracking_allocator<T, Tag>& lhs, const tracking_allocator<U, Tag>& rhs ) {
+		return &lhs.stats() == &rhs.stats();
+	};
+
+	template < class T, class U, class Tag >
+	bool	operator!=( const tracking_allocator<T, Tag>& lhs, const tracking_allocator<U, Tag>& rhs ) {
+		return !(lhs == rhs);
+	};
+
+}; // namespace ft
+
+#endif /*TRACKING_ALLOCATOR_HPP*/
@@ -0,0 +1,1569 @@
+#pragma once
+
+#ifndef TREE_HPP
+# define TREE_HPP
+
+# include "utils.hpp"
+
+/*
+**	Order statistics
+**
+**	Build with -D FT_MAP_ORDER_STATISTICS to store the size of its subtree in every node.
+**	nth(), rank(), count_range() and iterator advance/distance then run in O(log n);
+**	without it they are still available but walk the tree in O(n). split() needs
+**	the sizes of both parts, so it is only built with it.
+*/
+
+/*
+**	Operation counters
+**
+**	Build with -D FT_MAP_STATS to count, in every tree, the key comparisons,
+**	the rotations, the rebalances of insert and erase and the nodes visited by
+**	the lookups. stats() and dump_stats() then report them with the height and
+**	the depth histogram of the tree. Without it nothing is counted or stored.
+**	The lookups of a const tree count too, and ft::concurrent_map runs them
+**	from several readers at once: the counters are added to atomically, with
+**	__sync_fetch_and_add like the reference counts of ft::persistent_map.
+**	stats() and reset_stats() are not atomic, call them without readers.
+*/
+
+# ifdef FT_MAP_STATS
+#  define FT_MAP_STAT(counter, n) ((void)__sync_fetch_and_add(&(counter), (n)))
+# else
+#  define FT_MAP_STAT(counter, n) ((void)0)
+# endif
+
+/*
+**	Batch lookup
+**
+**	find_many() interleaves FT_MAP_FIND_BATCH descents at a time (16 by default),
+**	override it with -D FT_MAP_FIND_BATCH=n.
+*/
+
+# ifndef FT_MAP_FIND_BATCH
+#  define FT_MAP_FIND_BATCH 16
+# endif
+
+namespace ft {
+
+	/*
+	**	Tree_node
+	**
+	**	The value is stored inline: a set node holds a key, a map node a key-value pair.
+	**	The sentinel node (end()) is the only node whose _end is NULL.
+	**	A node placed by tree::compact() lives in a tree_chunk and has _pooled set.
+	*/
+
+	template< typename T >
+	struct tree_node
+	{
+		T						_data;
+		tree_node		*_left;
+		tree_node		*_right;
+		tree_node		*_parent;
+		tree_node		*_end;
+		int					_height;
+		bool				_pooled;
+# ifdef FT_MAP_ORDER_STATISTICS
+		std::size_t	_count;
+# endif
+	};
+
+	/*
+	**	Tree_chunk
+	**
+	**	Block of nodes allocated at once by tree::compact(). Its nodes are never
+	**	deallocated one by one: the block is released when no element lives in it
+	**	anymore, and the header when no tree refers to it. Split, join and the set
+	**	operations move nodes between trees, so the trees involved share their chunks.
+	*/
+
+	template< typename Node >
+	struct tree_chunk
+	{
+		Node				*_nodes;
+		std::size_t	_capacity;
+		std::size_t	_live;
+		std::size_t	_refs;
+	};
+
+	/*
+	**	Compact_layout
+	**
+	**	Order in which tree::compact() places the nodes in memory:
+	**		- compact_in_order: key order, for scans.
+	**		- compact_veb: van Emde Boas order, every subtree of about sqrt(n) nodes
+	**		 is contiguous, for lookups.
+	*/
+
+	enum compact_layout
+	{
+		compact_in_order,
+		compact_veb
+	};
+
+	/*
+	**	Tree_stats
+	**
+	**	Counters of a tree built with FT_MAP_STATS, since its construction or
+	**	the last reset_stats(). A rebalance is a balance() that rotates; lookups
+	**	are the descents of find, lower_bound, upper_bound and find_many, and
+	**	visited the nodes they went through. depths[d] is the number of nodes d
+	**	levels below the root, filled by stats() like height.
+	*/
+
+	struct tree_stats
+	{
+		std::size_t								comparisons;
+		std::size_t								left_rotations;
+		std::size_t								right_rotations;
+		std::size_t								insert_rebalances;
+		std::size_t								erase_rebalances;
+		std::size_t								lookups;
+		std::size_t								visited;
+		int												height;
+		std::vector<std::size_t>	depths;
+
+		tree_stats() {
+			reset();
+		};
+
+		void	reset() {
+			comparisons = 0;
+			left_rotations = 0;
+			right_rotations = 0;
+			insert_rebalances = 0;
+			erase_rebalances = 0;
+			lookups = 0;
+			visited = 0;
+			height = 0;
+			depths.clear();
+		};
+
+		double	visited_per_lookup() const {
+			return lookups ? static_cast<double>(visited) / lookups : 0;
+		};
+
+		void	dump( std::ostream& out ) const {
+			std::size_t nodes = 0;
+			std::size_t widest = 0;
+			for (std::size_t d = 0; d < depths.size(); d++) {
+				nodes += depths[d];
+				widest = std::max(widest, depths[d]);
+			}
+			out << "comparisons:        " << comparisons << std::endl;
+			out << "rotations:          " << left_rotations << " left, " << right_rotations << " right" << std::endl;
+			out << "rebalances:         " << insert_rebalances << " insert, " << erase_rebalances << " erase" << std::endl;
+			out << "lookups:            " << lookups << ", " << visited_per_lookup() << " nodes visited each" << std::endl;
+			out << "height:             " << height << " for " << nodes << " nodes" << std::endl;
+			for (std::size_t d = 0; d < depths.size(); d++) {
+				out << "  depth " << std::setw(3) << d << std::setw(10) << depths[d] << ' '
+					<< std::string(widest ? depths[d] * 50 / widest : 0, '#') << std::endl;
+			}
+		};
+	};
+
+	/*
+	**	Key extraction
+	**
+	**	Returns the key of a value: the value itself for sets, its first member for maps.
+	*/
+
+	template< typename T >
+	struct identity
+	{
+		const T& operator()( const T& value ) const {
+			return value;
+		};
+	};
+
+	template< typename Pair >
+	struct select_first
+	{
+		const typename Pair::first_type& operator()( const Pair& value ) const {
+			return value.first;
+		};
+	};
+
+	/*
+	**	Tree
+	**
+	**	AVL tree shared by map, set, multimap and multiset.
+	**		- Value is the stored type and KeyOfValue extracts its key.
+	**		- Unique is the uniqueness policy: when true, inserting a key already present
+	**		 does nothing; when false, equivalent keys are kept in insertion order.
+	**	Nodes have a parent link; the sentinel is kept pointing to the maximum.
+	**	Erasing relinks nodes instead of moving values, so iterators to the other
+	**	elements stay valid.
+	*/
+
+	template < typename Key, typename Value, typename KeyOfValue, typename Compare, typename Allocator, bool Unique >
+	class tree
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef Value																												value_type;
+
+			typedef std::size_t																									size_type;
+			typedef std::ptrdiff_t																							difference_type;
+
+			typedef Compare																											key_compare;
+			typedef Allocator																										allocator_type;
+
+			typedef tree_iterators<tree_node<value_type>, value_type>						iterator;
+			typedef tree_iterators<tree_node<value_type>, const value_type>			const_iterator;
+
+		protected:
+
+			typedef tree_node<value_type>																				tnode;
+			typedef typename allocator_type::template rebind<tnode>::other			node_alloc;
+			typedef tree_chunk<tnode>																						chunk;
+			typedef typename allocator_type::template rebind<chunk>::other			chunk_alloc;
+			typedef ft::vector<chunk *, typename allocator_type::template rebind<chunk *>::other>	chunk_list;
+			typedef typename allocator_type::template rebind<size_type>::other	slot_alloc;
+
+		private:
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			node_alloc			_allocNode;
+			tnode						*_root;
+			tnode						*_end;
+			allocator_type	_alloc;
+			size_type				_size;
+			Compare					_comp;
+			KeyOfValue			_key;
+			chunk_list			_chunks;
+# ifdef FT_MAP_STATS
+			mutable tree_stats	_stats;
+# endif
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+			explicit tree( const Compare& comp = Compare(), const Allocator& alloc = Allocator() )
+				: _allocNode(alloc), _root(NULL), _end(NULL), _alloc(alloc), _size(0), _comp(comp), _chunks(alloc) {
+				initialize_end();
+			};
+
+			tree( const tree& other )
+				: _allocNode(other._allocNode), _root(NULL), _end(NULL), _alloc(other._alloc), _size(0), _comp(other._comp),
+				_chunks(other._alloc) {
+				initialize_end();
+				insert(other.begin(), other.end());
+			};
+
+			~tree() {
+				clear();
+				free_node(_end);
+				release_chunks();
+			};
+
+			tree& operator=( const tree& other ) {
+				if (this != &other) {
+					clear();
+					_comp = other._comp;
+					insert(other.begin(), other.end());
+				}
+				return *this;
+			};
+
+			allocator_type	get_allocator() const {
+				return _alloc;
+			};
+
+			key_compare key_comp() const {
+				return _comp;
+			};
+
+# ifdef FT_MAP_STATS
+			// Counters, with the height and the depth histogram of the tree as it is now
+			tree_stats	stats() const {
+				tree_stats s = _stats;
+				s.height = _root ? _root->_height : 0;
+				count_depths(_root, 0, s.depths);
+				return s;
+			};
+
+			void	reset_stats() {
+				_stats.reset();
+			};
+# endif
+
+
+
+			/******************************/
+			/*****      ITERATOR      *****/
+			/******************************/
+
+
+
+			iterator begin() {
+				if (_size == 0) {
+					return iterator(_end);
+				}
+				return iterator(node_value_min(_root));
+			};
+
+			const_iterator begin() const {
+				if (_size == 0) {
+					return const_iterator(_end);
+				}
+				return const_iterator(node_value_min(_root));
+			};
+
+			iterator end() {
+				return iterator(_end);
+			};
+
+			const_iterator end() const {
+				return const_iterator(_end);
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return _size == 0;
+			};
+
+			size_type	size() const {
+				return _size;
+			};
+
+			size_type	max_size() const {
+				return _allocNode.max_size();
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			void clear() {
+				if (_size) {
+					destroy_tree(_root);
+				}
+				release_chunks();
+			};
+
+			// Insert value, or find the element with its key under the unique policy
+			pair<iterator, bool> insert( const value_type& value ) {
+				return insert_from(_root, value);
+			};
+
+			// Same, searching for the position from hint instead of from the root. Without the
+			// unique policy, a key equivalent to the key of hint may have equivalent elements
+			// above the finger: it is searched from the root to go after all of them.
+			pair<iterator, bool> insert( const_iterator hint, const value_type& value ) {
+				tnode *h = hint.getnode();
+				if (!Unique && h != _end && !compare(_key(h->_data), _key(value)) && !compare(_key(value), _key(h->_data))) {
+					return insert_from(_root, value);
+				}
+				return insert_from(finger(h, _key(value)), value);
+			};
+
+			// Sorted ranges are appended at the end in O(1) comparisons per element
+			template< class InputIt >
+			void insert( InputIt first, InputIt last ) {
+				for (; first != last; ++first) {
+					insert(end(), *first);
+				}
+			};
+
+			void erase( iterator pos ) {
+				erase_node(pos.getnode());
+				refresh_end();
+			};
+
+			void erase( iterator first, iterator last ) {
+				while (first != last) {
+					erase(first++);
+				}
+			};
+
+			void erase( const_iterator pos ) {
+				erase_node(pos.getnode());
+				refresh_end();
+			};
+
+			void erase( const_iterator first, const_iterator last ) {
+				while (first != last) {
+					erase(first++);
+				}
+			};
+
+			size_type erase( const Key& key ) {
+				ft::pair<iterator, iterator> range = equal_range(key);
+				size_type count = 0;
+				while (range.first != range.second) {
+					erase(range.first++);
+					count++;
+				}
+				return count;
+			};
+
+			void swap( tree& other ) {
+				std::swap(_allocNode, other._allocNode);
+				std::swap(_root, other._root);
+				std::swap(_end, other._end);
+				std::swap(_alloc, other._alloc);
+				std::swap(_size, other._size);
+				std::swap(_comp, other._comp);
+				_chunks.swap(other._chunks);
+			};
+
+
+			/*
+			**	Compact
+			**
+			**	Moves every element to one block of memory, in key order or in van Emde Boas
+			**	order, and links them as a perfectly balanced tree. After a long run of
+			**	insertions and erasures the nodes are scattered over the heap; compacted,
+			**	a scan reads memory sequentially and a lookup touches few cache lines.
+			**	Elements inserted later are allocated one by one as usual.
+			**	Every iterator, pointer and reference to an element is invalidated.
+			*/
+
+			void compact( compact_layout layout ) {
+				if (_size == 0) {
+					release_chunks();
+					return;
+				}
+				chunk *c = new_chunk(_size);
+				size_type *slot = NULL;
+				slot_alloc alloc_slot(_alloc);
+				if (layout == compact_veb) {
+					slot = alloc_slot.allocate(_size);
+					size_type next = 0;
+					veb_place(0, _size, balanced_height(_size), slot, next);
+				}
+				size_type k = 0;
+				for (iterator it = begin(); it != end(); ++it, ++k) {
+					tnode *nd = c->_nodes + (slot ? slot[k] : k);
+					_alloc.construct(&nd->_data, *it);
+					nd->_pooled = true;
+				}
+				size_type n = _size;
+				free_tree(_root);
+				release_chunks();
+				_chunks.push_back(c);
+				_root = link_balanced(c->_nodes, slot, 0, n, NULL);
+				if (slot) {
+					alloc_slot.deallocate(slot, n);
+				}
+				refresh_end();
+			};
+
+
+
+			/************************************/
+			/*****      SPLIT AND JOIN      *****/
+			/************************************/
+
+
+
+# ifdef FT_MAP_ORDER_STATISTICS
+			// Move the elements whose key is not less than key into greater (unique keys).
+			// The subtree sizes give the size of each part in O(log n), hence the flag.
+			void split( const Key& key, tree& greater ) {
+				if (this == &greater) {
+					return;
+				}
+				greater.clear();
+				greater.share_chunks(*this);
+				size_type less = rank(key);
+				tnode *left = NULL;
+				tnode *right = NULL;
+				tnode *found = split_tree(_root, key, left, right);
+				if (found) {
+					right = join_tree(NULL, found, right);
+				}
+				_root = left;
+				greater._root = right;
+				greater._size = _size - less;
+				_size = less;
+				refresh_end();
+				greater.refresh_end();
+			};
+# endif
+
+			// Move every element of other, whose keys are all less or all greater than ours
+			void join( tree& other, const char *overlap ) {
+				if (this == &other || other.empty()) {
+					return;
+				}
+				share_chunks(other);
+				if (empty()) {
+					_root = other._root;
+				}
+				else if (compare(_key(node_value_max(_root)->_data), _key(node_value_min(other._root)->_data))) {
+					_root = join_trees(_root, other._root);
+				}
+				else if (compare(_key(node_value_max(other._root)->_data), _key(node_value_min(_root)->_data))) {
+					_root = join_trees(other._root, _root);
+				}
+				else {
+					throw std::invalid_argument(overlap);
+				}
+				_size += other._size;
+				other._root = NULL;
+				other._size = 0;
+				refresh_end();
+				other.refresh_end();
+			};
+
+
+
+			/************************************/
+			/*****      SET OPERATIONS      *****/
+			/************************************/
+
+
+
+			void merge( tree& other ) {
+				if (this == &other) {
+					return;
+				}
+				share_chunks(other);
+				other.share_chunks(*this);
+				tnode *rest = NULL;
+				size_type dups = 0;
+				_root = union_trees(_root, other._root, rest, dups);
+				other._root = rest;
+				_size += other._size - dups;
+				other._size = dups;
+				refresh_end();
+				other.refresh_end();
+			};
+
+			void set_union( tree& other ) {
+				merge(other);
+				other.clear();
+			};
+
+			void set_intersection( tree& other ) {
+				if (this == &other) {
+					return;
+				}
+				share_chunks(other);
+				size_type kept = 0;
+				_root = intersect_trees(_root, other._root, kept);
+				other._root = NULL;
+				_size = kept;
+				other._size = 0;
+				refresh_end();
+				other.refresh_end();
+			};
+
+			void set_difference( tree& other ) {
+				if (this == &other) {
+					clear();
+					return;
+				}
+				share_chunks(other);
+				size_type removed = 0;
+				_root = subtract_trees(_root, other._root, removed);
+				other._root = NULL;
+				_size -= removed;
+				other._size = 0;
+				refresh_end();
+				other.refresh_end();
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			template< class K >
+			size_type count( const K& key ) const {
+				if (Unique) {
+					return find(key) == end() ? 0 : 1;
+				}
+				size_type n = 0;
+				for (const_iterator it = lower_bound(key); it != end() && !compare(key, _key(*it)); ++it) {
+					n++;
+				}
+				return n;
+			};
+
+			// First element with key equivalent to key; K is Key, or any type
+			// the comparator accepts when it is transparent
+			template< class K >
+			iterator find( const K& key ) {
+				tnode *nd = lower_bound_node(key);
+				if (nd == NULL || compare(key, _key(nd->_data))) {
+					return end();
+				}
+				return iterator(nd);
+			};
+
+			template< class K >
+			const_iterator find( const K& key ) const {
+				tnode *nd = lower_bound_node(key);
+				if (nd == NULL || compare(key, _key(nd->_data))) {
+					return end();
+				}
+				return const_iterator(nd);
+			};
+
+			// Same, searching from hint instead of from the root
+			template< class K >
+			iterator find( const_iterator hint, const K& key ) {
+				tnode *nd = find_from(finger(hint.getnode(), key), key);
+				return iterator(nd ? nd : _end);
+			};
+
+			template< class K >
+			const_iterator find( const_iterator hint, const K& key ) const {
+				tnode *nd = find_from(finger(hint.getnode(), key), key);
+				return const_iterator(nd ? nd : _end);
+			};
+
+			template< class K >
+			ft::pair<iterator,iterator> equal_range( const K& key ) {
+				return ft::pair<iterator,iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			template< class K >
+			ft::pair<const_iterator,const_iterator> equal_range( const K& key ) const {
+				return ft::pair<const_iterator,const_iterator>(lower_bound(key), upper_bound(key));
+			};
+
+			template< class K >
+			iterator lower_bound( const K& key ) {
+				tnode *nd = lower_bound_node(key);
+				return iterator(nd ? nd : _end);
+			};
+
+			template< class K >
+			const_iterator lower_bound( const K& key ) const {
+				tnode *nd = lower_bound_node(key);
+				return const_iterator(nd ? nd : _end);
+			};
+
+			template< class K >
+			iterator upper_bound( const K& key ) {
+				tnode *nd = upper_bound_node(key);
+				return iterator(nd ? nd : _end);
+			};
+
+			template< class K >
+			const_iterator upper_bound( const K& key ) const {
+				tnode *nd = upper_bound_node(key);
+				return const_iterator(nd ? nd : _end);
+			};
+
+
+
+			// Write the result of find() for every key of [first, last) to out
+			template< class ForwardIt, class OutputIt >
+			OutputIt find_many( ForwardIt first, ForwardIt last, OutputIt out ) {
+				ForwardIt	keys[FT_MAP_FIND_BATCH];
+				tnode			*found[FT_MAP_FIND_BATCH];
+				while (first != last) {
+					size_type n = 0;
+					for (; n < FT_MAP_FIND_BATCH && first != last; ++n, ++first) {
+						keys[n] = first;
+					}
+					find_batch(keys, found, n);
+					for (size_type i = 0; i < n; i++) {
+						*out++ = found[i] ? iterator(found[i]) : end();
+					}
+				}
+				return out;
+			};
+
+			template< class ForwardIt, class OutputIt >
+			OutputIt find_many( ForwardIt first, ForwardIt last, OutputIt out ) const {
+				ForwardIt	keys[FT_MAP_FIND_BATCH];
+				tnode			*found[FT_MAP_FIND_BATCH];
+				while (first != last) {
+					size_type n = 0;
+					for (; n < FT_MAP_FIND_BATCH && first != last; ++n, ++first) {
+						keys[n] = first;
+					}
+					find_batch(keys, found, n);
+					for (size_type i = 0; i < n; i++) {
+						*out++ = found[i] ? const_iterator(found[i]) : end();
+					}
+				}
+				return out;
+			};
+
+
+
+			/**************************************/
+			/*****      ORDER STATISTICS      *****/
+			/**************************************/
+
+
+
+			iterator nth( size_type k ) {
+				tnode *nd = select_node(_root, k);
+				return iterator(nd ? nd : _end);
+			};
+
+			const_iterator nth( size_type k ) const {
+				tnode *nd = select_node(_root, k);
+				return const_iterator(nd ? nd : _end);
+			};
+
+			// Number of elements whose key is less than key
+			size_type rank( const Key& key ) const {
+				size_type r = 0;
+				tnode *nd = _root;
+				while (nd != NULL) {
+					if (compare(_key(nd->_data), key)) {
+						r += subtree_size(nd->_left) + 1;
+						nd = nd->_right;
+					}
+					else {
+						nd = nd->_left;
+					}
+				}
+				return r;
+			};
+
+			size_type count_range( const Key& lo, const Key& hi ) const {
+				if (!compare(lo, hi)) {
+					return 0;
+				}
+				return rank(hi) - rank(lo);
+			};
+
+
+
+			/*************************/
+			/*****      AVL      *****/
+			/*************************/
+
+		private:
+
+			// Every key comparison of the tree goes through here, to be counted
+			template< class A, class B >
+			bool	compare( const A& a, const B& b ) const {
+				FT_MAP_STAT(_stats.comparisons, 1);
+				return _comp(a, b);
+			};
+
+# ifdef FT_MAP_STATS
+			static void	count_depths( tnode *nd, std::size_t depth, std::vector<std::size_t>& depths ) {
+				if (nd == NULL) {
+					return;
+				}
+				if (depths.size() <= depth) {
+					depths.resize(depth + 1, 0);
+				}
+				depths[depth]++;
+				count_depths(nd->_left, depth + 1, depths);
+				count_depths(nd->_right, depth + 1, depths);
+			};
+# endif
+
+			int	max( int a, int b ) {
+				return (a > b) ? a : b;
+			};
+
+			int height( tnode *nd ) {
+				if (nd == NULL) {
+					return 0;
+				}
+				return nd->_height;
+			};
+
+			size_type subtree_size( tnode *nd ) const {
+				if (nd == NULL) {
+					return 0;
+				}
+# ifdef FT_MAP_ORDER_STATISTICS
+				return nd->_count;
+# else
+				return 1 + subtree_size(nd->_left) + subtree_size(nd->_right);
+# endif
+			};
+
+			// Recompute the height (and subtree size) of nd from its children
+			void update( tnode *nd ) {
+				nd->_height = max(height(nd->_left), height(nd->_right)) + 1;
+# ifdef FT_MAP_ORDER_STATISTICS
+				nd->_count = subtree_size(nd->_left) + subtree_size(nd->_right) + 1;
+# endif
+			};
+
+			// Node at position k in key order in the subtree nd, or NULL
+			tnode *select_node( tnode *nd, size_type k ) const {
+				while (nd != NULL) {
+					size_type left = subtree_size(nd->_left);
+					if (k < left) {
+						nd = nd->_left;
+					}
+					else if (k == left) {
+						return nd;
+					}
+					else {
+						k -= left + 1;
+						nd = nd->_right;
+					}
+				}
+				return NULL;
+			};
+
+			// First node whose key is not less than key, or NULL
+			template< class K >
+			tnode *lower_bound_node( const K& key ) const {
+				tnode *nd = _root;
+				tnode *found = NULL;
+				FT_MAP_STAT(_stats.lookups, 1);
+				while (nd != NULL) {
+					FT_MAP_STAT(_stats.visited, 1);
+					if (compare(_key(nd->_data), key)) {
+						nd = nd->_right;
+					}
+					else {
+						found = nd;
+						nd = nd->_left;
+					}
+				}
+				return found;
+			};
+
+			// First node whose key is greater than key, or NULL
+			template< class K >
+			tnode *upper_bound_node( const K& key ) const {
+				tnode *nd = _root;
+				tnode *found = NULL;
+				FT_MAP_STAT(_stats.lookups, 1);
+				while (nd != NULL) {
+					FT_MAP_STAT(_stats.visited, 1);
+					if (compare(key, _key(nd->_data))) {
+						found = nd;
+						nd = nd->_left;
+					}
+					else {
+						nd = nd->_right;
+					}
+				}
+				return found;
+			};
+
+			/* Find n keys at once
+			/ Every key has its own descent, like lower_bound_node. The descents advance one
+			/ level per round, in turn, and the next node of each one is prefetched, so the
+			/ cache misses of the n descents overlap instead of following each other.
+			/ found[i] is the node of *keys[i], or NULL.
+			*/
+			template< class ForwardIt >
+			void find_batch( ForwardIt *keys, tnode **found, size_type n ) const {
+				tnode *cur[FT_MAP_FIND_BATCH];
+				for (size_type i = 0; i < n; i++) {
+					cur[i] = _root;
+					found[i] = NULL;
+				}
+				FT_MAP_STAT(_stats.lookups, n);
+				for (size_type active = n; active > 0; ) {
+					active = 0;
+					for (size_type i = 0; i < n; i++) {
+						tnode *nd = cur[i];
+						if (nd == NULL) {
+							continue;
+						}
+						FT_MAP_STAT(_stats.visited, 1);
+						if (compare(_key(nd->_data), *keys[i])) {
+							nd = nd->_right;
+						}
+						else {
+							found[i] = nd;
+							nd = nd->_left;
+						}
+						if (nd) {
+							__builtin_prefetch(nd);
+							active++;
+						}
+						cur[i] = nd;
+					}
+				}
+				for (size_type i = 0; i < n; i++) {
+					if (found[i] && compare(*keys[i], _key(found[i]->_data))) {
+						found[i] = NULL;
+					}
+				}
+			};
+
+			// Keep the sentinel pointing to the maximum and the root pointing to the sentinel
+			void refresh_end() {
+				if (_root) {
+					_root->_parent = NULL;
+					_root->_end = _end;
+					tnode *new_max = node_value_max(_root);
+					_end->_parent = new_max;
+					_end->_left = new_max;
+				}
+				else {
+					_end->_parent = NULL;
+					_end->_left = NULL;
+				}
+			};
+
+			// Free a detached subtree without touching the size of the tree
+			void free_tree( tnode *nd ) {
+				if (nd != NULL) {
+					free_tree(nd->_left);
+					free_tree(nd->_right);
+					free_node(nd);
+				}
+			};
+
+			void destroy_tree( tnode *nd ) {
+				free_tree(nd);
+				_root = NULL;
+				_size = 0;
+				refresh_end();
+			};
+
+			tnode	*new_node( const value_type& value, tnode *parent ) {
+				tnode *nd = _allocNode.allocate(1);
+				nd->_left = NULL;
+				nd->_right = NULL;
+				nd->_parent = parent;
+				nd->_end = _end;
+				nd->_height = 1;
+				nd->_pooled = false;
+# ifdef FT_MAP_ORDER_STATISTICS
+				nd->_count = 1;
+# endif
+				_alloc.construct(&nd->_data, value);
+				return (nd);
+			};
+
+			// A node of a chunk only counts down the elements living in its chunk
+			void	free_node( tnode *nd ) {
+				_alloc.destroy(&nd->_data);
+				if (!nd->_pooled) {
+					_allocNode.deallocate(nd, 1);
+					return;
+				}
+				std::less<tnode *> less;
+				for (size_type i = 0; i < _chunks.size(); i++) {
+					chunk *c = _chunks[i];
+					if (c->_nodes && !less(nd, c->_nodes) && less(nd, c->_nodes + c->_capacity)) {
+						if (--c->_live == 0) {
+							_allocNode.deallocate(c->_nodes, c->_capacity);
+							c->_nodes = NULL;
+						}
+						return;
+					}
+				}
+			};
+
+
+
+			/****************************/
+			/*****      CHUNKS      *****/
+			/****************************/
+
+
+
+			chunk	*new_chunk( size_type n ) {
+				chunk_alloc alloc_chunk(_alloc);
+				chunk *c = alloc_chunk.allocate(1);
+				c->_nodes = _allocNode.allocate(n);
+				c->_capacity = n;
+				c->_live = n;
+				c->_refs = 1;
+				return c;
+			};
+
+			// Refer to the chunks of other too, before nodes move between the two trees
+			void	share_chunks( tree& other ) {
+				for (size_type i = 0; i < other._chunks.size(); i++) {
+					chunk *c = other._chunks[i];
+					size_type j = 0;
+					while (j < _chunks.size() && _chunks[j] != c) {
+						j++;
+					}
+					if (j == _chunks.size()) {
+						c->_refs++;
+						_chunks.push_back(c);
+					}
+				}
+			};
+
+			// Drop the references of this tree, which holds no node of a chunk anymore, to its chunks
+			void	release_chunks() {
+				chunk_alloc alloc_chunk(_alloc);
+				for (size_type i = 0; i < _chunks.size(); i++) {
+					chunk *c = _chunks[i];
+					if (--c->_refs == 0) {
+						if (c->_nodes) {
+							_allocNode.deallocate(c->_nodes, c->_capacity);
+						}
+						alloc_chunk.deallocate(c, 1);
+					}
+				}
+				_chunks.clear();
+			};
+
+			// Height of the tree link_balanced builds on n nodes
+			static int	balanced_height( size_type n ) {
+				int h = 0;
+				for (; n; n /= 2) {
+					h++;
+				}
+				return h;
+			};
+
+			/* Van Emde Boas layout
+			/ The balanced tree on the positions [lo, hi), cut to its first depth levels,
+			/ is split at half its height: the top tree is placed first, then every
+			/ bottom tree from left to right, each of them recursively.
+			/ slot[k] receives the place of the k-th element in key order.
+			*/
+			static void	veb_place( size_type lo, size_type hi, int depth, size_type *slot, size_type& next ) {
+				if (lo >= hi || depth == 0) {
+					return;
+				}
+				if (depth == 1) {
+					slot[lo + (hi - lo) / 2] = next++;
+					return;
+				}
+				int top = depth / 2;
+				veb_place(lo, hi, top, slot, next);
+				veb_bottom(lo, hi, top, depth - top, slot, next);
+			};
+
+			// Place the subtrees found skip levels below the root of [lo, hi), from left to right
+			static void	veb_bottom( size_type lo, size_type hi, int skip, int depth, size_type *slot, size_type& next ) {
+				if (lo >= hi) {
+					return;
+				}
+				if (skip == 0) {
+					return veb_place(lo, hi, depth, slot, next);
+				}
+				size_type mid = lo + (hi - lo) / 2;
+				veb_bottom(lo, mid, skip - 1, depth, slot, next);
+				veb_bottom(mid + 1, hi, skip - 1, depth, slot, next);
+			};
+
+			// Link the k-th elements in key order, k in [lo, hi), as a balanced subtree under parent
+			tnode	*link_balanced( tnode *nodes, size_type *slot, size_type lo, size_type hi, tnode *parent ) {
+				if (lo >= hi) {
+					return NULL;
+				}
+				size_type mid = lo + (hi - lo) / 2;
+				tnode *nd = nodes + (slot ? slot[mid] : mid);
+				nd->_parent = parent;
+				nd->_end = _end;
+				nd->_left = link_balanced(nodes, slot, lo, mid, nd);
+				nd->_right = link_balanced(nodes, slot, mid + 1, hi, nd);
+				update(nd);
+				return nd;
+			};
+
+			tnode *rightRotate( tnode *y ) {
+				tnode *x = y->_left;
+				tnode *xr = x->_right;
+				FT_MAP_STAT(_stats.right_rotations, 1);
+
+				x->_parent = y->_parent;
+				y->_parent = x;
+				x->_right = y;
+				y->_left = xr;
+				if (xr) {
+					xr->_parent = y;
+				}
+				update(y);
+				update(x);
+				return x;
+			};
+
+			tnode *leftRotate( tnode *x ) {
+				tnode *y = x->_right;
+				tnode *yl = y->_left;
+				FT_MAP_STAT(_stats.left_rotations, 1);
+
+				y->_parent = x->_parent;
+				x->_parent = y;
+				y->_left = x;
+				x->_right = yl;
+				if (yl) {
+					yl->_parent = x;
+				}
+				update(x);
+				update(y);
+				return y;
+			};
+
+			int getBalanceFactor( tnode *nd ) {
+				if (nd == NULL) {
+					return 0;
+				}
+				return height(nd->_left) - height(nd->_right);
+			};
+
+			/* Finger search
+			/ Returns the node to start a search for key from, instead of the root, when
+			/ the search is known to end near the node f. Going up from f, the subtree of
+			/ x holds every key between its nearest ancestors on each side, so the climb
+			/ only compares key with those ancestors and stops at the first subtree whose
+			/ range contains key: O(log d) comparisons for a key d elements away from f.
+			/ From end(), a key greater than the maximum starts at the maximum, any other
+			/ key at the root.
+			*/
+			template< class K >
+			tnode *finger( tnode *f, const K& key ) const {
+				if (_root == NULL) {
+					return NULL;
+				}
+				if (f == _end) {
+					f = _end->_parent;
+					return compare(_key(f->_data), key) ? f : _root;
+				}
+				bool greater = compare(_key(f->_data), key);
+				tnode *x = f;
+				for (;;) {
+					tnode *up = x;
+					while (up->_parent && up == (greater ? up->_parent->_right : up->_parent->_left)) {
+						up = up->_parent;
+					}
+					up = up->_parent;
+					if (up == NULL || (greater ? compare(key, _key(up->_data)) : compare(_key(up->_data), key))) {
+						return x;
+					}
+					x = up;
+				}
+			};
+
+			// First node of the subtree from whose key is equivalent to key, or NULL
+			template< class K >
+			tnode *find_from( tnode *from, const K& key ) const {
+				tnode *found = NULL;
+				FT_MAP_STAT(_stats.lookups, 1);
+				while (from != NULL) {
+					FT_MAP_STAT(_stats.visited, 1);
+					if (compare(_key(from->_data), key)) {
+						from = from->_right;
+					}
+					else {
+						found = from;
+						from = from->_left;
+					}
+				}
+				if (found == NULL || compare(key, _key(found->_data))) {
+					return NULL;
+				}
+				return found;
+			};
+
+			/* Insert a node
+			/ 1- Find the correct position in the subtree from; under the unique policy
+			/    an equivalent key stops the insertion, otherwise it goes to the right
+			/ 2- Link the new node, then check the balance and rotate if necessary
+			/    on the way up to the root
+			*/
+			pair<iterator, bool> insert_from( tnode *from, const value_type& value ) {
+				tnode *parent = NULL;
+				bool left = false;
+				while (from != NULL) {
+					parent = from;
+					left = compare(_key(value), _key(from->_data));
+					if (!left && Unique && !compare(_key(from->_data), _key(value))) {
+						return pair<iterator, bool>(iterator(from), false);
+					}
+					from = left ? from->_left : from->_right;
+				}
+				tnode *nd = new_node(value, parent);
+				_size++;
+				if (parent == NULL) {
+					_root = nd;
+				}
+				else {
+					if (left) {
+						parent->_left = nd;
+					}
+					else {
+						parent->_right = nd;
+					}
+					rebalance_up(parent, true);
+				}
+				_root->_end = _end;
+				if (_end->_parent == NULL || (parent == _end->_parent && !left)) {
+					_end->_parent = nd;
+					_end->_left = nd;
+				}
+				return pair<iterator, bool>(iterator(nd), true);
+			};
+
+			/* Rebalance from nd up to the root
+			/ Every subtree on the way is balanced and hung back under its parent.
+			/ After an insertion, a subtree that keeps its height leaves its ancestors
+			/ balanced: the walk stops there, unless the subtree sizes must be updated.
+			*/
+			void rebalance_up( tnode *nd, bool insertion ) {
+				while (nd != NULL) {
+					tnode *parent = nd->_parent;
+					bool left = parent && parent->_left == nd;
+					int before = nd->_height;
+					tnode *sub = balance(nd);
+					if (sub != nd) {
+						FT_MAP_STAT(insertion ? _stats.insert_rebalances : _stats.erase_rebalances, 1);
+					}
+					if (parent == NULL) {
+						_root = sub;
+					}
+					else if (left) {
+						parent->_left = sub;
+					}
+					else {
+						parent->_right = sub;
+					}
+# ifndef FT_MAP_ORDER_STATISTICS
+					if (insertion && sub->_height == before) {
+						return;
+					}
+# else
+					(void)before;
+					(void)insertion;
+# endif
+					nd = parent;
+				}
+			};
+
+			tnode *node_value_min( tnode *nd ) const {
+				tnode *temp = nd;
+				while (temp->_left != NULL) {
+					temp = temp->_left;
+				}
+				return temp;
+			};
+
+			tnode *node_value_max( tnode *nd ) const {
+				tnode *temp = nd;
+				while (temp->_right != NULL) {
+					temp = temp->_right;
+				}
+				return temp;
+			};
+
+			// Put child in the place of nd under the parent of nd
+			void replace_child( tnode *nd, tnode *child ) {
+				tnode *parent = nd->_parent;
+				if (child) {
+					child->_parent = parent;
+				}
+				if (parent == NULL) {
+					_root = child;
+				}
+				else if (parent->_left == nd) {
+					parent->_left = child;
+				}
+				else {
+					parent->_right = child;
+				}
+			};
+
+			/* Delete a node
+			/ 1- A node with at most one child is replaced by that child
+			/ 2- A node with two children is replaced by its in-order successor,
+			/    which is first unlinked from the right subtree
+			/ 3- From the lowest node whose subtree changed up to the root, update the
+			/    height and subtree size, check the balance and rotate if necessary
+			*/
+			void erase_node( tnode *nd ) {
+				tnode *start;
+				if (nd->_left == NULL || nd->_right == NULL) {
+					start = nd->_parent;
+					replace_child(nd, nd->_left ? nd->_left : nd->_right);
+				}
+				else {
+					tnode *succ = node_value_min(nd->_right);
+					if (succ->_parent != nd) {
+						start = succ->_parent;
+						replace_child(succ, succ->_right);
+						succ->_right = nd->_right;
+						succ->_right->_parent = succ;
+					}
+					else {
+						start = succ;
+					}
+					replace_child(nd, succ);
+					succ->_left = nd->_left;
+					succ->_left->_parent = succ;
+				}
+				_size--;
+				free_node(nd);
+				rebalance_up(start, false);
+			};
+
+			// Update root from its children, then rotate if its subtrees differ in height by 2
+			tnode *balance( tnode *root ) {
+				update(root);
+				int balanceFactor = getBalanceFactor(root);
+				if (balanceFactor > 1) {
+					if (getBalanceFactor(root->_left) >= 0) {
+						return rightRotate(root);
+					}
+					else {
+						root->_left = leftRotate(root->_left);
+						return rightRotate(root);
+					}
+				}
+				if (balanceFactor < -1)	{
+					if (getBalanceFactor(root->_right) <= 0) {
+						return leftRotate(root);
+					}
+					else {
+						root->_right = rightRotate(root->_right);
+						return leftRotate(root);
+					}
+				}
+				return root;
+			};
+
+			/* Join and split
+			/ join_tree(l, k, r) builds a balanced tree from l, the node k and r,
+			/ every key of l being less than k and every key of r greater.
+			/ The shorter tree is hung on the spine of the taller one where heights match,
+			/ then the spine is rebalanced on the way back: O(|height(l) - height(r)|).
+			/ split_tree cuts a tree along the search path of a key and joins the pieces
+			/ on each side back together: O(log n).
+			*/
+
+			// Make nd the root of the subtrees l and r
+			tnode *make_node( tnode *l, tnode *nd, tnode *r ) {
+				nd->_left = l;
+				nd->_right = r;
+				nd->_parent = NULL;
+				if (l) {
+					l->_parent = nd;
+				}
+				if (r) {
+					r->_parent = nd;
+				}
+				update(nd);
+				return nd;
+			};
+
+			tnode *join_right( tnode *l, tnode *k, tnode *r ) {
+				tnode *ll = l->_left;
+				tnode *lr = l->_right;
+				if (height(lr) <= height(r) + 1) {
+					tnode *t = make_node(lr, k, r);
+					if (height(t) <= height(ll) + 1) {
+						return make_node(ll, l, t);
+					}
+					return leftRotate(make_node(ll, l, rightRotate(t)));
+				}
+				tnode *t = join_right(lr, k, r);
+				make_node(ll, l, t);
+				if (height(t) <= height(ll) + 1) {
+					return l;
+				}
+				return leftRotate(l);
+			};
+
+			tnode *join_left( tnode *l, tnode *k, tnode *r ) {
+				tnode *rl = r->_left;
+				tnode *rr = r->_right;
+				if (height(rl) <= height(l) + 1) {
+					tnode *t = make_node(l, k, rl);
+					if (height(t) <= height(rr) + 1) {
+						return make_node(t, r, rr);
+					}
+					return rightRotate(make_node(leftRotate(t), r, rr));
+				}
+				tnode *t = join_left(l, k, rl);
+				make_node(t, r, rr);
+				if (height(t) <= height(rr) + 1) {
+					return r;
+				}
+				return rightRotate(r);
+			};
+
+			tnode *join_tree( tnode *l, tnode *k, tnode *r ) {
+				tnode *root;
+				if (height(l) > height(r) + 1) {
+					root = join_right(l, k, r);
+				}
+				else if (height(r) > height(l) + 1) {
+					root = join_left(l, k, r);
+				}
+				else {
+					root = make_node(l, k, r);
+				}
+				root->_parent = NULL;
+				return root;
+			};
+
+			// Unlink the maximum of the subtree nd into max and return the rebalanced rest
+			tnode *detach_max( tnode *nd, tnode *&max ) {
+				if (nd->_right == NULL) {
+					max = nd;
+					tnode *left = nd->_left;
+					if (left) {
+						left->_parent = nd->_parent;
+					}
+					nd->_left = NULL;
+					return left;
+				}
+				nd->_right = detach_max(nd->_right, max);
+				if (nd->_right) {
+					nd->_right->_parent = nd;
+				}
+				return balance(nd);
+			};
+
+			// Join two trees, every key of l being less than every key of r
+			tnode *join_trees( tnode *l, tnode *r ) {
+				if (l == NULL) {
+					return r;
+				}
+				if (r == NULL) {
+					return l;
+				}
+				tnode *max = NULL;
+				l = detach_max(l, max);
+				if (l) {
+					l->_parent = NULL;
+				}
+				return join_tree(l, max, r);
+			};
+
+			// Split nd into the keys less than key and the keys greater, return the node of key if any
+			tnode *split_tree( tnode *nd, const Key& key, tnode *&less, tnode *&greater ) {
+				if (nd == NULL) {
+					less = NULL;
+					greater = NULL;
+					return NULL;
+				}
+				tnode *l = nd->_left;
+				tnode *r = nd->_right;
+				if (l) {
+					l->_parent = NULL;
+				}
+				if (r) {
+					r->_parent = NULL;
+				}
+				tnode *found;
+				if (compare(key, _key(nd->_data))) {
+					tnode *middle = NULL;
+					found = split_tree(l, key, less, middle);
+					greater = join_tree(middle, nd, r);
+				}
+				else if (compare(_key(nd->_data), key)) {
+					tnode *middle = NULL;
+					found = split_tree(r, key, middle, greater);
+					less = join_tree(l, nd, middle);
+				}
+				else {
+					less = l;
+					greater = r;
+					nd->_left = NULL;
+					nd->_right = NULL;
+					nd->_parent = NULL;
+					found = nd;
+				}
+				return found;
+			};
+
+			// Union of t1 and t2, the nodes of t2 whose key is in t1 are gathered in rest and counted in dups
+			tnode *union_trees( tnode *t1, tnode *t2, tnode *&rest, size_type& dups ) {
+				if (t1 == NULL || t2 == NULL) {
+					rest = NULL;
+					return t1 ? t1 : t2;
+				}
+				tnode *l1 = t1->_left;
+				tnode *r1 = t1->_right;
+				tnode *l2 = NULL;
+				tnode *r2 = NULL;
+				tnode *dup = split_tree(t2, _key(t1->_data), l2, r2);
+				tnode *rest_l = NULL;
+				tnode *rest_r = NULL;
+				tnode *l = union_trees(l1, l2, rest_l, dups);
+				tnode *r = union_trees(r1, r2, rest_r, dups);
+				if (dup) {
+					dups++;
+					rest = join_tree(rest_l, dup, rest_r);
+				}
+				else {
+					rest = join_trees(rest_l, rest_r);
+				}
+				return join_tree(l, t1, r);
+			};
+
+			// Nodes of t1 whose key is in t2, counted in kept, every other node is freed
+			tnode *intersect_trees( tnode *t1, tnode *t2, size_type& kept ) {
+				if (t1 == NULL || t2 == NULL) {
+					free_tree(t1 ? t1 : t2);
+					return NULL;
+				}
+				tnode *l1 = t1->_left;
+				tnode *r1 = t1->_right;
+				tnode *l2 = NULL;
+				tnode *r2 = NULL;
+				tnode *dup = split_tree(t2, _key(t1->_data), l2, r2);
+				tnode *l = intersect_trees(l1, l2, kept);
+				tnode *r = intersect_trees(r1, r2, kept);
+				if (dup) {
+					kept++;
+					free_node(dup);
+					return join_tree(l, t1, r);
+				}
+				free_node(t1);
+				return join_trees(l, r);
+			};
+
+			// Nodes of t1 whose key is not in t2, the nodes of t1 freed are counted in removed
+			tnode *subtract_trees( tnode *t1, tnode *t2, size_type& removed ) {
+				if (t1 == NULL || t2 == NULL) {
+					free_tree(t2);
+					return t1;
+				}
+				tnode *l2 = t2->_left;
+				tnode *r2 = t2->_right;
+				tnode *l1 = NULL;
+				tnode *r1 = NULL;
+				tnode *dup = split_tree(t1, _key(t2->_data), l1, r1);
+				if (dup) {
+					removed++;
+					free_node(dup);
+				}
+				free_node(t2);
+				tnode *l = subtract_trees(l1, l2, removed);
+				tnode *r = subtract_trees(r1, r2, removed);
+				return join_trees(l, r);
+			};
+
+			// The sentinel holds a default value so that dereferencing end() stays harmless
+			void	initialize_end() {
+				_end = new_node(value_type(), NULL);
+			};
+
+	};
+
+}; // namespace ft
+
+#endif /*TREE_HPP*/
@@ -0,0 +1,289 @@
+#pragma once
+
+#ifndef TREE_ITERATORS_HPP
+# define TREE_ITERATORS_HPP
+
+namespace ft {
+
+	/*
+	**	Tree_iterators
+	**
+	**	Bidirectional iterator over the nodes of an ft::tree, shared by map, set,
+	**	multimap and multiset. Moving only follows the links between nodes and never
+	**	compares keys, so it also walks through runs of equivalent keys.
+	*/
+
+	template < typename node, typename T >
+		class tree_iterators {
+
+			public:
+
+				/**********************************/
+				/*****      MEMBER TYPES      *****/
+				/**********************************/
+
+				typedef T                               	value_type;
+				typedef T*                              	pointer;
+				typedef T&                              	reference;
+				typedef std::ptrdiff_t                  	difference_type;
+				typedef std::size_t                     	size_type;
+				typedef std::bidirectional_iterator_tag 	iterator_category;
+
+			private:
+
+				/**************************************/
+				/*****      MEMBER ATTRIBUTES     *****/
+				/**************************************/
+
+				node    *_current;
+
+			public:
+
+				/**************************************/
+				/*****      MEMBER FUNCTIONS      *****/
+				/**************************************/
+
+				tree_iterators()
+					: _current(NULL) {
+				};
+
+				tree_iterators( node *ptr )
+					: _current(ptr) {
+				};
+
+				tree_iterators( const tree_iterators &other )
+					: _current(other._current) {
+				};
+
+				virtual ~tree_iterators() {
+				};
+
+				tree_iterators &operator=( const tree_iterators &other ) {
+					if ( this != &other ) {
+						this->_current = other._current;
+					}
+					return *this;
+				};
+
+				/*
+				**	Operator+= / Operator-=
+				**
+				**	Moves the iterator n positions in key order: the rank of the current node
+				**	is computed on the way up to the root, and the node at rank + n is selected
+				**	on the way down. O(log n) with FT_MAP_ORDER_STATISTICS, O(n) otherwise.
+				*/
+
+				tree_iterators &operator+=( difference_type n ) {
+					node *root = find_root(_current);
+					difference_type pos = static_cast<difference_type>(node_rank(_current)) + n;
+					node *nd = NULL;
+					if (pos >= 0) {
+						nd = select(root, static_cast<size_type>(pos));
+					}
+					_current = nd ? nd : find_sentinel(_current);
+					return *this;
+				};
+
+				tree_iterators &operator-=( difference_type n ) {
+					return *this += -n;
+				};
+
+				tree_iterators operator+( difference_type n ) const {
+					tree_iterators temp = *this;
+					return temp += n;
+				};
+
+				tree_iterators operator-( difference_type n ) const {
+					tree_iterators temp = *this;
+					return temp -= n;
+				};
+
+				/*
+				**	Operator- (distance)
+				**
+				**	Returns the number of increments needed to go from rhs to lhs.
+				*/
+
+				friend difference_type operator-( const tree_iterators& lhs, const tree_iterators& rhs ) {
+					return static_cast<difference_type>(node_rank(lhs._current)) - static_cast<difference_type>(node_rank(rhs._current));
+				};
+
+
+
+				/************************************/
+				/*****      ELEMENT ACCESS      *****/
+				/************************************/
+
+
+
+				operator tree_iterators<node, T const>() const {
+					return tree_iterators<node, T const>(_current);
+				};
+
+				reference operator*() const {
+					return _current->_data;
+				};
+
+				pointer operator->() const {
+					return &_current->_data;
+				};
+
+
+
+				/*******************************/
+				/*****      OPERATORS      *****/
+				/*******************************/
+
+
+
+				tree_iterators& operator++() {
+					if (_current->_right) {
+						_current = _current->_right;
+						while (_current->_left != NULL) {
+							_current = _current->_left;
+						}
+					}
+					else {
+						node *nd = _current;
+						while (nd->_parent && nd == nd->_parent->_right) {
+							nd = nd->_parent;
+						}
+						// Past the maximum, the climb ends at the root, which knows the sentinel
+						_current = nd->_parent ? nd->_parent : nd->_end;
+					}
+					return *this;
+				};
+
+				tree_iterators operator++(int) {
+					node *temp = _current;
+					++(*this);
+					return (tree_iterators(temp));
+				};
+
+				tree_iterators& operator--() {
+					if (_current->_left) {
+						_current = _current->_left;
+						while (_current->_right) {
+							_current = _current->_right;
+						}
+					}
+					else {
+						node *nd = _current;
+						while (nd->_parent && nd == nd->_parent->_left) {
+							nd = nd->_parent;
+						}
+						if (nd->_parent) {
+							_current = nd->_parent;
+						}
+					}
+					return *this;
+				};
+
+				tree_iterators operator--(int) {
+					node *temp = _current;
+					--(*this);
+					return (tree_iterators(temp));
+				};
+
+				node *find_end( node *N ) {
+					return find_sentinel(N);
+				};
+
+				node *find_last( node *N ) {
+					node *temp = N;
+					while (temp->_parent) {
+						temp = temp->_parent;
+					}
+					while (temp->_right) {
+						temp = temp->_right;
+					}
+					return temp;
+				};
+
+				node	*getnode() const {
+					return _current;
+				};
+
+			private:
+
+				static size_type	node_size( node *nd ) {
+					if (nd == NULL) {
+						return 0;
+					}
+# ifdef FT_MAP_ORDER_STATISTICS
+					return nd->_count;
+# else
+					return 1 + node_size(nd->_left) + node_size(nd->_right);
+# endif
+				};
+
+				// The sentinel node is the only one without a sentinel, its parent is the maximum.
+				// Only the root is guaranteed to point to the sentinel of its map.
+				static node	*find_sentinel( node *nd ) {
+					if (nd->_end == NULL) {
+						return nd;
+					}
+					return find_root(nd)->_end;
+				};
+
+				static node	*find_root( node *nd ) {
+					if (nd->_end == NULL) {
+						nd = nd->_parent;
+					}
+					while (nd && nd->_parent) {
+						nd = nd->_parent;
+					}
+					return nd;
+				};
+
+				// Position of nd in key order, size() for the sentinel
+				static size_type	node_rank( node *nd ) {
+					if (nd == NULL) {
+						return 0;
+					}
+					if (nd->_end == NULL) {
+						return node_size(find_root(nd));
+					}
+					size_type r = node_size(nd->_left);
+					while (nd->_parent) {
+						if (nd == nd->_parent->_right) {
+							r += node_size(nd->_parent->_left) + 1;
+						}
+						nd = nd->_parent;
+					}
+					return r;
+				};
+
+				static node	*select( node *nd, size_type k ) {
+					while (nd != NULL) {
+						size_type left = node_size(nd->_left);
+						if (k < left) {
+							nd = nd->_left;
+						}
+						else if (k == left) {
+							return nd;
+						}
+						else {
+							k -= left + 1;
+							nd = nd->_right;
+						}
+					}
+					return NULL;
+				};
+
+			public:
+
+				friend bool operator==( const tree_iterators& lhs, const tree_iterators& rhs ) {
+					return lhs._current == rhs._current;
+				};
+
+				friend bool operator!=( const tree_iterators& lhs, const tree_iterators& rhs ) {
+					return lhs._current != rhs._current;
+				};
+
+		}; // tree_iterators
+
+}; // namespace ft
+
+
+#endif /* TREE_ITERATORS_HPP */
@@ -0,0 +1,645 @@
+#pragma once
+
+#ifndef UNORDERED_MAP_HPP
+# define UNORDERED_MAP_HPP
+
+# include "utils.hpp"
+
+namespace ft {
+
+	/*
+	**	Unordered_map
+	**
+	**	Hash map with open addressing in the style of the Swiss tables. The slots hold
+	**	the values inline, next to an array of one control byte per slot (see swiss_group).
+	**	The hash of a key is cut in two: its high bits (h1) choose the group of 16 slots
+	**	where probing starts, its 7 low bits (h2) are stored in the control byte.
+	**	A lookup compares h2 with the 16 control bytes of a group at once and only
+	**	compares keys on a match; it stops at the first group holding an empty slot.
+	**	Groups are visited in triangular order, which covers the whole table since the
+	**	number of groups is a power of 2. The table is kept at most 7/8 full.
+	**	Erasing leaves a deleted marker, unless the group still has an empty slot (then
+	**	no probe sequence goes through it). Markers are purged when the table is rebuilt.
+	**	Inserting may rebuild the table and then invalidates all iterators; erasing
+	**	only invalidates the iterators to the erased element.
+	*/
+
+	template < typename Key, typename T, typename Hash = ft::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+		typename Allocator = std::allocator<ft::pair<const Key, T> > >
+	class unordered_map
+	{
+
+			/**********************************/
+			/*****      MEMBER TYPES      *****/
+			/**********************************/
+
+		public:
+
+			typedef Key																													key_type;
+			typedef T																														mapped_type;
+			typedef typename ft::pair<const Key, T>															value_type;
+
+			typedef std::size_t																									size_type;
+			typedef std::ptrdiff_t																							difference_type;
+
+			typedef Hash																												hasher;
+			typedef KeyEqual																										key_equal;
+			typedef Allocator																										allocator_type;
+			typedef value_type&																									reference;
+			typedef const value_type&																						const_reference;
+
+			typedef typename allocator_type::pointer														pointer;
+			typedef typename allocator_type::const_pointer											const_pointer;
+			typedef unordered_map_iterators<value_type, value_type>							iterator;
+			typedef unordered_map_iterators<value_type, const value_type>				const_iterator;
+
+		protected:
+
+			typedef typename allocator_type::template rebind<signed char>::other	ctrl_alloc;
+
+		private:
+
+			/***************************************/
+			/*****      MEMBER ATTRIBUTES      *****/
+			/***************************************/
+
+			ctrl_alloc			_allocCtrl;
+			allocator_type	_alloc;
+			signed char			*_ctrl;
+			value_type			*_slots;
+			size_type				_capacity;
+			size_type				_size;
+			size_type				_growth_left;
+			Hash						_hash;
+			KeyEqual				_equal;
+
+		public:
+
+			/**************************************/
+			/*****      MEMBER FUNCTIONS      *****/
+			/**************************************/
+
+
+
+			/*
+			**	Constructors
+			**
+			**		1) Constructs an empty container, with room for bucket_count elements.
+			**		2) Constructs the container with the contents of the range [first, last).
+			**		3) Copy constructor. Constructs the container with the copy of the contents of other.
+			*/
+
+			explicit unordered_map( size_type bucket_count = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+				const Allocator& alloc = Allocator() )
+				: _allocCtrl(alloc), _alloc(alloc), _ctrl(NULL), _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+				_hash(hash), _equal(equal) {
+				reserve(bucket_count);
+			};
+
+			template< class InputIt >
+			unordered_map( InputIt first, InputIt last, size_type bucket_count = 0, const Hash& hash = Hash(),
+				const KeyEqual& equal = KeyEqual(), const Allocator& alloc = Allocator() )
+				: _allocCtrl(alloc), _alloc(alloc), _ctrl(NULL), _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+				_hash(hash), _equal(equal) {
+				reserve(bucket_count);
+				insert(first, last);
+			};
+
+			unordered_map( const unordered_map& other )
+				: _allocCtrl(other._allocCtrl), _alloc(other._alloc), _ctrl(NULL), _slots(NULL), _capacity(0), _size(0),
+				_growth_left(0), _hash(other._hash), _equal(other._equal) {
+				reserve(other._size);
+				insert(other.begin(), other.end());
+			};
+
+
+			/*
+			**	Destructor
+			*/
+
+			~unordered_map() {
+				clear();
+				release_table();
+			};
+
+
+			/*
+			**	Operator=
+			**
+			**	Copy assignment operator. Replaces the contents with a copy of the contents of other.
+			*/
+
+			unordered_map& operator=( const unordered_map& other ) {
+				if (this != &other) {
+					clear();
+					_hash = other._hash;
+					_equal = other._equal;
+					reserve(other._size);
+					insert(other.begin(), other.end());
+				}
+				return *this;
+			};
+
+
+			/*
+			**	Get_allocator
+			**
+			**	Returns the allocator associated with the container.
+			*/
+
+			allocator_type	get_allocator() const {
+				return _alloc;
+			};
+
+
+
+			/************************************/
+			/*****      ELEMENT ACCESS      *****/
+			/************************************/
+
+
+
+			/*
+			**	At
+			**
+			**	Returns a reference to the mapped value of the element with key equivalent to key.
+			**	If no such element exists, an exception of type std::out_of_range is thrown.
+			*/
+
+			T& at( const Key& key ) {
+				size_type i = find_index(key, _hash(key));
+				if (i == _capacity) {
+					throw std::out_of_range("Key not found");
+				}
+				return _slots[i].second;
+			};
+
+			const T& at( const Key& key ) const {
+				size_type i = find_index(key, _hash(key));
+				if (i == _capacity) {
+					throw std::out_of_range("Key not found");
+				}
+				return _slots[i].second;
+			};
+
+
+			/*
+			**	Operator[]
+			**
+			**	Returns a reference to the value that is mapped to a key equivalent to key,
+			**	inserting value_type(key, T()) if such key does not already exist.
+			*/
+
+			T& operator[]( const Key& key ) {
+				size_type hash = _hash(key);
+				size_type i = find_index(key, hash);
+				if (i == _capacity) {
+					i = insert_new(value_type(key, T()), hash);
+				}
+				return _slots[i].second;
+			};
+
+
+
+			/******************************/
+			/*****      ITERATOR      *****/
+			/******************************/
+
+
+
+			iterator begin() {
+				iterator it(_ctrl, _slots, 0, _capacity);
+				it.skip_free();
+				return it;
+			};
+
+			const_iterator begin() const {
+				const_iterator it(_ctrl, _slots, 0, _capacity);
+				it.skip_free();
+				return it;
+			};
+
+			iterator end() {
+				return iterator(_ctrl, _slots, _capacity, _capacity);
+			};
+
+			const_iterator end() const {
+				return const_iterator(_ctrl, _slots, _capacity, _capacity);
+			};
+
+
+
+			/******************************/
+			/*****      CAPACITY      *****/
+			/******************************/
+
+
+
+			bool empty() const {
+				return _size == 0;
+			};
+
+			size_type	size() const {
+				return _size;
+			};
+
+			size_type	max_size() const {
+				return _alloc.max_size();
+			};
+
+
+
+			/*******************************/
+			/*****      MODIFIERS      *****/
+			/*******************************/
+
+
+
+			/*
+			**	Clear
+			**
+			**	Erases all elements from the container. The table keeps its capacity.
+			*/
+
+			void clear() {
+				for (size_type i = 0; i < _capacity; i++) {
+					if (_ctrl[i] >= 0) {
+						_alloc.destroy(_slots + i);
+					}
+					_ctrl[i] = swiss_empty;
+				}
+				_size = 0;
+				_growth_left = max_load(_capacity);
+			};
+
+
+			/*
+			**	Insert
+			**
+			**	Inserts element(s) into the container, if the container doesn't already
+			**	contain an element with an equivalent key.
+			**		1) Inserts value.
+			**		2) Inserts elements from range [first, last).
+			*/
+
+			pair<iterator, bool> insert( const value_type& value ) {
+				size_type hash = _hash(value.first);
+				size_type i = find_index(value.first, hash);
+				if (i != _capacity) {
+					return pair<iterator, bool>(iterator_at(i), false);
+				}
+				i = insert_new(value, hash);
+				return pair<iterator, bool>(iterator_at(i), true);
+			};
+
+			template< class InputIt >
+			void insert( InputIt first, InputIt last ) {
+				for (; first != last; ++first) {
+					insert(*first);
+				}
+			};
+
+
+			/*
+			**	Erase
+			**
+			**	Removes specified elements from the container.
+			**		1) Removes the element at pos.
+			**		2) Removes the elements in the range [first; last).
+			**		3) Removes the element (if one exists) with the key equivalent to key.
+			**	Elements never move on erase, so iterators to the other elements stay valid.
+			*/
+
+			void erase( iterator pos ) {
+				erase_at(pos.getindex());
+			};
+
+			void erase( iterator first, iterator last ) {
+				while (first != last) {
+					iterator next = first;
+					++next;
+					erase_at(first.getindex());
+					first = next;
+				}
+			};
+
+			size_type erase( const Key& key ) {
+				size_type i = find_index(key, _hash(key));
+				if (i == _capacity) {
+					return 0;
+				}
+				erase_at(i);
+				return 1;
+			};
+
+
+			/*
+			**	Swap
+			**
+			**	Exchanges the contents of the container with those of other.
+			*/
+
+			void swap( unordered_map& other ) {
+				std::swap(_allocCtrl, other._allocCtrl);
+				std::swap(_alloc, other._alloc);
+				std::swap(_ctrl, other._ctrl);
+				std::swap(_slots, other._slots);
+				std::swap(_capacity, other._capacity);
+				std::swap(_size, other._size);
+				std::swap(_growth_left, other._growth_left);
+				std::swap(_hash, other._hash);
+				std::swap(_equal, other._equal);
+			};
+
+
+
+			/****************************/
+			/*****      LOOKUP      *****/
+			/****************************/
+
+
+
+			size_type count( const Key& key ) const {
+				return find_index(key, _hash(key)) == _capacity ? 0 : 1;
+			};
+
+			iterator find( const Key& key ) {
+				return iterator_at(find_index(key, _hash(key)));
+			};
+
+			const_iterator find( const Key& key ) const {
+				return const_iterator(_ctrl, _slots, find_index(key, _hash(key)), _capacity);
+			};
+
+			ft::pair<iterator,iterator> equal_range( const Key& key ) {
+				iterator first = find(key);
+				iterator last = first;
+				if (last != end()) {
+					++last;
+				}
+				return ft::pair<iterator,iterator>(first, last);
+			};
+
+			ft::pair<const_iterator,const_iterator> equal_range( const Key& key ) const {
+				const_iterator first = find(key);
+				const_iterator last = first;
+				if (last != end()) {
+					++last;
+				}
+				return ft::pair<const_iterator,const_iterator>(first, last);
+			};
+
+
+
+			/*****************************/
+			/*****      BUCKETS      *****/
+			/*****************************/
+
+
+
+			/*
+			**	Bucket_count
+			**
+			**	Number of slots of the table, a power of 2 and a multiple of the group width.
+			*/
+
+			size_type bucket_count() const {
+				return _capacity;
+			};
+
+			float load_factor() const {
+				return _capacity ? static_cast<float>(_size) / _capacity : 0.0f;
+			};
+
+			float max_load_factor() const {
+				return 0.875f;
+			};
+
+
+			/*
+			**	Rehash / Reserve
+			**
+			**	Rehash rebuilds the table with at least count slots and enough room for
+			**	the current elements. Reserve makes room for count elements without
+			**	further rebuilds; it never shrinks the table.
+			*/
+
+			void rehash( size_type count ) {
+				size_type capacity = capacity_for(_size);
+				while (capacity < count) {
+					capacity *= 2;
+				}
+				resize(capacity);
+			};
+
+			void reserve( size_type count ) {
+				if (count > max_load(_capacity)) {
+					resize(capacity_for(count));
+				}
+			};
+
+
+
+			/*******************************/
+			/*****      OBSERVERS      *****/
+			/*******************************/
+
+
+
+			hasher hash_function() const {
+				return _hash;
+			};
+
+			key_equal key_eq() const {
+				return _equal;
+			};
+
+
+
+			/***************************/
+			/*****      TABLE      *****/
+			/***************************/
+
+
+
+		private:
+
+			static size_type	max_load( size_type capacity ) {
+				return capacity - capacity / 8;
+			};
+
+			// Smallest table holding count elements
+			static size_type	capacity_for( size_type count ) {
+				size_type capacity = swiss_width;
+				while (max_load(capacity) < count) {
+					capacity *= 2;
+				}
+				return capacity;
+			};
+
+			static signed char	h2( size_type hash ) {
+				return static_cast<signed char>(hash & 0x7F);
+			};
+
+			iterator	iterator_at( size_type i ) {
+				return iterator(_ctrl, _slots, i, _capacity);
+			};
+
+			// Slot of key, or _capacity if key is absent
+			size_type	find_index( const Key& key, size_type hash ) const {
+				if (_capacity == 0) {
+					return _capacity;
+				}
+				size_type mask = _capacity / swiss_width - 1;
+				size_type group = (hash >> 7) & mask;
+				for (size_type step = 1; ; step++) {
+					swiss_group g(_ctrl + group * swiss_width);
+					for (int match = g.match(h2(hash)); match; match &= match - 1) {
+						size_type i = group * swiss_width + __builtin_ctz(match);
+						if (_equal(_slots[i].first, key)) {
+							return i;
+						}
+					}
+					if (g.match_empty()) {
+						return _capacity;
+					}
+					group = (group + step) & mask;
+				}
+			};
+
+			// First empty or deleted slot on the probe sequence of hash
+			size_type	free_index( size_type hash ) const {
+				size_type mask = _capacity / swiss_width - 1;
+				size_type group = (hash >> 7) & mask;
+				for (size_type step = 1; ; step++) {
+					int match = swiss_group(_ctrl + group * swiss_width).match_empty_or_deleted();
+					if (match) {
+						return group * swiss_width + __builtin_ctz(match);
+					}
+					group = (group + step) & mask;
+				}
+			};
+
+			// Store value, whose key is known to be absent, and return its slot
+			size_type	insert_new( const value_type& value, size_type hash ) {
+				if (_growth_left == 0) {
+					make_room();
+				}
+				size_type i = free_index(hash);
+				if (_ctrl[i] == swiss_empty) {
+					_growth_left--;
+				}
+				_alloc.construct(_slots + i, value);
+				_ctrl[i] = h2(hash);
+				_size++;
+				return i;
+			};
+
+			void	erase_at( size_type i ) {
+				_alloc.destroy(_slots + i);
+				size_type group = i & ~static_cast<size_type>(swiss_width - 1);
+				if (swiss_group(_ctrl + group).match_empty()) {
+					_ctrl[i] = swiss_empty;
+					_growth_left++;
+				}
+				else {
+					_ctrl[i] = swiss_deleted;
+				}
+				_size--;
+			};
+
+			// Out of empty slots: grow the table, or only purge the deleted markers if they are most of it
+			void	make_room() {
+				if (_capacity == 0) {
+					resize(swiss_width);
+				}
+				else if (_size * 2 < max_load(_capacity)) {
+					resize(_capacity);
+				}
+				else {
+					resize(_capacity * 2);
+				}
+			};
+
+			// Move every element into a new table of capacity slots
+			void	resize( size_type capacity ) {
+				signed char *ctrl = _allocCtrl.allocate(capacity);
+				value_type *slots = _alloc.allocate(capacity);
+				for (size_type i = 0; i < capacity; i++) {
+					ctrl[i] = swiss_empty;
+				}
+				signed char *old_ctrl = _ctrl;
+				value_type *old_slots = _slots;
+				size_type old_capacity = _capacity;
+				_ctrl = ctrl;
+				_slots = slots;
+				_capacity = capacity;
+				for (size_type i = 0; i < old_capacity; i++) {
+					if (old_ctrl[i] >= 0) {
+						size_type hash = _hash(old_slots[i].first);
+						size_type j = free_index(hash);
+						_alloc.construct(_slots + j, old_slots[i]);
+						_ctrl[j] = h2(hash);
+						_alloc.destroy(old_slots + i);
+					}
+				}
+				if (old_capacity) {
+					_allocCtrl.deallocate(old_ctrl, old_capacity);
+					_alloc.deallocate(old_slots, old_capacity);
+				}
+				_growth_left = max_load(_capacity) - _size;
+			};
+
+			void	release_table() {
+				if (_capacity) {
+					_allocCtrl.deallocate(_ctrl, _capacity);
+					_alloc.deallocate(_slots, _capacity);
+				}
+				_ctrl = NULL;
+				_slots = NULL;
+				_capacity = 0;
+				_growth_left = 0;
+			};
+
+	};
+
+	/******************************************/
+	/*****      NON-MEMBER FUNCTIONS      *****/
+	/******************************************/
+
+
+
+	/*
+	**	Operators
+	**
+	**	Two unordered_maps are equal if they hold the same elements, in any order.
+	*/
+
+	template< class Key, class T, class Hash, class KeyEqual, class Alloc >
+	bool operator==( const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& lhs, const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& rhs ) {
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		typename ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>::const_iterator it = lhs.begin();
+		for (; it != lhs.end(); ++it) {
+			typename ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>::const_iterator found = rhs.find(it->first);
+			if (found == rhs.end() || !(found->second == it->second)) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	template< class Key, class T, class Hash, class KeyEqual, class Alloc >
+	bool operator!=( const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& lhs, const ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& rhs ) {
+		return !(lhs == rhs);
+	};
+
+	template< class Key, class T, class Hash, class KeyEqual, class Alloc >
+	void swap( ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& lhs, ft::unordered_map<Key,T,Hash,KeyEqual,Alloc>& rhs ) {
+		lhs.swap(rhs);
+	};
+
+}; // namespace ft
+
+#endif /*UNORDERED_MAP_HPP*/
@@ -0,0 +1,146 @@
+#pragma once
+
+#ifndef UNORDERED_MAP_ITERATORS_HPP
+# define UNORDERED_MAP_ITERATORS_HPP
+
+namespace ft {
+
+	/*
+	**	Unordered_map_iterators
+	**
+	**	Forward iterator over the full slots of an unordered_map: an index into the
+	**	control bytes and the slots of the table. Incrementing skips the empty and
+	**	deleted slots a group of control bytes at a time; the past-the-end iterator
+	**	is the index equal to the capacity.
+	*/
+
+	template < typename Value, typename T >
+		class unordered_map_iterators {
+
+			public:
+
+				/**********************************/
+				/*****      MEMBER TYPES      *****/
+				/**********************************/
+
+				typedef T                               	value_type;
+				typedef T*                              	pointer;
+				typedef T&                              	reference;
+				typedef std::ptrdiff_t                  	difference_type;
+				typedef std::size_t                     	size_type;
+				typedef std::forward_iterator_tag       	iterator_category;
+
+			private:
+
+				/**************************************/
+				/*****      MEMBER ATTRIBUTES     *****/
+				/**************************************/
+
+				const signed char	*_ctrl;
+				Value							*_slots;
+				size_type					_index;
+				size_type					_capacity;
+
+			public:
+
+				/**************************************/
+				/*****      MEMBER FUNCTIONS      *****/
+				/**************************************/
+
+				unordered_map_iterators()
+					: _ctrl(NULL), _slots(NULL), _index(0), _capacity(0) {
+				};
+
+				unordered_map_iterators( const signed char *ctrl, Value *slots, size_type index, size_type capacity )
+					: _ctrl(ctrl), _slots(slots), _index(index), _capacity(capacity) {
+				};
+
+				unordered_map_iterators( const unordered_map_iterators &other )
+					: _ctrl(other._ctrl), _slots(other._slots), _index(other._index), _capacity(other._capacity) {
+				};
+
+				virtual ~unordered_map_iterators() {
+				};
+
+				unordered_map_iterators &operator=( const unordered_map_iterators &other ) {
+					if ( this != &other ) {
+						_ctrl = other._ctrl;
+						_slots = other._slots;
+						_index = other._index;
+						_capacity = other._capacity;
+					}
+					return *this;
+				};
+
+
+
+				/************************************/
+				/*****      ELEMENT ACCESS      *****/
+				/************************************/
+
+
+
+				operator unordered_map_iterators<Value, T const>() const {
+					return unordered_map_iterators<Value, T const>(_ctrl, _slots, _index, _capacity);
+				};
+
+				reference operator*() const {
+					return _slots[_index];
+				};
+
+				pointer operator->() const {
+					return _slots + _index;
+				};
+
+
+
+				/*******************************/
+				/*****      OPERATORS      *****/
+				/*******************************/
+
+
+
+				unordered_map_iterators& operator++() {
+					_index++;
+					skip_free();
+					return *this;
+				};
+
+				unordered_map_iterators operator++(int) {
+					unordered_map_iterators temp = *this;
+					++(*this);
+					return temp;
+				};
+
+				// Move forward to the first full slot at or after the current index
+				void	skip_free() {
+					while (_index < _capacity) {
+						size_type base = _index & ~static_cast<size_type>(swiss_width - 1);
+						int full = swiss_group(_ctrl + base).match_full() >> (_index - base);
+						if (full) {
+							_index += __builtin_ctz(full);
+							return;
+						}
+						_index = base + swiss_width;
+					}
+					_index = _capacity;
+				};
+
+				size_type	getindex() const {
+					return _index;
+				};
+
+				friend bool operator==( const unordered_map_iterators& lhs, const unordered_map_iterators& rhs ) {
+					return lhs._index == rhs._index && lhs._slots == rhs._slots;
+				};
+
+				friend bool operator!=( const unordered_map_iterators& lhs, const unordered_map_iterators& rhs ) {
+					return !(lhs == rhs);
+				};
+
+		}; // unordered_map_iterators
+
+}; // namespace ft
+
+
+#endif /* UNORDERED_MAP_ITERATORS_HPP */
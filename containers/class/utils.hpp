@@ -24,34 +24,138 @@
 # include <string>
 # include <time.h>
 # include <math.h>
+# include <iomanip>
 
 # include "iterator_traits.hpp"
 # include "reverse_iterator.hpp"
 # include "enable_if.hpp"
 # include "equal.hpp"
 # include "is_integral.hpp"
+# include "is_transparent.hpp"
 # include "lexicographical_compare.hpp"
 # include "vector_iterators.hpp"
+# include "vector_telemetry.hpp"
 # include "pair.hpp"
-# include "map_iterators.hpp"
+# include "hash.hpp"
+# include "tree_iterators.hpp"
+# include "btree_search.hpp"
+# include "btree_map_iterators.hpp"
+# include "persistent_map_iterators.hpp"
+# include "swiss_group.hpp"
+# include "unordered_map_iterators.hpp"
+# include "radix_node.hpp"
+# include "radix_map_iterators.hpp"
+# include "compact_map_iterators.hpp"
+# include "small_map_iterators.hpp"
+# include "incremental_vector_iterators.hpp"
 
 // STD lib
 # include <stack>
 # include <vector>
 # include <map>
+# include <set>
 
 // FT lib
 # include "stack.hpp"
 # include "vector.hpp"
+# include "tree.hpp"
 # include "map.hpp"
+# include "set.hpp"
+# include "multiset.hpp"
+# include "multimap.hpp"
+# include "btree_map.hpp"
+# include "persistent_map.hpp"
+# include "concurrent_map.hpp"
+# include "unordered_map.hpp"
+# include "radix_map.hpp"
+# include "compact_map.hpp"
+# include "lru_cache.hpp"
+# include "small_map.hpp"
+# include "incremental_vector.hpp"
+# include "perf.hpp"
+# include "tracking_allocator.hpp"
+# include "trace.hpp"
+# include "key_generator.hpp"
+
+// Slowest ratio mine / real accepted by Test_performance
+# define PERF_RATIO 20
+// Timed runs of a test step, after the untimed ones, see perf_step
+# define PERF_STEP_REPETITIONS 15
+# define PERF_STEP_WARMUP 2
 
 void	title(std::string str);
 void	annonce(std::string msg);
 void	Test_failure();
-void	Test_performance(long real_time, long mine_time);
+void	Test_performance(const ft::perf_stats& real, const ft::perf_stats& mine);
 void	Test_success();
 void	Test_timeout();
-long	get_time();
+
+/*
+**	Perf_step
+**
+**	Times op on a fresh copy of c, PERF_STEP_WARMUP times untimed then
+**	PERF_STEP_REPETITIONS times timed: the copy is made outside the measurement
+**	and c is left as it was. A test step times std and PRE on the same state
+**	this way and compares the medians with Test_performance.
+*/
+
+template< class Container, class Op >
+ft::perf_stats	perf_step( const Container& c, Op op ) {
+	ft::perf_timer t(PERF_STEP_REPETITIONS, PERF_STEP_WARMUP);
+	while (t.next()) {
+		Container copy(c);
+		t.start();
+		op(copy);
+		t.stop();
+		ft::do_not_optimize(copy);
+	}
+	return t.stats();
+};
+
+// Steps shared by the containers
+struct step_copy
+{
+	template< class Container >
+	void	operator()( Container& c ) const {
+		Container copy(c);
+		ft::do_not_optimize(copy);
+	};
+};
+
+struct step_assign
+{
+	template< class Container >
+	void	operator()( Container& c ) const {
+		Container copy;
+		copy = c;
+		ft::do_not_optimize(copy);
+	};
+};
+
+struct step_range_construct
+{
+	template< class Container >
+	void	operator()( Container& c ) const {
+		Container copy(c.begin(), c.end());
+		ft::do_not_optimize(copy);
+	};
+};
+
+struct step_clear
+{
+	template< class Container >
+	void	operator()( Container& c ) const {
+		c.clear();
+	};
+};
+
+struct step_swap_self
+{
+	template< class Container >
+	void	operator()( Container& c ) const {
+		c.swap(c);
+	};
+};
 
 void	launch_stack();
 
@@ -61,4 +165,29 @@ void	launch_vector_iterators();
 void launch_map();
 void launch_map_iterators();
 
+void launch_set();
+void launch_multiset();
+void launch_multimap();
+
+void launch_btree_map();
+
+void launch_persistent_map();
+
+void launch_concurrent_map();
+
+void launch_unordered_map();
+
+void launch_radix_map();
+
+void launch_compact_map();
+
+void launch_lru_cache();
+void launch_small_map();
+void launch_incremental_vector();
+void launch_tracking_allocator();
+void launch_trace();
+void launch_key_generator();
+
+void launch_performance();
+
 #endif /* UTILS_HPP */
@@ -425,6 +425,7 @@ namespace ft {
 					_alloc.deallocate(_data, _capacity);
 					_data = tmp;
 					_capacity = new_cap;
+					FT_VECTOR_EVENT(vector_reallocate, _size, new_cap * sizeof(T), (new_cap - _size) * sizeof(T));
 				}
 			};
 
@@ -480,8 +481,8 @@ namespace ft {
 				if (_size + 1 > _capacity) {
 					reserve(_size + 1);
 				}
-				if (index > 0) {
-					shift_right(index , 1);
+				if (index < _size) {
+					shift_right(index, 1);
 				}
 				_alloc.construct(_data + index, value);
 				_size++;
@@ -633,6 +634,21 @@ namespace ft {
 				std::swap( _capacity, other._capacity);
 			};
 
+# ifdef FT_VECTOR_TELEMETRY
+
+
+			/*
+			**	Spare_bytes
+			**
+			**	Returns the bytes allocated for elements the vector does not hold.
+			**	Only built with -D FT_VECTOR_TELEMETRY, see vector_telemetry.hpp.
+			*/
+
+			size_type spare_bytes() const {
+				return (_capacity - _size) * sizeof(T);
+			};
+# endif
+
 
 
 			/****************************************/
@@ -660,15 +676,19 @@ namespace ft {
 						break;
 					}
 				}
+				FT_VECTOR_EVENT(vector_shift, _size - pos, (_size - pos) * sizeof(T), 0);
 			};
 
 			// Shift all my vector elements from pos to the left n times
 			void	shift_left( size_type pos, size_type n ) {
-				for (; pos < _size && pos + n < _capacity; pos++) {
+				size_type from = pos;
+				for (; pos + n < _size; pos++) {
 					_alloc.construct(_data + pos, _data[pos + n]);
 					_alloc.destroy(_data + pos + n);
-					}
-				};
+				}
+				FT_VECTOR_EVENT(vector_shift, pos - from, (pos - from) * sizeof(T), 0);
+				(void)from;
+			};
 
 			// Throw an error if the element is out of range for the vector
 			void	range_check( size_type pos ) const {
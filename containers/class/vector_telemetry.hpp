@@ -0,0 +1,124 @@
+#pragma once
+
+#ifndef VECTOR_TELEMETRY_HPP
+# define VECTOR_TELEMETRY_HPP
+
+# include <cstddef>
+
+/*
+**	Vector telemetry
+**
+**	Build with -D FT_VECTOR_TELEMETRY to make every ft::vector report its
+**	reallocations and the elements insert and erase shift. Each event updates the
+**	process-wide counters of vector_telemetry_counters(), then goes to the hook
+**	set with set_vector_telemetry_hook(), if any: the hook may sample the events
+**	into a metrics pipeline. Without the flag no event is built and nothing is counted.
+*/
+
+# ifdef FT_VECTOR_TELEMETRY
+#  define FT_VECTOR_EVENT(kind, elements, bytes, spare) ft::vector_telemetry_record(kind, elements, bytes, spare)
+# else
+#  define FT_VECTOR_EVENT(kind, elements, bytes, spare) ((void)0)
+# endif
+
+namespace ft {
+
+	/*
+	**	Vector_event
+	**
+	**		- vector_reallocate: reserve() moved elements to new storage of bytes
+	**		 bytes, spare_bytes of which are capacity left unused.
+	**		- vector_shift: insert or erase moved elements, bytes in total.
+	*/
+
+	enum vector_event_kind
+	{
+		vector_reallocate,
+		vector_shift
+	};
+
+	struct vector_event
+	{
+		vector_event_kind	kind;
+		std::size_t				elements;
+		std::size_t				bytes;
+		std::size_t				spare_bytes;
+	};
+
+	struct vector_telemetry
+	{
+		std::size_t	reallocations;
+		std::size_t	reallocated_elements;
+		std::size_t	shifted_elements;
+		// Unused capacity left by the reallocations, summed over all of them
+		std::size_t	spare_bytes;
+		std::size_t	largest_reallocation;
+	};
+
+	// Called on every event, with the context given to set_vector_telemetry_hook()
+	typedef void	(*vector_telemetry_hook)( const vector_event& event, void *context );
+
+	// Static storage of a header-only library: one instance per program
+	template< typename Dummy >
+	struct vector_telemetry_state
+	{
+		static vector_telemetry				counters;
+		static vector_telemetry_hook	hook;
+		static void										*context;
+	};
+
+	template< typename Dummy >
+	vector_telemetry	vector_telemetry_state<Dummy>::counters = vector_telemetry();
+
+	template< typename Dummy >
+	vector_telemetry_hook	vector_telemetry_state<Dummy>::hook = NULL;
+
+	template< typename Dummy >
+	void	*vector_telemetry_state<Dummy>::context = NULL;
+
+	// The counters are updated atomically, vectors of several threads may share them
+	inline vector_telemetry	vector_telemetry_counters() {
+		return vector_telemetry_state<void>::counters;
+	};
+
+	inline void	reset_vector_telemetry() {
+		vector_telemetry_state<void>::counters = vector_telemetry();
+	};
+
+	// Set it before the threads that use vectors start; NULL removes it
+	inline void	set_vector_telemetry_hook( vector_telemetry_hook hook, void *context = NULL ) {
+		vector_telemetry_state<void>::hook = hook;
+		vector_telemetry_state<void>::context = context;
+	};
+
+	inline void	vector_telemetry_record( vector_event_kind kind, std::size_t elements, std::size_t bytes, std::size_t spare_bytes ) {
+		vector_telemetry& c = vector_telemetry_state<void>::counters;
+		if (kind == vector_shift && elements == 0) {
+			return;
+		}
+		if (kind == vector_reallocate) {
+			__sync_fetch_and_add(&c.reallocations, 1);
+			__sync_fetch_and_add(&c.reallocated_elements, elements);
+			__sync_fetch_and_add(&c.spare_bytes, spare_bytes);
+			std::size_t largest = c.largest_reallocation;
+			while (bytes > largest) {
+				std::size_t seen = __sync_val_compare_and_swap(&c.largest_reallocation, largest, bytes);
+				if (seen == largest) {
+					break;
+				}
+				largest = seen;
+			}
+		}
+		else {
+			__sync_fetch_and_add(&c.shifted_elements, elements);
+		}
+		vector_telemetry_hook hook = vector_telemetry_state<void>::hook;
+		if (hook) {
+			vector_event event = { kind, elements, bytes, spare_bytes };
+			hook(event, vector_telemetry_state<void>::context);
+		}
+	};
+
+}; // namespace ft
+
+#endif /*VECTOR_TELEMETRY_HPP*/
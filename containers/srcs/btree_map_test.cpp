@@ -0,0 +1,282 @@
+#include "../class/utils.hpp"
+
+// Check that a btree_map holds exactly the same elements as a std::map, in both directions
+template< class Real, class Mine >
+bool	btree_same_content( const Real& real, const Mine& mine ) {
+	if (real.size() != mine.size()) {
+		std::cout << "Real map: " << real.size() << std::endl;
+		std::cout << "Mine map: " << mine.size() << std::endl;
+		return false;
+	}
+	typename Real::const_iterator rit = real.begin();
+	typename Mine::const_iterator mit = mine.begin();
+	for (; rit != real.end(); ++rit, ++mit) {
+		if (mit == mine.end() || rit->first != mit->first || rit->second != mit->second) {
+			return false;
+		}
+	}
+	if (mit != mine.end()) {
+		return false;
+	}
+	typename Real::const_reverse_iterator rrit = real.rbegin();
+	typename Mine::const_reverse_iterator mrit = mine.rbegin();
+	for (; rrit != real.rend(); ++rrit, ++mrit) {
+		if (rrit->first != mrit->first) {
+			return false;
+		}
+	}
+	return true;
+};
+
+void	btree_map_test_insert() {
+	title("\e[95m-Insert-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>		real;
+	ft::btree_map<int, int>	mine;
+
+	annonce("Insert 10000 random keys");
+	for (int i = 0; i < 10000; i++) {
+		int k = rand() % 20000 - 10000;
+		bool r = real.insert(std::make_pair(k, i)).second;
+		bool m = mine.insert(ft::make_pair(k, i)).second;
+		if (r != m) {
+			return Test_failure();
+		}
+	}
+	if (!btree_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Insert sorted keys");
+	std::map<int, int>		real2;
+	ft::btree_map<int, int>	mine2;
+	for (int i = 0; i < 5000; i++) {
+		real2[i] = i;
+		mine2[i] = i;
+	}
+	for (int i = 10000; i > 5000; i--) {
+		real2[i] = -i;
+		mine2[i] = -i;
+	}
+	if (!btree_same_content(real2, mine2)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Insert with good and bad hints");
+	for (int i = 0; i < 10000; i++) {
+		int k = rand() % 30000 - 15000;
+		ft::btree_map<int, int>::iterator hint = rand() % 4 ? mine.lower_bound(k) : mine.begin();
+		if (rand() % 3 == 0 && hint != mine.end()) {
+			++hint;
+		}
+		int v = real.insert(std::make_pair(k, -i)).first->second;
+		ft::btree_map<int, int>::iterator it = mine.insert(hint, ft::make_pair(k, -i));
+		if (it->first != k || it->second != v) {
+			return Test_failure();
+		}
+	}
+	for (std::map<int, int>::iterator rit = real.begin(); rit != real.end(); ++rit) {
+		if (mine.find(rit->first) == mine.end() || mine.find(rit->first)->second != rit->second) {
+			return Test_failure();
+		}
+	}
+	if (!btree_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	btree_map_test_find() {
+	title("\e[95m-Find-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>		real;
+	ft::btree_map<int, int>	mine;
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 10000;
+		real[k] = i;
+		mine[k] = i;
+	}
+
+	annonce("Find, count and at");
+	for (int k = -10; k < 10010; k++) {
+		std::map<int, int>::iterator rit = real.find(k);
+		ft::btree_map<int, int>::iterator mit = mine.find(k);
+		if ((rit == real.end()) != (mit == mine.end()) || real.count(k) != mine.count(k)) {
+			return Test_failure();
+		}
+		if (rit != real.end() && (mit->second != rit->second || mine.at(k) != real.at(k))) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Lower_bound and upper_bound");
+	for (int k = -10; k < 10010; k++) {
+		std::map<int, int>::iterator rlo = real.lower_bound(k);
+		ft::btree_map<int, int>::iterator mlo = mine.lower_bound(k);
+		std::map<int, int>::iterator rup = real.upper_bound(k);
+		ft::btree_map<int, int>::iterator mup = mine.upper_bound(k);
+		if ((rlo == real.end()) != (mlo == mine.end()) || (rlo != real.end() && rlo->first != mlo->first)) {
+			return Test_failure();
+		}
+		if ((rup == real.end()) != (mup == mine.end()) || (rup != real.end() && rup->first != mup->first)) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("At out of range");
+	try {
+		mine.at(-1);
+		return Test_failure();
+	}
+	catch (const std::exception& e) {
+		;
+	}
+	Test_success();
+};
+
+void	btree_map_test_erase() {
+	title("\e[95m-Erase-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>		real;
+	ft::btree_map<int, int>	mine;
+	for (int i = 0; i < 10000; i++) {
+		real[i] = i;
+		mine[i] = i;
+	}
+
+	annonce("Erase random keys");
+	for (int i = 0; i < 20000; i++) {
+		int k = rand() % 12000;
+		if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+	if (!btree_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase with iterator");
+	real.erase(real.begin());
+	mine.erase(mine.begin());
+	if (!btree_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase with range");
+	real.erase(real.lower_bound(3000), real.lower_bound(9000));
+	mine.erase(mine.lower_bound(3000), mine.lower_bound(9000));
+	if (!btree_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase random ranges and positions");
+	for (int i = 0; i < 20000; i++) {
+		int k = rand() % 50000;
+		real[k] = i;
+		mine[k] = i;
+	}
+	for (int i = 0; i < 300 && !real.empty(); i++) {
+		int lo = rand() % 50000;
+		int hi = lo + rand() % (i % 3 ? 50 : 2000);
+		real.erase(real.lower_bound(lo), real.lower_bound(hi));
+		mine.erase(mine.lower_bound(lo), mine.lower_bound(hi));
+		std::map<int, int>::iterator rit = real.lower_bound(hi);
+		if (rit != real.end()) {
+			real.erase(rit);
+			mine.erase(mine.lower_bound(hi));
+		}
+		if (i % 50 == 0 && !btree_same_content(real, mine)) {
+			return Test_failure();
+		}
+	}
+	if (!btree_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase everything");
+	real.erase(real.begin(), real.end());
+	mine.erase(mine.begin(), mine.end());
+	if (!btree_same_content(real, mine) || !mine.empty() || mine.begin() != mine.end()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	btree_map_test_strings() {
+	title("\e[95m-String keys-\e[39m");
+
+	std::map<std::string, int>			real;
+	ft::btree_map<std::string, int>	mine;
+
+	annonce("Insert and erase strings");
+	for (int i = 0; i < 3000; i++) {
+		std::ostringstream key;
+		key << "key" << (i * 7919) % 3001;
+		real[key.str()] = i;
+		mine[key.str()] = i;
+	}
+	for (int i = 0; i < 3000; i += 3) {
+		std::ostringstream key;
+		key << "key" << i;
+		real.erase(key.str());
+		mine.erase(key.str());
+	}
+	if (!btree_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	btree_map_test_copy_swap() {
+	title("\e[95m-Copy and swap-\e[39m");
+
+	ft::btree_map<int, int>	mine;
+	for (int i = 0; i < 2000; i++) {
+		mine[i] = i;
+	}
+
+	annonce("Copy constructor and operator =");
+	ft::btree_map<int, int>	copy(mine);
+	ft::btree_map<int, int>	assigned;
+	assigned[-1] = -1;
+	assigned = mine;
+	if (copy != mine || assigned != mine) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Swap");
+	ft::btree_map<int, int>	other;
+	other[42] = 42;
+	other.swap(copy);
+	if (other != mine || copy.size() != 1 || copy.begin()->first != 42) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Operator <");
+	if (!(copy > mine) || mine < mine) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_btree_map() {
+	title("\e[93m Btree_map: \e[39m");
+	btree_map_test_insert();
+	btree_map_test_find();
+	btree_map_test_erase();
+	btree_map_test_strings();
+	btree_map_test_copy_swap();
+};
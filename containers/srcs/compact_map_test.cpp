@@ -0,0 +1,350 @@
+#include "../class/utils.hpp"
+
+// Check that a compact_map holds exactly the same elements as a std::map, in both directions
+template< class Real, class Mine >
+bool	compact_same_content( const Real& real, const Mine& mine ) {
+	if (real.size() != mine.size()) {
+		std::cout << "Real map: " << real.size() << std::endl;
+		std::cout << "Mine map: " << mine.size() << std::endl;
+		return false;
+	}
+	typename Real::const_iterator rit = real.begin();
+	typename Mine::const_iterator mit = mine.begin();
+	for (; rit != real.end(); ++rit, ++mit) {
+		if (mit == mine.end() || rit->first != mit->first || rit->second != mit->second) {
+			return false;
+		}
+	}
+	if (mit != mine.end()) {
+		return false;
+	}
+	typename Real::const_reverse_iterator rrit = real.rbegin();
+	typename Mine::const_reverse_iterator mrit = mine.rbegin();
+	for (; rrit != real.rend(); ++rrit, ++mrit) {
+		if (rrit->first != mrit->first) {
+			return false;
+		}
+	}
+	return true;
+};
+
+void	compact_map_test_insert() {
+	title("\e[95m-Insert-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>				real;
+	ft::compact_map<int, int>	mine;
+
+	annonce("Insert 10000 random keys");
+	for (int i = 0; i < 10000; i++) {
+		int k = rand() % 20000 - 10000;
+		bool r = real.insert(std::make_pair(k, i)).second;
+		ft::pair<ft::compact_map<int, int>::iterator, bool> m = mine.insert(ft::make_pair(k, i));
+		if (r != m.second || m.first->first != k) {
+			return Test_failure();
+		}
+	}
+	if (!compact_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Insert with good and bad hints");
+	for (int i = 0; i < 10000; i++) {
+		int k = rand() % 30000 - 15000;
+		ft::compact_map<int, int>::iterator hint = rand() % 4 ? mine.lower_bound(k) : mine.begin();
+		if (rand() % 3 == 0 && hint != mine.end()) {
+			++hint;
+		}
+		int v = real.insert(std::make_pair(k, -i)).first->second;
+		ft::compact_map<int, int>::iterator it = mine.insert(hint, ft::make_pair(k, -i));
+		if (it->first != k || it->second != v) {
+			return Test_failure();
+		}
+	}
+	if (!compact_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Iterators survive the growth of the array");
+	ft::compact_map<int, int>	grown;
+	ft::compact_map<int, int>::iterator first = grown.insert(ft::make_pair(-1, -1)).first;
+	std::size_t capacity = grown.capacity();
+	for (int i = 0; i < 5000; i++) {
+		grown[i] = i;
+	}
+	if (grown.capacity() == capacity || first->first != -1 || first != grown.begin() || (++first)->first != 0) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Nodes are half the size of ft::map nodes");
+	if (sizeof(ft::compact_node< ft::pair<const int, int> >) > sizeof(ft::tree_node< ft::pair<const int, int> >) / 2) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Range constructor and reserve");
+	std::vector< ft::pair<int, int> > values;
+	for (int i = 0; i < 1000; i++) {
+		values.push_back(ft::make_pair(i % 700, i));
+	}
+	ft::compact_map<int, int> range(values.begin(), values.end());
+	if (range.size() != 700 || range.at(0) != 0 || range.at(699) != 699) {
+		return Test_failure();
+	}
+	range.reserve(5000);
+	if (range.capacity() < 5000 || range.size() != 700 || range.at(350) != 350) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	compact_map_test_find() {
+	title("\e[95m-Find-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>				real;
+	ft::compact_map<int, int>	mine;
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 10000;
+		real[k] = i;
+		mine[k] = i;
+	}
+
+	annonce("Find, count and at");
+	for (int k = -10; k < 10010; k++) {
+		std::map<int, int>::iterator rit = real.find(k);
+		ft::compact_map<int, int>::iterator mit = mine.find(k);
+		if ((rit == real.end()) != (mit == mine.end()) || real.count(k) != mine.count(k)) {
+			return Test_failure();
+		}
+		if (rit != real.end() && (mit->second != rit->second || mine.at(k) != rit->second)) {
+			return Test_failure();
+		}
+	}
+	try {
+		mine.at(20000);
+		return Test_failure();
+	}
+	catch (const std::out_of_range&) {
+	}
+	Test_success();
+
+	annonce("Lower_bound, upper_bound and equal_range");
+	for (int k = -10; k < 10010; k++) {
+		std::map<int, int>::iterator rlo = real.lower_bound(k);
+		ft::compact_map<int, int>::iterator mlo = mine.lower_bound(k);
+		std::map<int, int>::iterator rup = real.upper_bound(k);
+		ft::compact_map<int, int>::iterator mup = mine.upper_bound(k);
+		if ((rlo == real.end()) != (mlo == mine.end()) || (rup == real.end()) != (mup == mine.end())) {
+			return Test_failure();
+		}
+		if ((rlo != real.end() && rlo->first != mlo->first) || (rup != real.end() && rup->first != mup->first)) {
+			return Test_failure();
+		}
+		if (mine.equal_range(k).first != mlo || mine.equal_range(k).second != mup) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+};
+
+void	compact_map_test_erase() {
+	title("\e[95m-Erase-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>				real;
+	ft::compact_map<int, int>	mine;
+	for (int i = 0; i < 10000; i++) {
+		real[i] = i;
+		mine[i] = i;
+	}
+
+	annonce("Erase random keys");
+	for (int i = 0; i < 20000; i++) {
+		int k = rand() % 12000;
+		if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+	if (!compact_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erased slots are reused");
+	std::size_t capacity = mine.capacity();
+	for (int i = 0; i < 10000; i++) {
+		real[i] = -i;
+		mine[i] = -i;
+	}
+	if (!compact_same_content(real, mine) || mine.capacity() != capacity) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase with iterator");
+	real.erase(real.begin());
+	mine.erase(mine.begin());
+	real.erase(--real.end());
+	mine.erase(--mine.end());
+	if (!compact_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase with range");
+	real.erase(real.lower_bound(3000), real.lower_bound(9000));
+	mine.erase(mine.lower_bound(3000), mine.lower_bound(9000));
+	if (!compact_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase everything");
+	real.erase(real.begin(), real.end());
+	mine.erase(mine.begin(), mine.end());
+	if (!compact_same_content(real, mine) || !mine.empty() || mine.begin() != mine.end()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	compact_map_test_defragment() {
+	title("\e[95m-Defragment-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>				real;
+	ft::compact_map<int, int>	mine;
+	for (int i = 0; i < 20000; i++) {
+		int k = rand() % 40000;
+		real[k] = i;
+		mine[k] = i;
+	}
+	for (int i = 0; i < 20000; i++) {
+		int k = rand() % 40000;
+		if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+
+	annonce("Same content, capacity shrunk to the size");
+	mine.defragment();
+	if (!compact_same_content(real, mine) || mine.capacity() != mine.size()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Elements in key order in the array");
+	ft::compact_map<int, int>::iterator it = mine.begin();
+	const char *prev = reinterpret_cast<const char *>(&*it);
+	for (++it; it != mine.end(); ++it) {
+		const char *cur = reinterpret_cast<const char *>(&*it);
+		if (static_cast<std::size_t>(cur - prev) != sizeof(ft::compact_node< ft::pair<const int, int> >)) {
+			return Test_failure();
+		}
+		prev = cur;
+	}
+	Test_success();
+
+	annonce("Insert and erase after defragment");
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 40000;
+		if (i % 2) {
+			real[k] = i;
+			mine[k] = i;
+		}
+		else if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+	if (!compact_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Defragment an empty map");
+	ft::compact_map<int, int>	empty;
+	empty[1] = 1;
+	empty.erase(1);
+	empty.defragment();
+	empty[2] = 2;
+	if (empty.size() != 1 || empty.begin()->first != 2 || empty.rbegin()->first != 2) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	compact_map_test_copy_swap() {
+	title("\e[95m-Copy and swap-\e[39m");
+
+	ft::compact_map<std::string, int>	mine;
+	for (int i = 0; i < 1000; i++) {
+		std::ostringstream key;
+		key << "key" << i;
+		mine[key.str()] = i;
+	}
+	mine.erase("key500");
+
+	annonce("Copy constructor and operator=");
+	ft::compact_map<std::string, int>	copy(mine);
+	ft::compact_map<std::string, int>	assigned;
+	assigned["a"] = -1;
+	assigned = mine;
+	if (copy != mine || assigned != mine) {
+		return Test_failure();
+	}
+	copy["key500"] = 42;
+	assigned.erase("key0");
+	if (copy == mine || assigned == mine || copy.size() != 1000 || assigned.size() != 998) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Swap");
+	ft::compact_map<std::string, int>	other;
+	other["other"] = 42;
+	other.swap(mine);
+	if (mine.size() != 1 || mine.begin()->first != "other" || other.size() != 999 || other.begin()->first != "key0") {
+		return Test_failure();
+	}
+	ft::swap(mine, other);
+	if (mine.size() != 999 || other.begin()->second != 42 || copy.begin()->first != mine.begin()->first) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Swap exchanges the allocators");
+	typedef ft::tracking_allocator< ft::pair<const int, int> >	counting;
+	ft::allocation_stats	left_stats;
+	ft::allocation_stats	right_stats;
+	std::less<int> less;
+	{
+		ft::compact_map<int, int, std::less<int>, counting>	left(less, counting(left_stats));
+		ft::compact_map<int, int, std::less<int>, counting>	right(less, counting(right_stats));
+		for (int i = 0; i < 100; i++) {
+			left[i] = i;
+		}
+		right[-1] = -1;
+		left.swap(right);
+		if (&left.get_allocator().stats() != &right_stats || &right.get_allocator().stats() != &left_stats) {
+			return Test_failure();
+		}
+		right.defragment();
+	}
+	if (left_stats.live() != 0 || left_stats.live_bytes != 0 || right_stats.live() != 0 || right_stats.live_bytes != 0) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_compact_map() {
+	title("\e[93m Compact_map: \e[39m");
+	compact_map_test_insert();
+	compact_map_test_find();
+	compact_map_test_erase();
+	compact_map_test_defragment();
+	compact_map_test_copy_swap();
+};
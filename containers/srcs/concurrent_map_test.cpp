@@ -0,0 +1,174 @@
+#include "../class/utils.hpp"
+
+typedef ft::concurrent_map<int, int>	concurrent_int_map;
+
+struct concurrent_add
+{
+	int	value;
+
+	concurrent_add( int v )
+		: value(v) {
+	};
+
+	void operator()( int& mapped ) const {
+		mapped += value;
+	};
+};
+
+struct concurrent_collect
+{
+	std::map<int, int>	*out;
+
+	concurrent_collect( std::map<int, int> *o )
+		: out(o) {
+	};
+
+	void operator()( const ft::pair<const int, int>& value ) const {
+		(*out)[value.first] = value.second;
+	};
+};
+
+void	concurrent_map_test_basic() {
+	title("\e[95m-Single thread-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>	real;
+	concurrent_int_map	mine(8);
+
+	annonce("Insert, find and erase");
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 4000;
+		if (rand() % 3) {
+			bool r = real.insert(std::make_pair(k, i)).second;
+			if (r != mine.insert(ft::make_pair(k, i))) {
+				return Test_failure();
+			}
+		}
+		else if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+	for (int k = 0; k < 4000; k++) {
+		int value = -1;
+		bool found = mine.find(k, value);
+		if (found != (real.count(k) == 1) || (found && value != real[k]) || mine.count(k) != real.count(k)) {
+			return Test_failure();
+		}
+	}
+	if (mine.size() != real.size() || mine.shard_count() != 8) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Upsert");
+	for (int k = 0; k < 4000; k += 3) {
+		bool inserted = mine.upsert(k, 1, concurrent_add(10));
+		if (inserted != (real.count(k) == 0)) {
+			return Test_failure();
+		}
+		if (inserted) {
+			real[k] = 1;
+		}
+		else {
+			real[k] += 10;
+		}
+	}
+	Test_success();
+
+	annonce("For_each");
+	std::map<int, int> seen;
+	mine.for_each(concurrent_collect(&seen));
+	if (seen != real) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Clear");
+	mine.clear();
+	if (!mine.empty() || mine.count(0) != 0) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	concurrent_map_test_range() {
+	title("\e[95m-Range partition-\e[39m");
+
+	int															bounds[] = { 100, 200, 300 };
+	ft::range_partition<int>				partition(bounds, bounds + 3);
+	ft::concurrent_map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+		ft::range_partition<int> >		mine(4, partition);
+
+	annonce("For_each visits the keys in order");
+	for (int k = 399; k >= 0; k -= 7) {
+		mine.insert(ft::make_pair(k, k));
+	}
+	std::map<int, int> seen;
+	mine.for_each(concurrent_collect(&seen));
+	if (seen.size() != mine.size() || seen.begin()->first != 0 || seen.rbegin()->first != 399) {
+		return Test_failure();
+	}
+	if (partition(99, 4) != 0 || partition(100, 4) != 1 || partition(1000, 4) != 3) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+struct concurrent_worker
+{
+	concurrent_int_map	*map;
+	int									id;
+};
+
+// Every thread inserts its own keys and increments the shared counters 0 to 99
+static void	*concurrent_run( void *arg ) {
+	concurrent_worker *w = static_cast<concurrent_worker *>(arg);
+	for (int i = 0; i < 2000; i++) {
+		w->map->insert(ft::make_pair(1000 + w->id * 10000 + i, i));
+		w->map->upsert(i % 100, 1, concurrent_add(1));
+		int value;
+		w->map->find(i % 100, value);
+		if (i % 2) {
+			w->map->erase(1000 + w->id * 10000 + i);
+		}
+	}
+	return NULL;
+};
+
+void	concurrent_map_test_threads() {
+	title("\e[95m-Threads-\e[39m");
+
+	const int						threads = 8;
+	concurrent_int_map	mine(16);
+	concurrent_worker		workers[threads];
+	pthread_t						ids[threads];
+
+	annonce("Insert, upsert and erase from 8 threads");
+	for (int t = 0; t < threads; t++) {
+		workers[t].map = &mine;
+		workers[t].id = t;
+		if (pthread_create(&ids[t], NULL, concurrent_run, &workers[t]) != 0) {
+			return Test_failure();
+		}
+	}
+	for (int t = 0; t < threads; t++) {
+		pthread_join(ids[t], NULL);
+	}
+	if (mine.size() != static_cast<std::size_t>(100 + threads * 1000)) {
+		return Test_failure();
+	}
+	for (int k = 0; k < 100; k++) {
+		int value = 0;
+		if (!mine.find(k, value) || value != threads * 20) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+};
+
+void	launch_concurrent_map() {
+	title("\e[93m Concurrent_map: \e[39m");
+	concurrent_map_test_basic();
+	concurrent_map_test_range();
+	concurrent_map_test_threads();
+};
@@ -0,0 +1,280 @@
+#include "../class/utils.hpp"
+
+typedef ft::tracking_allocator<int>		int_tracker;
+
+static std::size_t	g_allocation_limit;
+
+// Throws bad_alloc for the blocks of more than g_allocation_limit elements
+struct limited_allocator : public std::allocator<int>
+{
+	int	*allocate( std::size_t n, const void *hint = 0 ) {
+		if (n > g_allocation_limit) {
+			throw std::bad_alloc();
+		}
+		return std::allocator<int>::allocate(n, hint);
+	};
+};
+
+// Check that an incremental_vector holds the same elements as a std::vector, through every accessor
+template< class Real, class Mine >
+bool	incremental_same_content( const Real& real, const Mine& mine ) {
+	if (real.size() != mine.size() || real.empty() != mine.empty()) {
+		std::cout << "Real vector: " << real.size() << std::endl;
+		std::cout << "Mine vector: " << mine.size() << std::endl;
+		return false;
+	}
+	if (mine.end() - mine.begin() != static_cast<std::ptrdiff_t>(mine.size())) {
+		return false;
+	}
+	typename Mine::const_iterator mit = mine.begin();
+	for (std::size_t i = 0; i < real.size(); i++, ++mit) {
+		if (real[i] != mine[i] || real[i] != *mit || real[i] != mine.at(i)) {
+			std::cout << "Index " << i << ": " << real[i] << " != " << mine[i] << std::endl;
+			return false;
+		}
+	}
+	typename Real::const_reverse_iterator rrit = real.rbegin();
+	typename Mine::const_reverse_iterator mrit = mine.rbegin();
+	for (; rrit != real.rend(); ++rrit, ++mrit) {
+		if (*rrit != *mrit) {
+			return false;
+		}
+	}
+	return mrit == mine.rend();
+};
+
+void	incremental_vector_test_push_back() {
+	title("\e[95m-Push_back-\e[39m");
+
+	std::vector<int>						real;
+	ft::incremental_vector<int>	mine;
+
+	annonce("Push_back across several growths");
+	bool migrated = false;
+	for (int i = 0; i < 5000; i++) {
+		real.push_back(i * 3);
+		mine.push_back(i * 3);
+		migrated = migrated || mine.migrating();
+		if (mine[i] != i * 3 || mine.back() != i * 3) {
+			return Test_failure();
+		}
+	}
+	if (!migrated || !incremental_same_content(real, mine) || mine.front() != 0) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("The migration ends before the next growth");
+	ft::incremental_vector<int>	grown;
+	for (int i = 0; i < 3000; i++) {
+		if (grown.size() == grown.capacity() && grown.migrating()) {
+			return Test_failure();
+		}
+		grown.push_back(i);
+	}
+	Test_success();
+
+	annonce("Elements are readable in the middle of a migration");
+	ft::incremental_vector<std::string>	words;
+	std::vector<std::string>					real_words;
+	for (int i = 0; i < 1025; i++) {
+		std::ostringstream ss;
+		ss << "word " << i;
+		words.push_back(ss.str());
+		real_words.push_back(ss.str());
+	}
+	if (!words.migrating() || !incremental_same_content(real_words, words)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Write through iterators and operator[]");
+	for (ft::incremental_vector<int>::iterator it = mine.begin(); it != mine.end(); ++it) {
+		*it += 1;
+	}
+	for (std::size_t i = 0; i < real.size(); i++) {
+		real[i] += 1;
+	}
+	mine[10] = -1;
+	real[10] = -1;
+	if (!incremental_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("At out of range");
+	try {
+		mine.at(mine.size());
+		return Test_failure();
+	}
+	catch (std::out_of_range&) {
+	}
+	Test_success();
+};
+
+void	incremental_vector_test_pop_back() {
+	title("\e[95m-Pop_back-\e[39m");
+
+	std::vector<int>						real;
+	ft::incremental_vector<int>	mine;
+
+	annonce("Pop_back during a migration");
+	for (int i = 0; i < 1030; i++) {
+		real.push_back(i);
+		mine.push_back(i);
+	}
+	for (int i = 0; i < 1025; i++) {
+		real.pop_back();
+		mine.pop_back();
+		if (!incremental_same_content(real, mine)) {
+			return Test_failure();
+		}
+	}
+	if (mine.migrating()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Push and pop in turns");
+	srand(time(NULL));
+	for (int i = 0; i < 20000; i++) {
+		if (rand() % 3 == 0 && !real.empty()) {
+			real.pop_back();
+			mine.pop_back();
+		}
+		else {
+			real.push_back(i);
+			mine.push_back(i);
+		}
+	}
+	if (!incremental_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Resize and clear");
+	real.resize(3000, 7);
+	mine.resize(3000, 7);
+	if (!incremental_same_content(real, mine)) {
+		return Test_failure();
+	}
+	real.resize(10);
+	mine.resize(10);
+	if (!incremental_same_content(real, mine)) {
+		return Test_failure();
+	}
+	mine.clear();
+	if (!mine.empty() || mine.migrating() || mine.begin() != mine.end()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	incremental_vector_test_copy() {
+	title("\e[95m-Copy-\e[39m");
+
+	std::vector<int>						real;
+	ft::incremental_vector<int>	mine;
+	for (int i = 0; i < 2050; i++) {
+		real.push_back(i);
+		mine.push_back(i);
+	}
+
+	annonce("Copy of a migrating vector");
+	ft::incremental_vector<int>	copy(mine);
+	if (!mine.migrating() || copy.migrating() || !incremental_same_content(real, copy) || copy != mine) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Assignment, comparisons and swap");
+	ft::incremental_vector<int>	other(5, 1);
+	ft::incremental_vector<int>	range(real.begin(), real.begin() + 100);
+	other = mine;
+	if (other != mine || !(range < mine) || !(mine > range) || !(range <= range) || !(mine >= other)) {
+		return Test_failure();
+	}
+	other.push_back(-1);
+	ft::swap(other, range);
+	if (range.size() != 2051 || other.size() != 100 || range.back() != -1 || other.back() != 99) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Reserve ends the migration");
+	mine.reserve(10000);
+	if (mine.migrating() || mine.capacity() != 10000 || !incremental_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	incremental_vector_test_allocations() {
+	title("\e[95m-Allocations-\e[39m");
+
+	ft::allocation_stats stats;
+	{
+		ft::incremental_vector<int, int_tracker>	mine((int_tracker(stats)));
+
+		annonce("One allocation per growth, two blocks at most");
+		for (int i = 0; i < 4096; i++) {
+			mine.push_back(i);
+		}
+		// Capacities 1, 2, 4 ... 4096
+		if (stats.allocations != 13 || stats.live() > 2 || stats.peak_bytes > (4096 + 2048) * sizeof(int)) {
+			std::cout << "Mine allocations: " << stats.allocations << std::endl;
+			return Test_failure();
+		}
+		Test_success();
+
+		annonce("Copy during a migration");
+		mine.push_back(4096);
+		ft::incremental_vector<int, int_tracker>	copy(mine);
+		copy.pop_back();
+		copy = mine;
+		if (copy != mine || stats.live() > 4) {
+			return Test_failure();
+		}
+		Test_success();
+	}
+
+	annonce("Nothing leaks");
+	if (stats.live_bytes != 0 || stats.live() != 0) {
+		std::cout << "Mine live bytes: " << stats.live_bytes << std::endl;
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("A failed growth leaves the vector as it was");
+	std::vector<int>														real;
+	ft::incremental_vector<int, limited_allocator>	limited;
+	g_allocation_limit = 1024;
+	for (int i = 0; i < 1024; i++) {
+		real.push_back(i);
+		limited.push_back(i);
+	}
+	try {
+		limited.push_back(1024);
+		return Test_failure();
+	}
+	catch (std::bad_alloc&) {
+	}
+	if (limited.capacity() != 1024 || !incremental_same_content(real, limited)) {
+		return Test_failure();
+	}
+	g_allocation_limit = 2048;
+	real.push_back(1024);
+	limited.push_back(1024);
+	if (!incremental_same_content(real, limited)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_incremental_vector() {
+	title("\e[93m Incremental_vector: \e[39m");
+	incremental_vector_test_push_back();
+	incremental_vector_test_pop_back();
+	incremental_vector_test_copy();
+	incremental_vector_test_allocations();
+};
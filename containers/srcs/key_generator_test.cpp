@@ -0,0 +1,194 @@
+#include "../class/utils.hpp"
+
+#define KEYS_N 20000
+#define KEYS_RANGE 80000
+
+static bool	keys_in_range( const std::vector<int>& keys ) {
+	for (std::size_t i = 0; i < keys.size(); i++) {
+		if (keys[i] < 0 || keys[i] >= KEYS_RANGE) {
+			std::cout << "Key " << i << ": " << keys[i] << std::endl;
+			return false;
+		}
+	}
+	return keys.size() == KEYS_N;
+}
+
+// Pairs of neighbours out of order
+static std::size_t	keys_descents( const std::vector<int>& keys ) {
+	std::size_t descents = 0;
+	for (std::size_t i = 1; i < keys.size(); i++) {
+		descents += keys[i - 1] > keys[i];
+	}
+	return descents;
+}
+
+void	key_generator_test_integers() {
+	title("\e[95m-Integers-\e[39m");
+
+	annonce("Every distribution stays in its range");
+	for (int d = 0; d < ft::key_distribution_count; d++) {
+		ft::key_generator gen(d);
+		if (!keys_in_range(gen.integers<int>(static_cast<ft::key_distribution>(d), KEYS_N, KEYS_RANGE))) {
+			return Test_failure();
+		}
+	}
+	if (!ft::key_generator().integers<int>(ft::key_zipf, 0, 10).empty()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("The same seed draws the same keys");
+	ft::key_generator a(7);
+	ft::key_generator b(7);
+	ft::key_generator c(8);
+	std::vector<int> first = a.integers<int>(ft::key_uniform, KEYS_N, KEYS_RANGE);
+	if (first != b.integers<int>(ft::key_uniform, KEYS_N, KEYS_RANGE) || first == c.integers<int>(ft::key_uniform, KEYS_N, KEYS_RANGE)) {
+		return Test_failure();
+	}
+	a.seed(7);
+	if (a.integers<int>(ft::key_uniform, KEYS_N, KEYS_RANGE) != first) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Sorted, reverse and nearly sorted");
+	ft::key_generator gen;
+	std::vector<int> sorted = gen.integers<int>(ft::key_sorted, KEYS_N, KEYS_RANGE);
+	std::vector<int> reverse = gen.integers<int>(ft::key_reverse_sorted, KEYS_N, KEYS_RANGE);
+	std::vector<int> nearly = gen.integers<int>(ft::key_nearly_sorted, KEYS_N, KEYS_RANGE);
+	std::set<int> distinct(sorted.begin(), sorted.end());
+	if (keys_descents(sorted) != 0 || distinct.size() != KEYS_N || !std::equal(sorted.begin(), sorted.end(), reverse.rbegin())) {
+		return Test_failure();
+	}
+	std::size_t descents = keys_descents(nearly);
+	std::vector<int> resorted(nearly);
+	std::sort(resorted.begin(), resorted.end());
+	if (descents == 0 || descents > KEYS_N / 10 || resorted != sorted) {
+		std::cout << "Descents: " << descents << std::endl;
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Zipf draws a few keys most of the time");
+	std::map<int, int> counts;
+	std::vector<int> zipf = gen.integers<int>(ft::key_zipf, KEYS_N, KEYS_RANGE);
+	for (std::size_t i = 0; i < zipf.size(); i++) {
+		counts[zipf[i]]++;
+	}
+	std::vector<int> frequencies;
+	int hottest = 0;
+	int best = 0;
+	for (std::map<int, int>::iterator it = counts.begin(); it != counts.end(); ++it) {
+		frequencies.push_back(it->second);
+		if (it->second > best) {
+			best = it->second;
+			hottest = it->first;
+		}
+	}
+	std::sort(frequencies.rbegin(), frequencies.rend());
+	int top = 0;
+	for (std::size_t i = 0; i < 10 && i < frequencies.size(); i++) {
+		top += frequencies[i];
+	}
+	// Uniform keys would hardly repeat at all, and the hot keys are not the smallest
+	if (top < KEYS_N / 5 || counts.size() > KEYS_N / 2 || hottest < 100) {
+		std::cout << "Top 10: " << top << ", distinct: " << counts.size() << std::endl;
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Ranges of 2^32 keys and more");
+	unsigned long long big = 1ULL << 40;
+	std::vector<unsigned long long> wide = gen.integers<unsigned long long>(ft::key_zipf, 1000, 1ULL << 32);
+	std::vector<unsigned long long> spread = gen.integers<unsigned long long>(ft::key_sorted, 7, big);
+	for (std::size_t i = 0; i < wide.size(); i++) {
+		if (wide[i] >= (1ULL << 32)) {
+			return Test_failure();
+		}
+	}
+	// i * 2^40 / 7, exactly
+	if (spread[1] != 157073089682ULL || spread[6] != 942438538093ULL) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Clustered keys come in runs");
+	gen.set_cluster_size(32);
+	std::vector<int> clustered = gen.integers<int>(ft::key_clustered, KEYS_N, KEYS_RANGE);
+	std::set<int> present(clustered.begin(), clustered.end());
+	std::size_t followed = 0;
+	for (std::set<int>::iterator it = present.begin(); it != present.end(); ++it) {
+		followed += present.count(*it + 1);
+	}
+	if (followed < present.size() * 8 / 10 || keys_descents(clustered) < KEYS_N / 4) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	key_generator_test_strings() {
+	title("\e[95m-Strings-\e[39m");
+
+	annonce("Lengths and characters");
+	ft::key_generator gen(3);
+	std::vector<std::string> keys = gen.strings(1000, 4, 16);
+	std::set<std::size_t> lengths;
+	for (std::size_t i = 0; i < keys.size(); i++) {
+		lengths.insert(keys[i].size());
+		for (std::size_t c = 0; c < keys[i].size(); c++) {
+			if (!isalnum(keys[i][c])) {
+				return Test_failure();
+			}
+		}
+	}
+	if (keys.size() != 1000 || lengths.size() != 13 || *lengths.begin() != 4 || *lengths.rbegin() != 16) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Fixed length, same seed");
+	ft::key_generator again(3);
+	std::vector<std::string> fixed = gen.strings(100, 32, 32);
+	if (again.strings(1000, 4, 16) != keys || fixed[0].size() != 32 || fixed[99].size() != 32) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	key_generator_test_map() {
+	title("\e[95m-Map on every distribution-\e[39m");
+
+	for (int d = 0; d < ft::key_distribution_count; d++) {
+		ft::key_distribution distribution = static_cast<ft::key_distribution>(d);
+		annonce(std::string("Insert, find and erase ") + ft::key_generator::name(distribution) + " keys");
+		ft::key_generator gen(d);
+		std::vector<int> keys = gen.integers<int>(distribution, KEYS_N, KEYS_RANGE);
+		std::map<int, int>	real;
+		PRE::map<int, int>	mine;
+		for (std::size_t i = 0; i < keys.size(); i++) {
+			real.insert(std::make_pair(keys[i], static_cast<int>(i)));
+			mine.insert(PRE::make_pair(keys[i], static_cast<int>(i)));
+		}
+		for (std::size_t i = 0; i < keys.size(); i += 2) {
+			real.erase(keys[i]);
+			mine.erase(keys[i]);
+		}
+		if (real.size() != mine.size()) {
+			return Test_failure();
+		}
+		PRE::map<int, int>::iterator mit = mine.begin();
+		for (std::map<int, int>::iterator rit = real.begin(); rit != real.end(); ++rit, ++mit) {
+			if (rit->first != mit->first || rit->second != mit->second || mine.find(rit->first) != mit) {
+				return Test_failure();
+			}
+		}
+		Test_success();
+	}
+};
+
+void	launch_key_generator() {
+	title("\e[93m Key_generator: \e[39m");
+	key_generator_test_integers();
+	key_generator_test_strings();
+	key_generator_test_map();
+};
@@ -0,0 +1,161 @@
+#include "../class/utils.hpp"
+
+#include <algorithm>
+#include <list>
+
+// Clock driven by the tests
+struct lru_test_clock
+{
+	static long long	time;
+
+	static long long now() {
+		return time;
+	};
+};
+
+long long	lru_test_clock::time = 0;
+
+typedef ft::lru_cache<int, int, std::less<int>, std::allocator<ft::pair<const int, ft::lru_entry<int, int> > >, lru_test_clock>	timed_cache;
+
+void	lru_cache_test_recency() {
+	title("\e[95m-Recency and eviction-\e[39m");
+	srand(time(NULL));
+
+	annonce("Same evictions as a reference LRU list");
+	ft::lru_cache<int, int>	cache(100);
+	std::list<int>					order;
+	std::map<int, int>			values;
+	for (int i = 0; i < 20000; i++) {
+		int k = rand() % 300;
+		std::list<int>::iterator pos = std::find(order.begin(), order.end(), k);
+		if (i % 3) {
+			int *v = cache.get(k);
+			if ((v != NULL) != (pos != order.end()) || (v && *v != values[k])) {
+				return Test_failure();
+			}
+			if (v) {
+				order.splice(order.begin(), order, pos);
+			}
+			continue;
+		}
+		cache.put(k, i);
+		values[k] = i;
+		if (pos != order.end()) {
+			order.erase(pos);
+		}
+		order.push_front(k);
+		if (order.size() > 100) {
+			values.erase(order.back());
+			order.pop_back();
+		}
+		if (cache.size() != order.size() || *cache.oldest() != order.back()) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Counters");
+	ft::lru_cache<int, int>	small(2);
+	small.put(1, 1);
+	small.put(2, 2);
+	small.get(1);
+	small.put(3, 3);
+	small.get(2);
+	small.get(3);
+	if (small.stats().hits != 2 || small.stats().misses != 1 || small.stats().evictions != 1 || small.stats().expirations != 0) {
+		return Test_failure();
+	}
+	small.reset_stats();
+	if (small.stats().hits != 0 || small.peek(1) == NULL || small.stats().hits != 0) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Update, erase and clear");
+	small.put(1, 10);
+	if (*small.get(1) != 10 || small.size() != 2 || *small.oldest() != 3) {
+		return Test_failure();
+	}
+	if (!small.erase(3) || small.erase(3) || small.size() != 1 || *small.oldest() != 1) {
+		return Test_failure();
+	}
+	small.clear();
+	if (!small.empty() || small.oldest() != NULL || small.get(1) != NULL) {
+		return Test_failure();
+	}
+	small.put(4, 4);
+	small.put(5, 5);
+	small.put(6, 6);
+	if (small.size() != 2 || small.contains(4) || !small.contains(6)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Zero capacity");
+	try {
+		ft::lru_cache<int, int> none(0);
+		return Test_failure();
+	}
+	catch (const std::invalid_argument&) {
+	}
+	Test_success();
+};
+
+void	lru_cache_test_ttl() {
+	title("\e[95m-Time to live-\e[39m");
+
+	timed_cache	cache(1000, 100);
+	lru_test_clock::time = 0;
+	for (int i = 0; i < 50; i++) {
+		lru_test_clock::time = i;
+		cache.put(i, i);
+	}
+
+	annonce("Expired elements are misses");
+	lru_test_clock::time = 120;
+	if (cache.get(10) != NULL || cache.get(30) == NULL || cache.peek(5) != NULL || cache.peek(40) == NULL) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Expire removes the expired prefix");
+	if (cache.expire() != 20 || cache.size() != 29 || cache.stats().expirations != 21) {
+		return Test_failure();
+	}
+	if (cache.expire() != 0 || cache.contains(20) || !cache.contains(21)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Put restarts the time to live");
+	cache.put(25, -25);
+	lru_test_clock::time = 160;
+	if (!cache.contains(25) || cache.contains(30) || cache.size() != 29) {
+		return Test_failure();
+	}
+	cache.put(1000, 1000);
+	if (cache.size() != 2 || *cache.get(25) != -25 || *cache.get(1000) != 1000) {
+		return Test_failure();
+	}
+	lru_test_clock::time = 400;
+	if (cache.expire() != 2 || !cache.empty()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Get does not extend the time to live");
+	cache.put(1, 1);
+	lru_test_clock::time = 450;
+	cache.get(1);
+	lru_test_clock::time = 500;
+	if (cache.get(1) != NULL || !cache.empty()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_lru_cache() {
+	title("\e[93m Lru_cache: \e[39m");
+	lru_cache_test_recency();
+	lru_cache_test_ttl();
+};
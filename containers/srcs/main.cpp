@@ -26,6 +26,97 @@ int main() {
 	end = clock() - deb;
 	std::cout << "map timer: "<< end << std::endl;
 
+	title("\e[96m*** SET ***\e[39m");
+	deb = clock();
+	launch_set();
+	launch_multiset();
+	end = clock() - deb;
+	std::cout << "set timer: "<< end << std::endl;
+
+	title("\e[96m*** MULTIMAP ***\e[39m");
+	deb = clock();
+	launch_multimap();
+	end = clock() - deb;
+	std::cout << "multimap timer: "<< end << std::endl;
+
+	title("\e[96m*** BTREE_MAP ***\e[39m");
+	deb = clock();
+	launch_btree_map();
+	end = clock() - deb;
+	std::cout << "btree_map timer: "<< end << std::endl;
+
+	title("\e[96m*** PERSISTENT_MAP ***\e[39m");
+	deb = clock();
+	launch_persistent_map();
+	end = clock() - deb;
+	std::cout << "persistent_map timer: "<< end << std::endl;
+
+	title("\e[96m*** CONCURRENT_MAP ***\e[39m");
+	deb = clock();
+	launch_concurrent_map();
+	end = clock() - deb;
+	std::cout << "concurrent_map timer: "<< end << std::endl;
+
+	title("\e[96m*** UNORDERED_MAP ***\e[39m");
+	deb = clock();
+	launch_unordered_map();
+	end = clock() - deb;
+	std::cout << "unordered_map timer: "<< end << std::endl;
+
+	title("\e[96m*** RADIX_MAP ***\e[39m");
+	deb = clock();
+	launch_radix_map();
+	end = clock() - deb;
+	std::cout << "radix_map timer: "<< end << std::endl;
+
+	title("\e[96m*** COMPACT_MAP ***\e[39m");
+	deb = clock();
+	launch_compact_map();
+	end = clock() - deb;
+	std::cout << "compact_map timer: "<< end << std::endl;
+
+	title("\e[96m*** LRU_CACHE ***\e[39m");
+	deb = clock();
+	launch_lru_cache();
+	end = clock() - deb;
+	std::cout << "lru_cache timer: "<< end << std::endl;
+
+	title("\e[96m*** SMALL_MAP ***\e[39m");
+	deb = clock();
+	launch_small_map();
+	end = clock() - deb;
+	std::cout << "small_map timer: "<< end << std::endl;
+
+	title("\e[96m*** INCREMENTAL_VECTOR ***\e[39m");
+	deb = clock();
+	launch_incremental_vector();
+	end = clock() - deb;
+	std::cout << "incremental_vector timer: "<< end << std::endl;
+
+	title("\e[96m*** TRACKING_ALLOCATOR ***\e[39m");
+	deb = clock();
+	launch_tracking_allocator();
+	end = clock() - deb;
+	std::cout << "tracking_allocator timer: "<< end << std::endl;
+
+	title("\e[96m*** TRACE ***\e[39m");
+	deb = clock();
+	launch_trace();
+	end = clock() - deb;
+	std::cout << "trace timer: "<< end << std::endl;
+
+	title("\e[96m*** KEY_GENERATOR ***\e[39m");
+	deb = clock();
+	launch_key_generator();
+	end = clock() - deb;
+	std::cout << "key_generator timer: "<< end << std::endl;
+
+	title("\e[96m*** PERFORMANCE ***\e[39m");
+	deb = clock();
+	launch_performance();
+	end = clock() - deb;
+	std::cout << "performance timer: "<< end << std::endl;
+
 
 	 return (0);
 }
@@ -1,77 +1,133 @@
 #include "../class/utils.hpp"
 
+// Steps of the map tests, timed by perf_step
+struct map_step_fill
+{
+	template< class Map >
+	void	operator()( Map& m ) const {
+		m['a'] = 44;
+		m['b'] = -34;
+		m['c'] = 112;
+	};
+};
+
+struct map_step_insert_pairs
+{
+	template< class Map >
+	void	operator()( Map& m ) const {
+		static const int	keys[] = { 100, 50, 4, 2, 999, 7, 12, -56, 1 };
+		for (std::size_t i = 0; i < sizeof(keys) / sizeof(*keys); i++) {
+			m.insert(typename Map::value_type(keys[i], 42));
+		}
+	};
+};
+
+template< class Map >
+struct map_step_insert_range
+{
+	const Map	*src;
+
+	explicit map_step_insert_range( const Map& m )
+		: src(&m) {
+	};
+
+	void	operator()( Map& m ) const {
+		m.insert(src->begin(), src->end());
+	};
+};
+
+struct map_step_insert_hint
+{
+	template< class Map >
+	void	operator()( Map& m ) const {
+		m.insert(m.begin(), typename Map::value_type(100, 42));
+	};
+};
+
+struct map_step_erase_iterators
+{
+	template< class Map >
+	void	operator()( Map& m ) const {
+		typename Map::iterator it = m.begin();
+		it++;
+		it++;
+		m.erase(m.begin());
+		m.erase(it);
+	};
+};
+
+struct map_step_erase_range
+{
+	template< class Map >
+	void	operator()( Map& m ) const {
+		m.erase(m.begin(), m.end());
+	};
+};
+
+struct map_step_erase_keys
+{
+	template< class Map >
+	void	operator()( Map& m ) const {
+		m.erase("lol");
+		m.erase("suis");
+	};
+};
+
 void	map_test_constructors() {
 	title("\e[95m-Constructors-\e[39m");
 
 	annonce("Default constructor");
 
-	long time = get_time();
 	std::map<char, int> real;
 	real['a'] = 44;
 	real['b'] = -34;
 	real['c'] = 112;
-	long real_time = get_time() - time;
 
-	time = get_time();
 	PRE::map<char, int>		mine;
 	mine['a'] = 44;
 	mine['b'] = -34;
 	mine['c'] = 112;
-	long mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(perf_step(std::map<char, int>(), map_step_fill()), perf_step(PRE::map<char, int>(), map_step_fill()));
 
 	annonce("Range constructor");
 
-	time = get_time();
 	std::map<char, int>		real2(real.begin(), real.end());
-	real_time = get_time() - time;
-
-	time = get_time();
 	PRE::map<char, int>	mine2(mine.begin(), mine.end());
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), mine2.begin()) || mine2.size() != real2.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(perf_step(real, step_range_construct()), perf_step(mine, step_range_construct()));
 
 	annonce("Copy constructor");
 
-	time = get_time();
 	std::map<char, int>		real3(real2);
-	real_time = get_time() - time;
-
-	time = get_time();
 	PRE::map<char, int> mine3(mine);
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), mine3.begin()) || mine3.size() != real3.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(perf_step(real, step_copy()), perf_step(mine, step_copy()));
 
 	annonce("Operator =");
 
-	time = get_time();
-	std::map<char, int>		real4 = real3;
-	real_time = get_time() - time;
-
-	time = get_time();
-	PRE::map<char, int> mine4 = mine;
-	mine_time = get_time() - time;
+	std::map<char, int>		real4;
+	real4 = real3;
+	PRE::map<char, int> mine4;
+	mine4 = mine;
 	if (!ft::equal(mine.begin(), mine.end(), mine4.begin()) || mine4.size() != real4.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(perf_step(real, step_assign()), perf_step(mine, step_assign()));
 };
 
 void	map_test_at() {
@@ -239,38 +295,32 @@ void	map_test_clear() {
 
 	annonce("Clear with 0");
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, step_clear());
+	ft::perf_stats mine_perf = perf_step(mine, step_clear());
 	real.clear();
-	long real_time = get_time() - time;
-
-	time = get_time();
 	mine.clear();
-	long mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Clear with 1");
 
 	real.insert(std::pair<int, int>(1, 1));
 	mine.insert(PRE::pair<int, int>(1, 1));
 
-	time = get_time();
+	real_perf = perf_step(real, step_clear());
+	mine_perf = perf_step(mine, step_clear());
 	real.clear();
-	real_time = get_time() - time;
-
-	time = get_time();
 	mine.clear();
-	mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Clear with 1000");
 	for (int i = 0; i < 1000; i++) {
@@ -278,19 +328,16 @@ void	map_test_clear() {
 		mine.insert(PRE::pair<int, int>(i, i));
 	}
 
-	time = get_time();
+	real_perf = perf_step(real, step_clear());
+	mine_perf = perf_step(mine, step_clear());
 	real.clear();
-	real_time = get_time() - time;
-
-	time = get_time();
 	mine.clear();
-	mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 };
 
 void	map_test_insert() {
@@ -310,7 +357,8 @@ void	map_test_insert() {
 	std::pair<int, int> radd8(-56, 42);
 	std::pair<int, int> radd9(1, 42);
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(std::map<int, int>(), map_step_insert_pairs());
+	ft::perf_stats mine_perf = perf_step(PRE::map<int, int>(), map_step_insert_pairs());
 	real.insert(radd);
 	real.insert(radd2);
 	real.insert(radd3);
@@ -320,7 +368,6 @@ void	map_test_insert() {
 	real.insert(radd7);
 	real.insert(radd8);
 	real.insert(radd9);
-	long real_time = get_time() - time;
 
 	PRE::map<int, int> mine;
 
@@ -334,7 +381,6 @@ void	map_test_insert() {
 	PRE::pair<int, int> madd8(-56, 42);
 	PRE::pair<int, int> madd9(1, 42);
 
-	time = get_time();
 	mine.insert(madd);
 	mine.insert(madd2);
 	mine.insert(madd3);
@@ -344,54 +390,49 @@ void	map_test_insert() {
 	mine.insert(madd7);
 	mine.insert(madd8);
 	mine.insert(madd9);
-	long mine_time = get_time() - time;
 
 	if (real.size() != mine.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Insert with range");
 
 	std::map<int, int> real2;
 	PRE::map<int, int> mine2;
 
-	time = get_time();
+	real_perf = perf_step(real2, map_step_insert_range< std::map<int, int> >(real));
+	mine_perf = perf_step(mine2, map_step_insert_range< PRE::map<int, int> >(mine));
 	real2.insert(real.begin(), real.end());
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine2.insert(mine.begin(), mine.end());
-	mine_time = get_time() - time;
 
 	if (real.size() != mine.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Insert with value");
 
 	std::map<int, int> real3;
 	PRE::map<int, int> mine3;
 
-	time = get_time();
-	real2.insert(real.begin(), radd);
-	real_time = get_time() - time;
+	real_perf = perf_step(real2, map_step_insert_hint());
+	mine_perf = perf_step(mine2, map_step_insert_hint());
+	real2.insert(real2.begin(), radd);
 
-	time = get_time();
-	mine2.insert(mine.begin(), madd);
-	mine_time = get_time() - time;
+	mine2.insert(mine2.begin(), madd);
 
 	if (real.size() != mine.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 
 	// PRE::map<int, int>::iterator it_real = real.begin();
@@ -431,25 +472,23 @@ void	map_test_erase() {
 			std::map<std::string, int>::iterator it_real = real.begin();
 			it_real++;
 			it_real++;
-			long time = get_time();
+			ft::perf_stats real_perf = perf_step(real, map_step_erase_iterators());
+			ft::perf_stats mine_perf = perf_step(mine, map_step_erase_iterators());
 			real.erase(real.begin());
 			real.erase(it_real);
-			long real_time = get_time() - time;
 
 			PRE::map<std::string, int>::iterator it = mine.begin();
 			it++;
 			it++;
-			time = get_time();
 			mine.erase(mine.begin());
 			mine.erase(it);
-			long mine_time = get_time() - time;
 
 			if (real.size() != mine.size()) {
 				std::cout << "Real map: " << real.size() << std::endl;
 				std::cout << "Mine map: " << mine.size() << std::endl;
 				return Test_failure();
 			}
-			Test_performance(real_time, mine_time);
+			Test_performance(real_perf, mine_perf);
 	}
 
 	annonce("Erase with range"); {
@@ -471,20 +510,18 @@ void	map_test_erase() {
 		mine["lol"] = 47;
 		mine["."] = 48;
 
-		long time = get_time();
+		ft::perf_stats real_perf = perf_step(real, map_step_erase_range());
+		ft::perf_stats mine_perf = perf_step(mine, map_step_erase_range());
 		real.erase(real.begin(), real.end());
-		long real_time = get_time() - time;
 
-		time = get_time();
 		mine.erase(mine.begin(), mine.end());
-		long mine_time = get_time() - time;
 
 		if (real.size() != mine.size()) {
 			std::cout << "Real map: " << real.size() << std::endl;
 			std::cout << "Mine map: " << mine.size() << std::endl;
 			return Test_failure();
 		}
-		Test_performance(real_time, mine_time);
+		Test_performance(real_perf, mine_perf);
 	}
 
 	annonce("Erase with key"); {
@@ -506,22 +543,20 @@ void	map_test_erase() {
 		mine["lol"] = 47;
 		mine["."] = 48;
 
-		long time = get_time();
+		ft::perf_stats real_perf = perf_step(real, map_step_erase_keys());
+		ft::perf_stats mine_perf = perf_step(mine, map_step_erase_keys());
 		real.erase("lol");
 		real.erase("suis");
-		long real_time = get_time() - time;
 
-		time = get_time();
 		mine.erase("lol");
 		mine.erase("suis");
-		long mine_time = get_time() - time;
 
 		if (real.size() != mine.size()) {
 			std::cout << "Real map: " << real.size() << std::endl;
 			std::cout << "Mine map: " << mine.size() << std::endl;
 			return Test_failure();
 		}
-		Test_performance(real_time, mine_time);
+		Test_performance(real_perf, mine_perf);
 	}
 };
 
@@ -536,19 +571,17 @@ void	map_test_swap() {
 	real.insert(std::pair<int, int>(1, 1));
 	mine.insert(PRE::pair<int, int>(1, 1));
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, step_swap_self());
+	ft::perf_stats mine_perf = perf_step(mine, step_swap_self());
 	real.swap(real);
-	long real_time = get_time() - time;
 
-	time = get_time();
 	mine.swap(mine);
-	long mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Swap 1000 elements");
 	for (int i = 0; i < 1000; i++) {
@@ -556,19 +589,17 @@ void	map_test_swap() {
 		mine.insert(PRE::pair<int, int>(i, i));
 	}
 
-	time = get_time();
+	real_perf = perf_step(real, step_swap_self());
+	mine_perf = perf_step(mine, step_swap_self());
 	real.swap(real);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.swap(mine);
-	mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real map: " << real.size() << std::endl;
 		std::cout << "Mine map: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 };
 
 void map_test_count() {
@@ -606,6 +637,619 @@ void map_test_count() {
 	Test_success();
 };
 
+void map_test_order_statistics() {
+	title("\e[95m-Order statistics-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>	real;
+	ft::map<int, int>		mine;
+	for (int i = 0; i < 2000; i++) {
+		int k = rand() % 4000;
+		real[k] = i;
+		mine[k] = i;
+	}
+	for (int i = 0; i < 1000; i++) {
+		int k = rand() % 4000;
+		real.erase(k);
+		mine.erase(k);
+	}
+
+	annonce("Nth");
+	std::map<int, int>::iterator rit = real.begin();
+	for (std::size_t k = 0; k < real.size(); k++, rit++) {
+		if (mine.nth(k)->first != rit->first) {
+			std::cout << "Real map: " << rit->first << std::endl;
+			std::cout << "Mine map: " << mine.nth(k)->first << std::endl;
+			return Test_failure();
+		}
+	}
+	if (mine.nth(real.size()) != mine.end()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Rank and count_range");
+	for (int k = -1; k < 4001; k += 7) {
+		std::size_t rank = std::distance(real.begin(), real.lower_bound(k));
+		std::size_t range = std::distance(real.lower_bound(k), real.lower_bound(k + 500));
+		if (mine.rank(k) != rank || mine.count_range(k, k + 500) != range) {
+			std::cout << "Real map: " << rank << " " << range << std::endl;
+			std::cout << "Mine map: " << mine.rank(k) << " " << mine.count_range(k, k + 500) << std::endl;
+			return Test_failure();
+		}
+	}
+	if (mine.count_range(10, 5) != 0) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Iterator advance and distance");
+	ft::map<int, int>::iterator it = mine.begin();
+	it += real.size() / 2;
+	rit = real.begin();
+	std::advance(rit, real.size() / 2);
+	if (it->first != rit->first || it - mine.begin() != static_cast<std::ptrdiff_t>(real.size() / 2)) {
+		return Test_failure();
+	}
+	it -= 3;
+	std::advance(rit, -3);
+	if (it->first != rit->first || (it + 3) - it != 3 || mine.end() - mine.begin() != static_cast<std::ptrdiff_t>(real.size())) {
+		return Test_failure();
+	}
+	it += real.size();
+	if (it != mine.end()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+// Check that an ft::map holds the same keys as a std::map, in order, and that its links are sound
+bool map_same_keys( const std::map<int, int>& real, ft::map<int, int>& mine ) {
+	if (real.size() != mine.size() || mine.end() - mine.begin() != static_cast<std::ptrdiff_t>(real.size())) {
+		std::cout << "Real map: " << real.size() << std::endl;
+		std::cout << "Mine map: " << mine.size() << std::endl;
+		return false;
+	}
+	std::map<int, int>::const_iterator rit = real.begin();
+	for (ft::map<int, int>::iterator it = mine.begin(); it != mine.end(); ++it, ++rit) {
+		if (it->first != rit->first) {
+			return false;
+		}
+	}
+	std::map<int, int>::const_reverse_iterator rrit = real.rbegin();
+	for (ft::map<int, int>::reverse_iterator it = mine.rbegin(); it != mine.rend(); ++it, ++rrit) {
+		if (it->first != rrit->first) {
+			return false;
+		}
+	}
+	return true;
+};
+
+void map_fill( const std::map<int, int>& real, ft::map<int, int>& mine ) {
+	for (std::map<int, int>::const_iterator it = real.begin(); it != real.end(); ++it) {
+		mine.insert(ft::make_pair(it->first, it->second));
+	}
+};
+
+void map_test_split_join() {
+	title("\e[95m-Split and join-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>	real;
+	ft::map<int, int>		mine;
+	for (int i = 0; i < 3000; i++) {
+		int k = rand() % 10000;
+		real[k] = i;
+		mine[k] = i;
+	}
+
+# ifdef FT_MAP_ORDER_STATISTICS
+	annonce("Split");
+	for (int t = 0; t < 20; t++) {
+		int key = rand() % 10000;
+		ft::map<int, int> greater;
+		greater[-1] = -1;
+		mine.split(key, greater);
+		std::map<int, int> real_less(real.begin(), real.lower_bound(key));
+		std::map<int, int> real_greater(real.lower_bound(key), real.end());
+		if (!map_same_keys(real_less, mine) || !map_same_keys(real_greater, greater)) {
+			return Test_failure();
+		}
+		mine.join(greater);
+		if (!map_same_keys(real, mine) || !greater.empty()) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+# endif
+
+	annonce("Join in both orders");
+	ft::map<int, int> low;
+	ft::map<int, int> high;
+	std::map<int, int> real_all;
+	for (int i = 0; i < 500; i++) {
+		low[i] = i;
+		real_all[i] = i;
+	}
+	for (int i = 100000; i < 100010; i++) {
+		high[i] = i;
+		real_all[i] = i;
+	}
+	high.join(low);
+	if (!map_same_keys(real_all, high) || !low.empty()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Join overlapping maps");
+	ft::map<int, int> overlap;
+	overlap[250] = 0;
+	overlap[100005] = 0;
+	try {
+		high.join(overlap);
+		return Test_failure();
+	}
+	catch (const std::invalid_argument& e) {
+		;
+	}
+	if (overlap.size() != 2 || !map_same_keys(real_all, high)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void map_test_set_operations() {
+	title("\e[95m-Set operations-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>	real_a;
+	std::map<int, int>	real_b;
+	for (int i = 0; i < 2000; i++) {
+		real_a[rand() % 5000] = 1;
+		real_b[rand() % 5000] = 2;
+	}
+	real_b[-3] = 2;
+	std::map<int, int> real_union(real_a);
+	std::map<int, int> real_inter;
+	std::map<int, int> real_diff;
+	std::map<int, int> real_rest;
+	for (std::map<int, int>::iterator it = real_b.begin(); it != real_b.end(); ++it) {
+		real_union.insert(*it);
+		if (real_a.count(it->first)) {
+			real_inter.insert(*real_a.find(it->first));
+			real_rest.insert(*it);
+		}
+	}
+	for (std::map<int, int>::iterator it = real_a.begin(); it != real_a.end(); ++it) {
+		if (!real_b.count(it->first)) {
+			real_diff.insert(*it);
+		}
+	}
+
+	annonce("Merge");
+	ft::map<int, int> mine_a;
+	map_fill(real_a, mine_a);
+	ft::map<int, int> mine_b;
+	map_fill(real_b, mine_b);
+	mine_a.merge(mine_b);
+	if (!map_same_keys(real_union, mine_a) || !map_same_keys(real_rest, mine_b) || mine_a[-3] != 2) {
+		return Test_failure();
+	}
+	for (ft::map<int, int>::iterator it = mine_b.begin(); it != mine_b.end(); ++it) {
+		if (mine_a[it->first] != 1) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Set_union");
+	ft::map<int, int> union_a;
+	map_fill(real_a, union_a);
+	ft::map<int, int> union_b;
+	map_fill(real_b, union_b);
+	union_a.set_union(union_b);
+	if (!map_same_keys(real_union, union_a) || !union_b.empty()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Set_intersection");
+	ft::map<int, int> inter_a;
+	map_fill(real_a, inter_a);
+	ft::map<int, int> inter_b;
+	map_fill(real_b, inter_b);
+	inter_a.set_intersection(inter_b);
+	if (!map_same_keys(real_inter, inter_a) || !inter_b.empty()) {
+		return Test_failure();
+	}
+	for (ft::map<int, int>::iterator it = inter_a.begin(); it != inter_a.end(); ++it) {
+		if (it->second != 1) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Set_difference");
+	ft::map<int, int> diff_a;
+	map_fill(real_a, diff_a);
+	ft::map<int, int> diff_b;
+	map_fill(real_b, diff_b);
+	diff_a.set_difference(diff_b);
+	if (!map_same_keys(real_diff, diff_a) || !diff_b.empty()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+// Key that counts its constructions, to check that lookups build no temporary key
+struct counted_key
+{
+	static int	built;
+	std::string	str;
+
+	counted_key()
+		: str() {
+	};
+
+	counted_key( const char *s )
+		: str(s) {
+		built++;
+	};
+
+	counted_key( const counted_key& other )
+		: str(other.str) {
+		built++;
+	};
+};
+
+int	counted_key::built = 0;
+
+struct counted_key_less
+{
+	typedef void	is_transparent;
+
+	bool operator()( const counted_key& lhs, const counted_key& rhs ) const {
+		return lhs.str < rhs.str;
+	};
+
+	bool operator()( const counted_key& lhs, const char *rhs ) const {
+		return lhs.str.compare(rhs) < 0;
+	};
+
+	bool operator()( const char *lhs, const counted_key& rhs ) const {
+		return rhs.str.compare(lhs) > 0;
+	};
+};
+
+void	map_test_transparent() {
+	title("\e[95m-Transparent lookup-\e[39m");
+
+	ft::map<counted_key, int, counted_key_less>	mine;
+	const char *words[] = { "delta", "alpha", "echo", "charlie", "bravo" };
+	for (int i = 0; i < 5; i++) {
+		mine.insert(ft::make_pair(counted_key(words[i]), i));
+	}
+
+	annonce("Find, count and bounds with a const char *");
+	int built = counted_key::built;
+	if (mine.find("charlie")->second != 3 || mine.find("zulu") != mine.end() || mine.count("echo") != 1
+		|| mine.count("foxtrot") != 0 || mine.lower_bound("c")->first.str != "charlie"
+		|| mine.upper_bound("charlie")->first.str != "delta" || mine.equal_range("bravo").first->second != 4) {
+		return Test_failure();
+	}
+	if (counted_key::built != built) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Transparent_less");
+	ft::map<std::string, int, ft::transparent_less>	strings;
+	strings["key"] = 42;
+	const ft::map<std::string, int, ft::transparent_less>& cstrings = strings;
+	if (strings.find("key")->second != 42 || cstrings.find("key")->second != 42 || cstrings.count("nope") != 0) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	map_test_find_many() {
+	title("\e[95m-Find_many-\e[39m");
+	srand(time(NULL));
+
+	ft::map<int, int>	mine;
+	for (int i = 0; i < 20000; i++) {
+		mine[rand() % 40000] = i;
+	}
+	std::vector<int> keys;
+	for (int i = 0; i < 5003; i++) {
+		keys.push_back(rand() % 40000 - 100);
+	}
+
+	annonce("Same results as find");
+	std::vector<ft::map<int, int>::iterator> found;
+	mine.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+	if (found.size() != keys.size()) {
+		return Test_failure();
+	}
+	for (std::size_t i = 0; i < keys.size(); i++) {
+		if (found[i] != mine.find(keys[i])) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Const map and empty map");
+	const ft::map<int, int>& cmine = mine;
+	std::vector<ft::map<int, int>::const_iterator> cfound(keys.size());
+	if (cmine.find_many(keys.begin(), keys.end(), cfound.begin()) != cfound.end() || cfound[7] != cmine.find(keys[7])) {
+		return Test_failure();
+	}
+	ft::map<int, int> empty;
+	found.clear();
+	empty.find_many(keys.begin(), keys.begin() + 20, std::back_inserter(found));
+	for (std::size_t i = 0; i < found.size(); i++) {
+		if (found[i] != empty.end()) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+};
+
+// Comparator that counts its calls
+struct counting_less
+{
+	static std::size_t	calls;
+
+	bool operator()( int lhs, int rhs ) const {
+		calls++;
+		return lhs < rhs;
+	};
+};
+
+std::size_t	counting_less::calls = 0;
+
+void	map_test_hint() {
+	title("\e[95m-Hinted insert and find-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>												real;
+	ft::map<int, int, counting_less>	mine;
+
+	annonce("Nearly sorted stream with the last iterator as hint");
+	ft::map<int, int, counting_less>::iterator hint = mine.end();
+	counting_less::calls = 0;
+	for (int i = 0; i < 100000; i++) {
+		int k = i * 4 + rand() % 8;
+		real.insert(std::make_pair(k, i));
+		hint = mine.insert(hint, ft::make_pair(k, i));
+		if (hint->first != k) {
+			return Test_failure();
+		}
+	}
+	if (counting_less::calls > 100000 * 8 || real.size() != mine.size()) {
+		return Test_failure();
+	}
+	std::map<int, int>::iterator rit = real.begin();
+	for (ft::map<int, int, counting_less>::iterator it = mine.begin(); it != mine.end(); ++it, ++rit) {
+		if (it->first != rit->first || it->second != rit->second) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Random hints");
+	for (int i = 0; i < 20000; i++) {
+		int k = rand() % 500000;
+		ft::map<int, int, counting_less>::iterator h = mine.lower_bound(rand() % 500000);
+		bool r = real.insert(std::make_pair(k, i)).second;
+		std::size_t size = mine.size();
+		if (mine.insert(h, ft::make_pair(k, i))->first != k || (mine.size() != size) != r) {
+			return Test_failure();
+		}
+		if (mine.find(h, k) != mine.find(k) || mine.find(h, -1) != mine.end()) {
+			return Test_failure();
+		}
+	}
+	if (real.size() != mine.size()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Sorted range constructor");
+	counting_less::calls = 0;
+	ft::map<int, int, counting_less> copy(mine.begin(), mine.end());
+	if (counting_less::calls > mine.size() * 3 || copy.size() != mine.size()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Nearly sorted lookups with the last iterator as hint");
+	counting_less::calls = 0;
+	ft::map<int, int, counting_less>::const_iterator found = mine.begin();
+	for (rit = real.begin(); rit != real.end(); ++rit) {
+		found = mine.find(found, rit->first);
+		if (found == mine.end() || found->second != rit->second) {
+			return Test_failure();
+		}
+	}
+	if (counting_less::calls > real.size() * 8) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	map_test_compact() {
+	title("\e[95m-Compact-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>	real;
+	ft::map<int, int>		mine;
+	for (int i = 0; i < 20000; i++) {
+		int k = rand() % 40000;
+		real[k] = i;
+		mine[k] = i;
+		if (i % 3 == 0) {
+			k = rand() % 40000;
+			real.erase(k);
+			mine.erase(k);
+		}
+	}
+
+	annonce("In key order: same content, nodes contiguous and in order");
+	mine.compact(ft::compact_in_order);
+	if (!map_same_keys(real, mine)) {
+		return Test_failure();
+	}
+	ft::map<int, int>::iterator it = mine.begin();
+	const char *prev = reinterpret_cast<const char *>(&*it);
+	for (++it; it != mine.end(); ++it) {
+		const char *cur = reinterpret_cast<const char *>(&*it);
+		if (static_cast<std::size_t>(cur - prev) != sizeof(ft::tree_node< ft::pair<const int, int> >)) {
+			return Test_failure();
+		}
+		prev = cur;
+	}
+	Test_success();
+
+	annonce("Van Emde Boas order: same content, root first");
+	mine.compact(ft::compact_veb);
+	if (!map_same_keys(real, mine)) {
+		return Test_failure();
+	}
+	const char *low = reinterpret_cast<const char *>(&*mine.begin());
+	for (it = mine.begin(); it != mine.end(); ++it) {
+		if (reinterpret_cast<const char *>(&*it) < low) {
+			low = reinterpret_cast<const char *>(&*it);
+		}
+	}
+	if (low != reinterpret_cast<const char *>(&*mine.nth(mine.size() / 2))) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Insert, erase, split and join after compact");
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 40000;
+		if (i % 2) {
+			real[k] = i;
+			mine[k] = i;
+		}
+		else if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+# ifdef FT_MAP_ORDER_STATISTICS
+	ft::map<int, int> greater;
+	mine.split(20000, greater);
+	std::map<int, int> real_greater(real.lower_bound(20000), real.end());
+	if (!map_same_keys(real_greater, greater)) {
+		return Test_failure();
+	}
+	greater.compact();
+	mine.join(greater);
+	if (!map_same_keys(real, mine) || !greater.empty()) {
+		return Test_failure();
+	}
+# endif
+	mine.compact();
+	ft::map<int, int> other;
+	other[-5] = -5;
+	other[20001] = 1;
+	other.compact();
+	std::size_t kept = real.count(20001);
+	mine.merge(other);
+	real[-5] = -5;
+	real.insert(std::make_pair(20001, 1));
+	mine.erase(mine.begin());
+	real.erase(real.begin());
+	if (!map_same_keys(real, mine) || other.size() != kept) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Compact an empty map");
+	ft::map<int, int> empty;
+	empty.compact();
+	empty[1] = 1;
+	empty.compact();
+	empty.erase(1);
+	empty.compact();
+	if (!empty.empty() || empty.begin() != empty.end()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+# ifdef FT_MAP_STATS
+void	map_test_stats() {
+	title("\e[95m-Stats-\e[39m");
+	srand(time(NULL));
+
+	ft::map<int, int>	mine;
+
+	annonce("Sequential inserts build a perfect tree with left rotations only");
+	for (int i = 0; i < 1023; i++) {
+		mine[i] = i;
+	}
+	ft::tree_stats s = mine.stats();
+	if (s.height != 10 || s.depths.size() != 10 || s.right_rotations != 0 || s.left_rotations == 0
+		|| s.insert_rebalances != s.left_rotations || s.erase_rebalances != 0 || s.comparisons == 0) {
+		mine.dump_stats();
+		return Test_failure();
+	}
+	for (std::size_t d = 0; d < s.depths.size(); d++) {
+		if (s.depths[d] != (1u << d)) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Lookups visit at most height nodes");
+	mine.reset_stats();
+	for (int i = 0; i < 1023; i++) {
+		if (mine.find(i) == mine.end()) {
+			return Test_failure();
+		}
+	}
+	s = mine.stats();
+	if (s.lookups != 1023 || s.visited > 1023 * 10 || s.visited_per_lookup() < 9 || s.comparisons < s.visited
+		|| s.left_rotations != 0 || s.height != 10) {
+		mine.dump_stats();
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erasures rebalance");
+	mine.reset_stats();
+	for (int i = 0; i < 600; i++) {
+		mine.erase(i);
+	}
+	s = mine.stats();
+	if (s.erase_rebalances == 0 || s.insert_rebalances != 0 || s.depths[0] != 1) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Random keys: height within the AVL bound, dump");
+	ft::map<int, int>	random;
+	for (int i = 0; i < 10000; i++) {
+		random[rand()] = i;
+	}
+	s = random.stats();
+	std::size_t nodes = 0;
+	for (std::size_t d = 0; d < s.depths.size(); d++) {
+		nodes += s.depths[d];
+	}
+	std::ostringstream out;
+	random.dump_stats(out);
+	if (nodes != random.size() || s.height > 1.45 * log2(random.size() + 2.0) || s.depths.size() != static_cast<std::size_t>(s.height)
+		|| out.str().find("height") == std::string::npos) {
+		return Test_failure();
+	}
+	Test_success();
+};
+# endif
+
 void launch_map() {
 	title("\e[93m Functions: \e[39m");
   map_test_constructors();
@@ -618,6 +1262,16 @@ void launch_map() {
 	map_test_erase();
 	map_test_swap();
 	map_test_count();
+	map_test_order_statistics();
+	map_test_split_join();
+	map_test_set_operations();
+	map_test_transparent();
+	map_test_find_many();
+	map_test_hint();
+	map_test_compact();
+# ifdef FT_MAP_STATS
+	map_test_stats();
+# endif
 };
 
 void map_test_begin() {
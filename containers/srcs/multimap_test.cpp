@@ -0,0 +1,180 @@
+#include "../class/utils.hpp"
+
+// Check that a multimap holds the same pairs as a std::multimap, in the same order
+template< class Real, class Mine >
+bool	multimap_same_content( const Real& real, const Mine& mine ) {
+	if (real.size() != mine.size()) {
+		std::cout << "Real multimap: " << real.size() << std::endl;
+		std::cout << "Mine multimap: " << mine.size() << std::endl;
+		return false;
+	}
+	typename Real::const_iterator rit = real.begin();
+	for (typename Mine::const_iterator it = mine.begin(); it != mine.end(); ++it, ++rit) {
+		if (it->first != rit->first || it->second != rit->second) {
+			return false;
+		}
+	}
+	return true;
+};
+
+void	multimap_test_insert() {
+	title("\e[95m-Insert-\e[39m");
+	srand(time(NULL));
+
+	std::multimap<int, int>		real;
+	PRE::multimap<int, int>		mine;
+
+	annonce("Equivalent keys keep insertion order");
+	for (int i = 0; i < 10000; i++) {
+		int k = rand() % 1000;
+		real.insert(std::make_pair(k, i));
+		PRE::multimap<int, int>::iterator it = mine.insert(PRE::make_pair(k, i));
+		if (it->first != k || it->second != i) {
+			return Test_failure();
+		}
+	}
+	if (!multimap_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+# if !STD
+	// std::multimap inserts as close as possible before the hint instead
+	annonce("A hint inside a run of equivalent keys");
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 1000;
+		PRE::multimap<int, int>::iterator hint = mine.lower_bound(k + rand() % 3 - 1);
+		for (int step = rand() % 4; step > 0 && hint != mine.end(); step--) {
+			++hint;
+		}
+		real.insert(std::make_pair(k, -i));
+		PRE::multimap<int, int>::iterator it = mine.insert(hint, PRE::make_pair(k, -i));
+		if (it->first != k || it->second != -i) {
+			return Test_failure();
+		}
+	}
+	if (!multimap_same_content(real, mine)) {
+		return Test_failure();
+	}
+	PRE::multimap<int, int> run;
+	for (int i = 0; i < 7; i++) {
+		run.insert(PRE::make_pair(5, i));
+	}
+	run.insert(run.lower_bound(5), PRE::make_pair(5, 99));
+	run.insert(run.end(), PRE::make_pair(5, 100));
+	if ((--run.end())->second != 100 || (----run.end())->second != 99 || run.begin()->second != 0) {
+		return Test_failure();
+	}
+	Test_success();
+# endif
+
+	annonce("Copy and comparisons");
+	PRE::multimap<int, int> copy(mine);
+	if (copy != mine || copy < mine) {
+		return Test_failure();
+	}
+	copy.begin()->second = -1;
+	if (copy == mine || !(copy < mine)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	multimap_test_lookup() {
+	title("\e[95m-Lookup-\e[39m");
+
+	std::multimap<int, int>		real;
+	PRE::multimap<int, int>		mine;
+	for (int i = 0; i < 3000; i++) {
+		real.insert(std::make_pair(i % 300, i));
+		mine.insert(PRE::make_pair(i % 300, i));
+	}
+
+	annonce("Count, find and equal_range");
+	for (int k = -1; k < 301; k++) {
+		if (real.count(k) != mine.count(k)) {
+			return Test_failure();
+		}
+		PRE::multimap<int, int>::iterator found = mine.find(k);
+		if ((found == mine.end()) != (real.find(k) == real.end())
+			|| (found != mine.end() && found->second != real.find(k)->second)) {
+			return Test_failure();
+		}
+		PRE::pair<PRE::multimap<int, int>::iterator, PRE::multimap<int, int>::iterator> range = mine.equal_range(k);
+		std::pair<std::multimap<int, int>::iterator, std::multimap<int, int>::iterator> rrange = real.equal_range(k);
+		for (; range.first != range.second; ++range.first, ++rrange.first) {
+			if (rrange.first == rrange.second || range.first->second != rrange.first->second) {
+				return Test_failure();
+			}
+		}
+		if (rrange.first != rrange.second) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Order statistics");
+	ft::multimap<int, int> stats;
+	for (int i = 0; i < 1000; i++) {
+		stats.insert(ft::make_pair(i / 10, i));
+	}
+	if (stats.rank(50) != 500 || stats.count_range(10, 20) != 100 || stats.nth(505)->second != 505) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	multimap_test_erase() {
+	title("\e[95m-Erase-\e[39m");
+	srand(time(NULL));
+
+	std::multimap<int, int>		real;
+	PRE::multimap<int, int>		mine;
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 500;
+		real.insert(std::make_pair(k, i));
+		mine.insert(PRE::make_pair(k, i));
+	}
+
+	annonce("Erase by key");
+	for (int k = 0; k < 500; k += 3) {
+		if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+	if (!multimap_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase by iterator");
+	std::multimap<int, int>::iterator rit = real.begin();
+	for (PRE::multimap<int, int>::iterator it = mine.begin(); it != mine.end(); ) {
+		if (it->second % 2) {
+			real.erase(rit++);
+			mine.erase(it++);
+		}
+		else {
+			++rit;
+			++it;
+		}
+	}
+	if (!multimap_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase range");
+	mine.erase(mine.begin(), mine.end());
+	if (!mine.empty() || mine.begin() != mine.end() || mine.count(1) != 0) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_multimap() {
+	title("\e[93m Multimap: \e[39m");
+	multimap_test_insert();
+	multimap_test_lookup();
+	multimap_test_erase();
+};
@@ -0,0 +1,208 @@
+#include "../class/utils.hpp"
+
+/*
+**	Performance
+**
+**	Repeated measurements of the main operations, std against PRE. Every
+**	operation runs PERF_WARMUP times untimed, then PERF_REPETITIONS times timed,
+**	each time on a fresh container; the reports are in nanoseconds per operation.
+*/
+
+#define PERF_REPETITIONS 31
+#define PERF_WARMUP 3
+
+template< class Vector >
+ft::perf_stats	perf_vector_push_back( int n ) {
+	ft::perf_timer t(PERF_REPETITIONS, PERF_WARMUP, n);
+	while (t.next()) {
+		Vector v;
+		t.start();
+		for (int i = 0; i < n; i++) {
+			v.push_back(i);
+		}
+		t.stop();
+		ft::do_not_optimize(v);
+	}
+	return t.stats();
+};
+
+template< class Vector >
+ft::perf_stats	perf_vector_insert_front( int n ) {
+	ft::perf_timer t(PERF_REPETITIONS, PERF_WARMUP, n);
+	while (t.next()) {
+		Vector v;
+		t.start();
+		for (int i = 0; i < n; i++) {
+			v.insert(v.begin(), i);
+		}
+		t.stop();
+		ft::do_not_optimize(v);
+	}
+	return t.stats();
+};
+
+template< class Vector >
+ft::perf_stats	perf_vector_copy( int n ) {
+	Vector v(n, 42);
+	ft::perf_timer t(PERF_REPETITIONS, PERF_WARMUP, n);
+	while (t.next()) {
+		Vector copy(v);
+		t.stop();
+		ft::do_not_optimize(copy);
+	}
+	return t.stats();
+};
+
+template< class Vector >
+ft::perf_stats	perf_vector_scan( int n ) {
+	Vector v;
+	for (int i = 0; i < n; i++) {
+		v.push_back(i);
+	}
+	ft::perf_timer t(PERF_REPETITIONS, PERF_WARMUP, n);
+	while (t.next()) {
+		long sum = 0;
+		for (typename Vector::const_iterator it = v.begin(); it != v.end(); ++it) {
+			sum += *it;
+		}
+		ft::do_not_optimize(sum);
+	}
+	return t.stats();
+};
+
+template< class Map >
+ft::perf_stats	perf_map_insert( const std::vector<int>& keys ) {
+	ft::perf_timer t(PERF_REPETITIONS, PERF_WARMUP, keys.size());
+	while (t.next()) {
+		Map m;
+		t.start();
+		for (std::size_t i = 0; i < keys.size(); i++) {
+			m.insert(typename Map::value_type(keys[i], i));
+		}
+		t.stop();
+		ft::do_not_optimize(m);
+	}
+	return t.stats();
+};
+
+template< class Map >
+ft::perf_stats	perf_map_find( const std::vector<int>& keys ) {
+	Map m;
+	for (std::size_t i = 0; i < keys.size(); i++) {
+		m[keys[i]] = i;
+	}
+	ft::perf_timer t(PERF_REPETITIONS, PERF_WARMUP, keys.size());
+	while (t.next()) {
+		std::size_t found = 0;
+		for (std::size_t i = 0; i < keys.size(); i++) {
+			found += m.count(keys[(i * 7919) % keys.size()]);
+		}
+		ft::do_not_optimize(found);
+	}
+	return t.stats();
+};
+
+template< class Map >
+ft::perf_stats	perf_map_erase( const std::vector<int>& keys ) {
+	ft::perf_timer t(PERF_REPETITIONS, PERF_WARMUP, keys.size());
+	while (t.next()) {
+		Map m;
+		for (std::size_t i = 0; i < keys.size(); i++) {
+			m[keys[i]] = i;
+		}
+		t.start();
+		for (std::size_t i = 0; i < keys.size(); i++) {
+			m.erase(keys[i]);
+		}
+		t.stop();
+		ft::do_not_optimize(m);
+	}
+	return t.stats();
+};
+
+template< class Map >
+ft::perf_stats	perf_map_scan( const std::vector<int>& keys ) {
+	Map m;
+	for (std::size_t i = 0; i < keys.size(); i++) {
+		m[keys[i]] = i;
+	}
+	ft::perf_timer t(PERF_REPETITIONS, PERF_WARMUP, m.size());
+	while (t.next()) {
+		long sum = 0;
+		for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it) {
+			sum += it->second;
+		}
+		ft::do_not_optimize(sum);
+	}
+	return t.stats();
+};
+
+template< class Stack >
+ft::perf_stats	perf_stack_push_pop( int n ) {
+	ft::perf_timer t(PERF_REPETITIONS, PERF_WARMUP, n);
+	while (t.next()) {
+		Stack s;
+		t.start();
+		for (int i = 0; i < n; i++) {
+			s.push(i);
+		}
+		while (!s.empty()) {
+			s.pop();
+		}
+		t.stop();
+		ft::do_not_optimize(s);
+	}
+	return t.stats();
+};
+
+void	perf_test_vector() {
+	title("\e[95m-Vector-\e[39m");
+
+	annonce("Push_back 10000 elements");
+	Test_performance(perf_vector_push_back< std::vector<int> >(10000), perf_vector_push_back< PRE::vector<int> >(10000));
+
+	annonce("Insert 500 elements at the begin");
+	Test_performance(perf_vector_insert_front< std::vector<int> >(500), perf_vector_insert_front< PRE::vector<int> >(500));
+
+	annonce("Copy 10000 elements");
+	Test_performance(perf_vector_copy< std::vector<int> >(10000), perf_vector_copy< PRE::vector<int> >(10000));
+
+	annonce("Iterate over 10000 elements");
+	Test_performance(perf_vector_scan< std::vector<int> >(10000), perf_vector_scan< PRE::vector<int> >(10000));
+};
+
+void	perf_test_map() {
+	title("\e[95m-Map-\e[39m");
+	srand(42);
+
+	std::vector<int>	keys;
+	for (int i = 0; i < 5000; i++) {
+		keys.push_back(rand());
+	}
+
+	annonce("Insert 5000 random keys");
+	Test_performance(perf_map_insert< std::map<int, int> >(keys), perf_map_insert< PRE::map<int, int> >(keys));
+
+	annonce("Find 5000 keys");
+	Test_performance(perf_map_find< std::map<int, int> >(keys), perf_map_find< PRE::map<int, int> >(keys));
+
+	annonce("Erase 5000 keys");
+	Test_performance(perf_map_erase< std::map<int, int> >(keys), perf_map_erase< PRE::map<int, int> >(keys));
+
+	annonce("Iterate over 5000 elements");
+	Test_performance(perf_map_scan< std::map<int, int> >(keys), perf_map_scan< PRE::map<int, int> >(keys));
+};
+
+void	perf_test_stack() {
+	title("\e[95m-Stack-\e[39m");
+
+	annonce("Push then pop 10000 elements");
+	Test_performance(perf_stack_push_pop< std::stack<int> >(10000), perf_stack_push_pop< PRE::stack<int> >(10000));
+};
+
+void	launch_performance() {
+	title("\e[93m Performance: \e[39m");
+	perf_test_vector();
+	perf_test_map();
+	perf_test_stack();
+};
@@ -0,0 +1,219 @@
+#include "../class/utils.hpp"
+
+// Check that a persistent_map holds exactly the same elements as a std::map, in both directions
+template< class Real, class Mine >
+bool	persistent_same_content( const Real& real, const Mine& mine ) {
+	if (real.size() != mine.size()) {
+		return false;
+	}
+	typename Real::const_iterator rit = real.begin();
+	typename Mine::const_iterator mit = mine.begin();
+	for (; rit != real.end(); ++rit, ++mit) {
+		if (mit == mine.end() || rit->first != mit->first || rit->second != mit->second) {
+			return false;
+		}
+	}
+	if (mit != mine.end()) {
+		return false;
+	}
+	typename Real::const_reverse_iterator rrit = real.rbegin();
+	typename Mine::const_reverse_iterator mrit = mine.rbegin();
+	for (; rrit != real.rend(); ++rrit, ++mrit) {
+		if (mrit == mine.rend() || rrit->first != mrit->first) {
+			return false;
+		}
+	}
+	return true;
+};
+
+void	persistent_map_test_versions() {
+	title("\e[95m-Versions-\e[39m");
+	srand(time(NULL));
+
+	std::vector< std::map<int, int> >						real;
+	std::vector< ft::persistent_map<int, int> >	mine;
+	real.push_back(std::map<int, int>());
+	mine.push_back(ft::persistent_map<int, int>());
+
+	annonce("Insert keeps every version");
+	for (int i = 0; i < 2000; i++) {
+		int k = rand() % 3000;
+		std::map<int, int> next = real.back();
+		next.insert(std::make_pair(k, i));
+		real.push_back(next);
+		mine.push_back(mine.back().insert(ft::make_pair(k, i)));
+	}
+	for (size_t v = 0; v < real.size(); v += 97) {
+		if (!persistent_same_content(real[v], mine[v])) {
+			return Test_failure();
+		}
+	}
+	if (!persistent_same_content(real.back(), mine.back())) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase keeps every version");
+	size_t first = real.size();
+	for (int i = 0; i < 2000; i++) {
+		int k = rand() % 3000;
+		std::map<int, int> next = real.back();
+		next.erase(k);
+		real.push_back(next);
+		mine.push_back(mine.back().erase(k));
+	}
+	for (size_t v = 0; v < real.size(); v += 89) {
+		if (!persistent_same_content(real[v], mine[v])) {
+			return Test_failure();
+		}
+	}
+	if (!persistent_same_content(real[first - 1], mine[first - 1]) || !persistent_same_content(real.back(), mine.back())) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Insert_or_assign");
+	ft::persistent_map<int, int>	before = mine.back();
+	std::map<int, int>						expected = real.back();
+	ft::persistent_map<int, int>	after = before;
+	for (int k = 0; k < 3000; k += 7) {
+		expected[k] = -k;
+		after = after.insert_or_assign(k, -k);
+	}
+	if (!persistent_same_content(expected, after) || !persistent_same_content(real.back(), before)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	persistent_map_test_lookup() {
+	title("\e[95m-Lookup-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>							real;
+	ft::persistent_map<int, int>	mine;
+	for (int i = 0; i < 3000; i++) {
+		int k = rand() % 6000;
+		real.insert(std::make_pair(k, i));
+		mine = mine.insert(ft::make_pair(k, i));
+	}
+
+	annonce("Find, count and at");
+	for (int k = -10; k < 6010; k++) {
+		std::map<int, int>::const_iterator rit = real.find(k);
+		ft::persistent_map<int, int>::const_iterator mit = mine.find(k);
+		if ((rit == real.end()) != (mit == mine.end()) || real.count(k) != mine.count(k)) {
+			return Test_failure();
+		}
+		if (rit != real.end() && (mit->second != rit->second || mine.at(k) != real.at(k))) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Lower_bound and upper_bound");
+	for (int k = -10; k < 6010; k++) {
+		std::map<int, int>::const_iterator rlo = real.lower_bound(k);
+		ft::persistent_map<int, int>::const_iterator mlo = mine.lower_bound(k);
+		std::map<int, int>::const_iterator rup = real.upper_bound(k);
+		ft::persistent_map<int, int>::const_iterator mup = mine.upper_bound(k);
+		if ((rlo == real.end()) != (mlo == mine.end()) || (rlo != real.end() && rlo->first != mlo->first)) {
+			return Test_failure();
+		}
+		if ((rup == real.end()) != (mup == mine.end()) || (rup != real.end() && rup->first != mup->first)) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Iterate from a bound in both directions");
+	std::map<int, int>::const_iterator rit = real.lower_bound(3000);
+	ft::persistent_map<int, int>::const_iterator mit = mine.lower_bound(3000);
+	for (; rit != real.end(); ++rit, ++mit) {
+		if (rit->first != mit->first) {
+			return Test_failure();
+		}
+	}
+	rit = real.lower_bound(3000);
+	mit = mine.lower_bound(3000);
+	while (rit != real.begin()) {
+		--rit;
+		--mit;
+		if (rit->first != mit->first) {
+			return Test_failure();
+		}
+	}
+	if (mit != mine.begin()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("At out of range");
+	try {
+		mine.at(-1);
+		return Test_failure();
+	}
+	catch (const std::exception& e) {
+		;
+	}
+	Test_success();
+};
+
+void	persistent_map_test_snapshot() {
+	title("\e[95m-Snapshot-\e[39m");
+
+	ft::persistent_map<std::string, int>	mine;
+	std::map<std::string, int>						real;
+	for (int i = 0; i < 1000; i++) {
+		std::ostringstream key;
+		key << "key" << (i * 7919) % 1009;
+		real[key.str()] = i;
+		mine = mine.insert_or_assign(key.str(), i);
+	}
+
+	annonce("Snapshot is unaffected by later versions");
+	ft::persistent_map<std::string, int>								snap = mine.snapshot();
+	ft::persistent_map<std::string, int>::const_iterator	it = snap.begin();
+	std::map<std::string, int>													later = real;
+	for (int i = 0; i < 1000; i += 2) {
+		std::ostringstream key;
+		key << "key" << i;
+		later.erase(key.str());
+		mine = mine.erase(key.str());
+	}
+	later["extra"] = 42;
+	mine = mine.insert(ft::make_pair(std::string("extra"), 42));
+	if (!persistent_same_content(real, snap) || it != snap.begin() || it->first != real.begin()->first) {
+		return Test_failure();
+	}
+	if (!persistent_same_content(later, mine) || snap.count("extra") != 0) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Operator =, == and swap");
+	ft::persistent_map<std::string, int>	copy;
+	copy = snap;
+	if (copy != snap || copy == mine || !(snap < copy.erase("key0"))) {
+		return Test_failure();
+	}
+	copy.swap(mine);
+	if (copy.count("extra") != 1 || mine != snap) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Clear");
+	ft::persistent_map<std::string, int>	empty = snap.clear();
+	if (!empty.empty() || empty.begin() != empty.end() || snap.size() != real.size()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_persistent_map() {
+	title("\e[93m Persistent_map: \e[39m");
+	persistent_map_test_versions();
+	persistent_map_test_lookup();
+	persistent_map_test_snapshot();
+};
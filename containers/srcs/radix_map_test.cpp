@@ -0,0 +1,298 @@
+#include "../class/utils.hpp"
+
+// Check that a radix_map holds exactly the same elements as a std::map, in both directions
+template< class Real, class Mine >
+bool	radix_same_content( const Real& real, const Mine& mine ) {
+	if (real.size() != mine.size()) {
+		std::cout << "Real map: " << real.size() << std::endl;
+		std::cout << "Mine map: " << mine.size() << std::endl;
+		return false;
+	}
+	typename Real::const_iterator rit = real.begin();
+	typename Mine::const_iterator mit = mine.begin();
+	for (; rit != real.end(); ++rit, ++mit) {
+		if (mit == mine.end() || rit->first != mit->first || rit->second != mit->second) {
+			return false;
+		}
+	}
+	if (mit != mine.end()) {
+		return false;
+	}
+	typename Real::const_reverse_iterator rrit = real.rbegin();
+	typename Mine::const_reverse_iterator mrit = mine.rbegin();
+	for (; rrit != real.rend(); ++rrit, ++mrit) {
+		if (rrit->first != mrit->first) {
+			return false;
+		}
+	}
+	return true;
+};
+
+// Random 64-bit key, negative half of the time, spread over every byte
+static long	radix_random_key() {
+	long k = static_cast<long>(rand()) << 32 ^ static_cast<long>(rand()) << 8 ^ rand() % 256;
+	return rand() % 2 ? k : -k;
+};
+
+void	radix_map_test_insert() {
+	title("\e[95m-Insert-\e[39m");
+	srand(time(NULL));
+
+	std::map<long, int>				real;
+	ft::radix_map<long, int>	mine;
+
+	annonce("Insert 10000 random 64-bit keys");
+	std::vector<long> keys;
+	for (int i = 0; i < 10000; i++) {
+		long k = (i % 4 || keys.empty()) ? radix_random_key() : keys[rand() % keys.size()];
+		keys.push_back(k);
+		bool r = real.insert(std::make_pair(k, i)).second;
+		ft::pair<ft::radix_map<long, int>::iterator, bool> m = mine.insert(ft::make_pair(k, i));
+		if (r != m.second || m.first->first != k) {
+			return Test_failure();
+		}
+	}
+	if (!radix_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Keys sharing long prefixes");
+	for (long k = -300; k < 300; k++) {
+		real[k * 3] += 1;
+		mine[k * 3] += 1;
+		real[k << 40] += 2;
+		mine[k << 40] += 2;
+	}
+	if (!radix_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Range constructor");
+	std::vector< ft::pair<int, int> > values;
+	for (int i = 0; i < 1000; i++) {
+		values.push_back(ft::make_pair(i % 700 - 350, i));
+	}
+	ft::radix_map<int, int> range(values.begin(), values.end());
+	if (range.size() != 700 || range.at(-350) != 0 || range.at(349) != 699 || range.begin()->first != -350) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	radix_map_test_find() {
+	title("\e[95m-Find-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>				real;
+	ft::radix_map<int, int>		mine;
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 20000 - 10000;
+		real[k] = i;
+		mine[k] = i;
+	}
+
+	annonce("Find, count and at");
+	for (int k = -10010; k < 10010; k++) {
+		std::map<int, int>::iterator rit = real.find(k);
+		ft::radix_map<int, int>::iterator mit = mine.find(k);
+		if ((rit == real.end()) != (mit == mine.end()) || real.count(k) != mine.count(k)) {
+			return Test_failure();
+		}
+		if (rit != real.end() && (mit->second != rit->second || mine.at(k) != rit->second)) {
+			return Test_failure();
+		}
+	}
+	try {
+		mine.at(20000);
+		return Test_failure();
+	}
+	catch (const std::out_of_range&) {
+	}
+	Test_success();
+
+	annonce("Lower_bound, upper_bound and equal_range");
+	for (int k = -10010; k < 10010; k++) {
+		std::map<int, int>::iterator rlo = real.lower_bound(k);
+		ft::radix_map<int, int>::iterator mlo = mine.lower_bound(k);
+		std::map<int, int>::iterator rup = real.upper_bound(k);
+		ft::radix_map<int, int>::iterator mup = mine.upper_bound(k);
+		if ((rlo == real.end()) != (mlo == mine.end()) || (rup == real.end()) != (mup == mine.end())) {
+			return Test_failure();
+		}
+		if ((rlo != real.end() && rlo->first != mlo->first) || (rup != real.end() && rup->first != mup->first)) {
+			return Test_failure();
+		}
+		if (mine.equal_range(k).first != mlo || mine.equal_range(k).second != mup) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Bounds of 64-bit keys");
+	std::map<long, int>				real64;
+	ft::radix_map<long, int>	mine64;
+	for (int i = 0; i < 5000; i++) {
+		long k = radix_random_key();
+		real64[k] = i;
+		mine64[k] = i;
+	}
+	for (int i = 0; i < 20000; i++) {
+		long k = i % 2 ? radix_random_key() : real64.begin()->first + i - 10;
+		std::map<long, int>::iterator rlo = real64.lower_bound(k);
+		ft::radix_map<long, int>::const_iterator mlo = const_cast<const ft::radix_map<long, int>&>(mine64).lower_bound(k);
+		if ((rlo == real64.end()) != (mlo == mine64.end()) || (rlo != real64.end() && rlo->first != mlo->first)) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+};
+
+void	radix_map_test_erase() {
+	title("\e[95m-Erase-\e[39m");
+	srand(time(NULL));
+
+	std::map<long, int>				real;
+	ft::radix_map<long, int>	mine;
+	for (int i = 0; i < 10000; i++) {
+		long k = radix_random_key();
+		real[k] = i;
+		mine[k] = i;
+		real[i] = i;
+		mine[i] = i;
+	}
+
+	annonce("Erase random keys");
+	for (long i = 0; i < 20000; i++) {
+		std::map<long, int>::iterator near = real.lower_bound(radix_random_key());
+		long k = (i % 2 || near == real.end()) ? i / 2 + rand() % 10 : near->first;
+		if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+	if (!radix_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase with iterator");
+	real.erase(real.begin());
+	mine.erase(mine.begin());
+	if (!radix_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase with range");
+	real.erase(real.lower_bound(3000), real.lower_bound(9000));
+	mine.erase(mine.lower_bound(3000), mine.lower_bound(9000));
+	if (!radix_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase everything");
+	real.erase(real.begin(), real.end());
+	mine.erase(mine.begin(), mine.end());
+	if (!radix_same_content(real, mine) || !mine.empty() || mine.begin() != mine.end()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	radix_map_test_dense() {
+	title("\e[95m-Dense keys-\e[39m");
+	srand(time(NULL));
+
+	std::map<unsigned short, int>				real;
+	ft::radix_map<unsigned short, int>	mine;
+
+	annonce("Fill every node size");
+	for (int round = 0; round < 3; round++) {
+		for (int i = 0; i < 65536; i += 1 + rand() % 3) {
+			real[i] = i;
+			mine[i] = i;
+		}
+		if (!radix_same_content(real, mine)) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Shrink every node size");
+	for (int i = 0; i < 200000; i++) {
+		unsigned short k = rand() % 65536;
+		if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+		if (i % 20000 == 0 && !radix_same_content(real, mine)) {
+			return Test_failure();
+		}
+	}
+	if (!radix_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Char keys");
+	std::map<char, int>				small_real;
+	ft::radix_map<char, int>		small_mine;
+	for (int i = 0; i < 1000; i++) {
+		char k = static_cast<char>(rand() % 256 - 128);
+		if (i % 3) {
+			small_real[k] = i;
+			small_mine[k] = i;
+		}
+		else if (small_real.erase(k) != small_mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+	if (!radix_same_content(small_real, small_mine)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	radix_map_test_copy_swap() {
+	title("\e[95m-Copy and swap-\e[39m");
+
+	ft::radix_map<long, int>	mine;
+	for (long i = 0; i < 1000; i++) {
+		mine[i * 977 - 5000] = static_cast<int>(i);
+	}
+
+	annonce("Copy constructor and operator=");
+	ft::radix_map<long, int>	copy(mine);
+	ft::radix_map<long, int>	assigned;
+	assigned[-1] = -1;
+	assigned = mine;
+	if (copy != mine || assigned != mine) {
+		return Test_failure();
+	}
+	copy[0] = 42;
+	if (copy == mine) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Swap");
+	ft::radix_map<long, int>	other;
+	ft::radix_map<long, int>::iterator kept = mine.begin();
+	other[42] = 42;
+	other.swap(assigned);
+	ft::swap(mine, assigned);
+	if (other != assigned || mine.size() != 1 || mine.begin()->first != 42 || kept != assigned.begin()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_radix_map() {
+	title("\e[93m Radix_map: \e[39m");
+	radix_map_test_insert();
+	radix_map_test_find();
+	radix_map_test_erase();
+	radix_map_test_dense();
+	radix_map_test_copy_swap();
+};
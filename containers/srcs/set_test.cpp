@@ -0,0 +1,256 @@
+#include "../class/utils.hpp"
+
+void	set_test_insert() {
+	title("\e[95m-Insert-\e[39m");
+	srand(time(NULL));
+
+	std::set<int>		real;
+	PRE::set<int>		mine;
+
+	annonce("Insert 10000 random keys");
+	for (int i = 0; i < 10000; i++) {
+		int k = rand() % 5000;
+		bool r = real.insert(k).second;
+		PRE::pair<PRE::set<int>::iterator, bool> m = mine.insert(k);
+		if (r != m.second || *m.first != k) {
+			return Test_failure();
+		}
+	}
+	if (real.size() != mine.size() || !ft::equal(mine.begin(), mine.end(), real.begin())) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Reverse iterators");
+	if (!ft::equal(mine.rbegin(), mine.rend(), real.rbegin())) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Range constructor and comparisons");
+	PRE::set<int> copy(mine.begin(), mine.end());
+	if (copy != mine || copy < mine || !(copy <= mine)) {
+		return Test_failure();
+	}
+	copy.insert(-1);
+	if (copy == mine || !(copy < mine)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	set_test_find() {
+	title("\e[95m-Find-\e[39m");
+
+	std::set<int>		real;
+	PRE::set<int>		mine;
+	for (int i = 0; i < 1000; i += 3) {
+		real.insert(i);
+		mine.insert(i);
+	}
+
+	annonce("Find, count and bounds");
+	for (int k = -5; k < 1005; k++) {
+		if ((real.find(k) == real.end()) != (mine.find(k) == mine.end()) || real.count(k) != mine.count(k)) {
+			return Test_failure();
+		}
+		if ((real.lower_bound(k) == real.end()) != (mine.lower_bound(k) == mine.end())
+			|| (mine.lower_bound(k) != mine.end() && *mine.lower_bound(k) != *real.lower_bound(k))) {
+			return Test_failure();
+		}
+		if ((real.upper_bound(k) == real.end()) != (mine.upper_bound(k) == mine.end())
+			|| (mine.upper_bound(k) != mine.end() && *mine.upper_bound(k) != *real.upper_bound(k))) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+};
+
+void	set_test_erase() {
+	title("\e[95m-Erase-\e[39m");
+	srand(time(NULL));
+
+	std::set<int>		real;
+	PRE::set<int>		mine;
+	for (int i = 0; i < 5000; i++) {
+		real.insert(i);
+		mine.insert(i);
+	}
+
+	annonce("Erase random keys");
+	for (int i = 0; i < 6000; i++) {
+		int k = rand() % 6000;
+		if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+	if (real.size() != mine.size() || !ft::equal(mine.begin(), mine.end(), real.begin())) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Iterators stay valid across erase");
+	PRE::set<int>::iterator keep = mine.begin();
+	for (int i = 0; i < 10; i++) {
+		++keep;
+	}
+	int kept = *keep;
+	for (PRE::set<int>::iterator it = mine.begin(); it != mine.end(); ) {
+		if (it != keep && *it % 2 == 0) {
+			real.erase(*it);
+			mine.erase(it++);
+		}
+		else {
+			++it;
+		}
+	}
+	if (*keep != kept || mine.find(kept) != keep || !ft::equal(mine.begin(), mine.end(), real.begin())) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase range");
+	mine.erase(mine.begin(), mine.end());
+	if (!mine.empty() || mine.begin() != mine.end()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	set_test_set_operations() {
+	title("\e[95m-Set operations-\e[39m");
+
+	ft::set<int>	a;
+	ft::set<int>	b;
+	for (int i = 0; i < 300; i += 2) {
+		a.insert(i);
+	}
+	for (int i = 0; i < 300; i += 3) {
+		b.insert(i);
+	}
+
+	annonce("Intersection");
+	ft::set<int> inter(a);
+	ft::set<int> other(b);
+	inter.set_intersection(other);
+	ft::set<int>::iterator it = inter.begin();
+	for (int i = 0; i < 300; i += 6, ++it) {
+		if (it == inter.end() || *it != i) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+# ifdef FT_MAP_ORDER_STATISTICS
+	annonce("Split and join");
+	ft::set<int> high;
+	inter.split(150, high);
+	if (inter.size() != 25 || high.size() != 25 || *high.begin() != 150 || inter.rank(150) != 25) {
+		return Test_failure();
+	}
+	inter.join(high);
+	if (inter.size() != 50 || !high.empty() || *inter.nth(49) != 294) {
+		return Test_failure();
+	}
+	Test_success();
+# endif
+};
+
+void	multiset_test() {
+	title("\e[95m-Multiset-\e[39m");
+	srand(time(NULL));
+
+	std::multiset<int>		real;
+	PRE::multiset<int>		mine;
+
+	annonce("Insert duplicates");
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 500;
+		real.insert(k);
+		if (*mine.insert(k) != k) {
+			return Test_failure();
+		}
+	}
+	if (real.size() != mine.size() || !ft::equal(mine.begin(), mine.end(), real.begin())) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Insert with a hint inside a run of equivalent keys");
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 500;
+		PRE::multiset<int>::iterator hint = mine.lower_bound(k);
+		for (int step = rand() % 4; step > 0 && hint != mine.end(); step--) {
+			++hint;
+		}
+		real.insert(k);
+		PRE::multiset<int>::iterator it = mine.insert(hint, k);
+		if (*it != k) {
+			return Test_failure();
+		}
+# if !STD
+		// After every equivalent key, where std::multiset inserts before the hint
+		if (++it != mine.end() && *it == k) {
+			return Test_failure();
+		}
+# endif
+	}
+	if (real.size() != mine.size() || !ft::equal(mine.begin(), mine.end(), real.begin())) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Count and equal_range");
+	for (int k = -1; k < 501; k++) {
+		if (real.count(k) != mine.count(k)) {
+			return Test_failure();
+		}
+		PRE::pair<PRE::multiset<int>::iterator, PRE::multiset<int>::iterator> range = mine.equal_range(k);
+		std::size_t n = 0;
+		for (; range.first != range.second; ++range.first, ++n) {
+			if (*range.first != k) {
+				return Test_failure();
+			}
+		}
+		if (n != real.count(k)) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Erase every copy of a key");
+	for (int k = 0; k < 500; k += 2) {
+		if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+	if (real.size() != mine.size() || !ft::equal(mine.begin(), mine.end(), real.begin())) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase one copy");
+	for (int k = 1; k < 500; k += 2) {
+		if (real.find(k) != real.end()) {
+			real.erase(real.find(k));
+			mine.erase(mine.find(k));
+		}
+	}
+	if (real.size() != mine.size() || !ft::equal(mine.begin(), mine.end(), real.begin())) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_set() {
+	title("\e[93m Set: \e[39m");
+	set_test_insert();
+	set_test_find();
+	set_test_erase();
+	set_test_set_operations();
+};
+
+void	launch_multiset() {
+	title("\e[93m Multiset: \e[39m");
+	multiset_test();
+};
@@ -0,0 +1,251 @@
+#include "../class/utils.hpp"
+
+// Check that a small_map holds exactly the same elements as a std::map, in both directions
+template< class Real, class Mine >
+bool	small_same_content( const Real& real, const Mine& mine ) {
+	if (real.size() != mine.size()) {
+		std::cout << "Real map: " << real.size() << std::endl;
+		std::cout << "Mine map: " << mine.size() << std::endl;
+		return false;
+	}
+	typename Real::const_iterator rit = real.begin();
+	typename Mine::const_iterator mit = mine.begin();
+	for (; rit != real.end(); ++rit, ++mit) {
+		if (mit == mine.end() || rit->first != mit->first || rit->second != mit->second) {
+			return false;
+		}
+	}
+	if (mit != mine.end()) {
+		return false;
+	}
+	typename Real::const_reverse_iterator rrit = real.rbegin();
+	typename Mine::const_reverse_iterator mrit = mine.rbegin();
+	for (; rrit != real.rend(); ++rrit, ++mrit) {
+		if (rrit->first != mrit->first) {
+			return false;
+		}
+	}
+	return true;
+};
+
+void	small_map_test_insert() {
+	title("\e[95m-Insert-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>					real;
+	ft::small_map<int, int, 8>	mine;
+
+	annonce("Insert in random order up to the threshold");
+	while (real.size() < 8) {
+		int k = rand() % 100;
+		bool r = real.insert(std::make_pair(k, k)).second;
+		ft::pair<ft::small_map<int, int, 8>::iterator, bool> m = mine.insert(ft::make_pair(k, k));
+		if (r != m.second || m.first->first != k || !mine.is_small()) {
+			return Test_failure();
+		}
+	}
+	if (!small_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Move to the tree past the threshold");
+	for (int i = 0; i < 1000; i++) {
+		int k = rand() % 2000 - 1000;
+		bool r = real.insert(std::make_pair(k, i)).second;
+		ft::pair<ft::small_map<int, int, 8>::iterator, bool> m = mine.insert(ft::make_pair(k, i));
+		if (r != m.second || m.first->first != k) {
+			return Test_failure();
+		}
+	}
+	if (mine.is_small() || !small_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Clear goes back inline");
+	mine.clear();
+	mine[3] = 3;
+	if (!mine.is_small() || mine.size() != 1 || mine.begin()->second != 3) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("No allocation while small");
+	typedef ft::tracking_allocator< ft::pair<const int, int> >	counting;
+	ft::allocation_stats stats;
+	std::less<int> less;
+	{
+		ft::small_map<int, int, 4, std::less<int>, counting>	counted(less, counting(stats));
+		for (int i = 4; i > 0; i--) {
+			counted[i] = i;
+		}
+		counted.erase(2);
+		counted[0] = 0;
+		if (stats.allocations != 0 || counted.size() != 4 || counted.begin()->first != 0) {
+			return Test_failure();
+		}
+		counted[5] = 5;
+		if (stats.allocations == 0 || counted.is_small() || counted.size() != 5) {
+			return Test_failure();
+		}
+	}
+	if (stats.live_bytes != 0 || stats.live() != 0) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	small_map_test_find() {
+	title("\e[95m-Find-\e[39m");
+	srand(time(NULL));
+
+	for (int round = 0; round < 2; round++) {
+		std::map<int, int>					real;
+		ft::small_map<int, int, 8>	mine;
+		int	n = round ? 200 : 6;
+		for (int i = 0; i < n; i++) {
+			int k = rand() % (n * 3);
+			real[k] = i;
+			mine[k] = i;
+		}
+
+		annonce(round ? "Find, count and at in the tree" : "Find, count and at inline");
+		for (int k = -2; k < n * 3 + 2; k++) {
+			std::map<int, int>::iterator rit = real.find(k);
+			ft::small_map<int, int, 8>::iterator mit = mine.find(k);
+			if ((rit == real.end()) != (mit == mine.end()) || real.count(k) != mine.count(k)) {
+				return Test_failure();
+			}
+			if (rit != real.end() && (mit->second != rit->second || mine.at(k) != rit->second)) {
+				return Test_failure();
+			}
+		}
+		try {
+			mine.at(-100);
+			return Test_failure();
+		}
+		catch (const std::out_of_range&) {
+		}
+		Test_success();
+
+		annonce(round ? "Bounds in the tree" : "Bounds inline");
+		const ft::small_map<int, int, 8>&	cmine = mine;
+		for (int k = -2; k < n * 3 + 2; k++) {
+			std::map<int, int>::iterator rlo = real.lower_bound(k);
+			ft::small_map<int, int, 8>::const_iterator mlo = cmine.lower_bound(k);
+			std::map<int, int>::iterator rup = real.upper_bound(k);
+			ft::small_map<int, int, 8>::const_iterator mup = cmine.upper_bound(k);
+			if ((rlo == real.end()) != (mlo == cmine.end()) || (rup == real.end()) != (mup == cmine.end())) {
+				return Test_failure();
+			}
+			if ((rlo != real.end() && rlo->first != mlo->first) || (rup != real.end() && rup->first != mup->first)) {
+				return Test_failure();
+			}
+			if (mine.equal_range(k).first != mine.lower_bound(k) || mine.equal_range(k).second != mine.upper_bound(k)) {
+				return Test_failure();
+			}
+		}
+		Test_success();
+	}
+};
+
+void	small_map_test_erase() {
+	title("\e[95m-Erase-\e[39m");
+	srand(time(NULL));
+
+	for (int round = 0; round < 2; round++) {
+		std::map<int, std::string>					real;
+		ft::small_map<int, std::string, 8>	mine;
+		int	n = round ? 500 : 8;
+		for (int i = 0; i < n; i++) {
+			std::ostringstream value;
+			value << "value" << i;
+			real[i] = value.str();
+			mine[i] = value.str();
+		}
+
+		annonce(round ? "Erase by key in the tree" : "Erase by key inline");
+		for (int i = 0; i < n; i++) {
+			int k = rand() % (n + 2);
+			if (real.erase(k) != mine.erase(k)) {
+				return Test_failure();
+			}
+		}
+		if (!small_same_content(real, mine)) {
+			return Test_failure();
+		}
+		Test_success();
+
+		for (int i = 0; i < n; i += 3) {
+			real[i] = "again";
+			mine[i] = "again";
+		}
+
+		annonce(round ? "Erase by iterator and range in the tree" : "Erase by iterator and range inline");
+		real.erase(real.begin());
+		mine.erase(mine.begin());
+		real.erase(--real.end());
+		mine.erase(--mine.end());
+		real.erase(real.lower_bound(n / 4), real.lower_bound(n / 2));
+		mine.erase(mine.lower_bound(n / 4), mine.lower_bound(n / 2));
+		if (!small_same_content(real, mine)) {
+			return Test_failure();
+		}
+		real.erase(real.begin(), real.end());
+		mine.erase(mine.begin(), mine.end());
+		if (!mine.empty() || mine.begin() != mine.end()) {
+			return Test_failure();
+		}
+		Test_success();
+	}
+};
+
+void	small_map_test_copy_swap() {
+	title("\e[95m-Copy and swap-\e[39m");
+
+	ft::small_map<std::string, int, 4>	small;
+	ft::small_map<std::string, int, 4>	large;
+	for (int i = 0; i < 3; i++) {
+		std::ostringstream key;
+		key << "small" << i;
+		small[key.str()] = i;
+	}
+	for (int i = 0; i < 100; i++) {
+		std::ostringstream key;
+		key << "large" << i;
+		large[key.str()] = i;
+	}
+
+	annonce("Copy constructor and operator=");
+	ft::small_map<std::string, int, 4>	copy(small);
+	ft::small_map<std::string, int, 4>	assigned(small);
+	assigned = large;
+	if (copy != small || assigned != large || !copy.is_small() || assigned.is_small()) {
+		return Test_failure();
+	}
+	copy["small0"] = 42;
+	if (copy == small || !(small < copy) || copy.size() != 3) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Swap small and large");
+	small.swap(large);
+	if (small.size() != 100 || large.size() != 3 || large.begin()->first != "small0" || !large.is_small()) {
+		return Test_failure();
+	}
+	ft::swap(small, assigned);
+	if (small.size() != 100 || assigned.size() != 100 || assigned.rbegin()->first != "large99") {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_small_map() {
+	title("\e[93m Small_map: \e[39m");
+	small_map_test_insert();
+	small_map_test_find();
+	small_map_test_erase();
+	small_map_test_copy_swap();
+};
@@ -1,26 +1,30 @@
 #include "../class/utils.hpp"
 
+// Step of the push test, timed by perf_step
+struct stack_step_push
+{
+	template< class Stack >
+	void	operator()( Stack& s ) const {
+		for (int i = 0; i < 50; i++) {
+			s.push(i);
+		}
+	};
+};
+
 void	stack_test_push_top() {
 	title("\e[95m-Push Top-\e[39m");
 
 	std::stack<int> real;
 	PRE::stack<int> mine;
-	long time = get_time();
 
 	annonce("Push 50 elements");
 	for (int i = 0; i < 50; i++) {
 		real.push(i);
 	}
-	long real_time = get_time() - time;
-	time = get_time();
 	for (int i = 0; i < 50; i++) {
 		mine.push(i);
 	}
-	long mine_time = get_time() - time;
-	if (mine_time <= real_time * 20)
-		Test_success();
-	else
-		Test_timeout();
+	Test_performance(perf_step(std::stack<int>(), stack_step_push()), perf_step(PRE::stack<int>(), stack_step_push()));
 
 	annonce("Top");
 	if (real.top() != mine.top()) {
@@ -163,41 +167,29 @@ void	stack_test_copy() {
 
 	annonce("Copy constructor");
 
-	long time = get_time();
 	std::stack<int> real2(real);
-	long real_time = get_time() - time;
-	time = get_time();
 	PRE::stack<int> mine2(mine);
-	long mine_time = get_time() - time;
 
 	if (real2.size() != mine2.size() ||  real2.top() != mine2.top()) {
 		std::cout << "Real stack: " << real2.top() << std::endl;
 		std::cout << "Mine stack: " << mine2.top() << std::endl;
 		return Test_failure();
 	}
-	if (mine_time <= real_time * 20)
-		Test_success();
-	else
-		Test_timeout();
+	Test_performance(perf_step(real, step_copy()), perf_step(mine, step_copy()));
 
 	annonce("Operator =");
 
-	time = get_time();
-	std::stack<int> real3 = real;
-	real_time = get_time() - time;
-	time = get_time();
-	PRE::stack<int> mine3 = mine;
-	mine_time = get_time() - time;
+	std::stack<int> real3;
+	real3 = real;
+	PRE::stack<int> mine3;
+	mine3 = mine;
 
 	if (real3.top() != mine3.top()) {
 		std::cout << "Real stack: " << real3.top() << std::endl;
 		std::cout << "Mine stack: " << mine3.top() << std::endl;
 		return Test_failure();
 	}
-	if (mine_time <= real_time * 20)
-		Test_success();
-	else
-		Test_timeout();
+	Test_performance(perf_step(real, step_assign()), perf_step(mine, step_assign()));
 }
 
 void	launch_stack() {
@@ -0,0 +1,242 @@
+#include "../class/utils.hpp"
+
+typedef ft::recording_map< PRE::map<int, int> >				map_recorder;
+typedef ft::recording_vector< PRE::vector<int> >			vector_recorder;
+typedef ft::recording_stack< PRE::stack<int> >				stack_recorder;
+
+static long long	g_trace_sum;
+
+static void	trace_sum( const PRE::pair<const int, int>& value ) {
+	g_trace_sum += value.second;
+}
+
+static void	trace_sum_value( int value ) {
+	g_trace_sum += value;
+}
+
+// Replays a whole trace on a new container
+template < class Recorder, class Container >
+static bool	trace_replay( std::istream& in, ft::trace_container expected, Container& c ) {
+	ft::trace_reader reader(in);
+	ft::trace_event event;
+
+	if (reader.error() || reader.container() != expected) {
+		return false;
+	}
+	while (reader.next(event)) {
+		Recorder::apply(c, event);
+	}
+	return reader.error() == NULL;
+}
+
+void	trace_test_format() {
+	title("\e[95m-Format-\e[39m");
+
+	annonce("Keys and values round trip");
+	long long values[] = { 0, 1, -1, 63, -64, 64, 127, 128, 300, -300, 2147483647, -2147483647 - 1,
+		9223372036854775807LL, -9223372036854775807LL - 1 };
+	std::size_t count = sizeof(values) / sizeof(*values);
+	std::stringstream buffer;
+	{
+		ft::trace_writer trace(buffer, ft::trace_vector);
+		for (std::size_t i = 0; i < count; i++) {
+			trace.record(ft::trace_push, values[i], values[count - 1 - i]);
+		}
+		if (trace.events() != count) {
+			return Test_failure();
+		}
+	}
+	ft::trace_reader reader(buffer);
+	ft::trace_event event;
+	std::size_t read = 0;
+	for (; reader.next(event); read++) {
+		if (event.op != ft::trace_push || event.key != values[read] || event.value != values[count - 1 - read]) {
+			std::cout << "Event " << read << ": " << event.key << " " << event.value << std::endl;
+			return Test_failure();
+		}
+	}
+	if (read != count || reader.error() || reader.container() != ft::trace_vector) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Small events take three bytes");
+	std::stringstream small;
+	{
+		ft::trace_writer trace(small, ft::trace_map);
+		trace.record(ft::trace_find, 42);
+		trace.record(ft::trace_clear);
+	}
+	if (small.str().size() != 6 + 3 + 3) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Broken traces are reported");
+	std::stringstream not_trace("hello world");
+	std::stringstream truncated(buffer.str().substr(0, buffer.str().size() - 1));
+	std::string bad_op = small.str();
+	bad_op[6] = 42;
+	std::stringstream unknown(bad_op);
+	ft::trace_reader r1(not_trace);
+	ft::trace_reader r2(truncated);
+	ft::trace_reader r3(unknown);
+	while (r2.next(event)) {
+	}
+	if (!r1.error() || r1.next(event) || !r2.error() || r3.error() || r3.next(event) || !r3.error()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	trace_test_map() {
+	title("\e[95m-Map-\e[39m");
+
+	PRE::map<int, int>	recorded;
+	std::stringstream		buffer;
+	{
+		ft::trace_writer trace(buffer, ft::trace_map);
+		map_recorder rec(recorded, trace);
+
+		annonce("Recording forwards the operations");
+		srand(time(NULL));
+		for (int i = 0; i < 5000; i++) {
+			int key = rand() % 1000;
+			int r = rand() % 4;
+			if (r == 0) {
+				rec.insert(PRE::make_pair(key, i));
+			}
+			else if (r == 1) {
+				rec.assign(key, -i);
+			}
+			else if (r == 2) {
+				rec.erase(key);
+			}
+			else if (rec.find(key) != recorded.end() && recorded[key] != rec.find(key)->second) {
+				return Test_failure();
+			}
+		}
+		g_trace_sum = 0;
+		rec.for_each(trace_sum);
+		long long sum = 0;
+		for (PRE::map<int, int>::iterator it = recorded.begin(); it != recorded.end(); ++it) {
+			sum += it->second;
+		}
+		if (g_trace_sum != sum || &rec.container() != &recorded) {
+			return Test_failure();
+		}
+		Test_success();
+	}
+
+	annonce("Replay gives the same map");
+	PRE::map<int, int>	replayed;
+	if (!trace_replay<map_recorder>(buffer, ft::trace_map, replayed) || replayed != recorded) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	trace_test_vector() {
+	title("\e[95m-Vector-\e[39m");
+
+	PRE::vector<int>		recorded;
+	std::stringstream		buffer;
+	{
+		ft::trace_writer trace(buffer, ft::trace_vector);
+		vector_recorder rec(recorded, trace);
+
+		annonce("Recording forwards the operations");
+		for (int i = 0; i < 3000; i++) {
+			int r = rand() % 10;
+			if (r < 5 || recorded.empty()) {
+				rec.push_back(i);
+			}
+			else if (r < 7) {
+				std::size_t index = rand() % recorded.size();
+				if (rec.at(index) != recorded[index]) {
+					return Test_failure();
+				}
+			}
+			else if (r < 8) {
+				rec.pop_back();
+			}
+			else if (r < 9) {
+				rec.insert(rand() % recorded.size(), -i);
+			}
+			else {
+				rec.erase(rand() % recorded.size());
+			}
+		}
+		rec.for_each(trace_sum_value);
+		Test_success();
+	}
+
+	annonce("Replay gives the same vector");
+	PRE::vector<int>	replayed;
+	if (!trace_replay<vector_recorder>(buffer, ft::trace_vector, replayed) || replayed != recorded) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Replay ignores indexes out of the vector");
+	ft::trace_event events[] = { { ft::trace_at, 5, 0 }, { ft::trace_erase, 0, 0 }, { ft::trace_insert, 1, 7 }, { ft::trace_pop, 0, 0 } };
+	PRE::vector<int>	empty;
+	for (std::size_t i = 0; i < sizeof(events) / sizeof(*events); i++) {
+		if (vector_recorder::apply(empty, events[i]) > 0) {
+			return Test_failure();
+		}
+	}
+	if (!empty.empty()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	trace_test_stack() {
+	title("\e[95m-Stack-\e[39m");
+
+	PRE::stack<int>			recorded;
+	std::stringstream		buffer;
+	{
+		ft::trace_writer trace(buffer, ft::trace_stack);
+		stack_recorder rec(recorded, trace);
+
+		annonce("Recording forwards the operations");
+		for (int i = 0; i < 3000; i++) {
+			if (rand() % 3 && !recorded.empty()) {
+				if (rec.top() != recorded.top()) {
+					return Test_failure();
+				}
+				rec.pop();
+			}
+			else {
+				rec.push(i);
+			}
+		}
+		Test_success();
+	}
+
+	annonce("Replay gives the same stack");
+	PRE::stack<int>	replayed;
+	if (!trace_replay<stack_recorder>(buffer, ft::trace_stack, replayed) || replayed != recorded) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("A trace replays on its own container only");
+	buffer.clear();
+	buffer.seekg(0);
+	PRE::map<int, int>	map;
+	if (trace_replay<map_recorder>(buffer, ft::trace_map, map)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_trace() {
+	title("\e[93m Trace: \e[39m");
+	trace_test_format();
+	trace_test_map();
+	trace_test_vector();
+	trace_test_stack();
+};
@@ -0,0 +1,217 @@
+#include "../class/utils.hpp"
+
+typedef ft::tracking_allocator<int>												int_tracker;
+typedef ft::tracking_allocator< std::pair<const int, int> >	std_pair_tracker;
+typedef ft::tracking_allocator< PRE::pair<const int, int> >	pre_pair_tracker;
+
+// Tags of the per-tag counters
+struct tracking_tag_a {};
+struct tracking_tag_b {};
+
+/*
+**	The ft:: containers may allocate a little more than the std:: ones, but
+**	never in proportion to the number of elements: the budgets below allow
+**	the empty buffer of ft::vector and the end node of ft::map.
+*/
+
+static bool	tracking_within( const ft::allocation_stats& real, const ft::allocation_stats& mine, std::size_t extra ) {
+	if (mine.allocations > real.allocations + extra) {
+		std::cout << "Real allocations: " << real.allocations << std::endl;
+		std::cout << "Mine allocations: " << mine.allocations << std::endl;
+		return false;
+	}
+	return true;
+};
+
+void	tracking_allocator_test_vector() {
+	title("\e[95m-Vector-\e[39m");
+
+	ft::allocation_stats real_stats;
+	ft::allocation_stats mine_stats;
+	{
+		std::vector<int, int_tracker>	real((int_tracker(real_stats)));
+		PRE::vector<int, int_tracker>	mine((int_tracker(mine_stats)));
+
+		annonce("Push_back 1000 elements");
+		for (int i = 0; i < 1000; i++) {
+			real.push_back(i);
+			mine.push_back(i);
+		}
+		if (!tracking_within(real_stats, mine_stats, 1) || mine_stats.peak_bytes > real_stats.peak_bytes) {
+			return Test_failure();
+		}
+		Test_success();
+
+		annonce("Copy allocates once");
+		std::size_t before = mine_stats.allocations;
+		PRE::vector<int, int_tracker>	copy(mine);
+		if (mine_stats.allocations != before + 1 || copy.get_allocator() != mine.get_allocator()) {
+			return Test_failure();
+		}
+		Test_success();
+
+		annonce("No allocation within the capacity");
+		copy.reserve(5000);
+		before = mine_stats.allocations;
+		for (int i = 0; i < 4000; i++) {
+			copy.push_back(i);
+		}
+		copy.assign(10, 42);
+		copy.resize(3000);
+		if (mine_stats.allocations != before) {
+			return Test_failure();
+		}
+		Test_success();
+	}
+
+	annonce("Nothing leaks");
+	if (mine_stats.live_bytes != 0 || mine_stats.live() != 0 || real_stats.live_bytes != 0) {
+		std::cout << "Mine live bytes: " << mine_stats.live_bytes << std::endl;
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	tracking_allocator_test_map() {
+	title("\e[95m-Map-\e[39m");
+
+	ft::allocation_stats real_stats;
+	ft::allocation_stats mine_stats;
+	std::less<int> less;
+	{
+		std::map<int, int, std::less<int>, std_pair_tracker>	real(less, std_pair_tracker(real_stats));
+		PRE::map<int, int, std::less<int>, pre_pair_tracker>	mine(less, pre_pair_tracker(mine_stats));
+
+		annonce("Insert 1000 elements, the nodes count too");
+		for (int i = 0; i < 1000; i++) {
+			real[i * 7 % 1000] = i;
+			mine[i * 7 % 1000] = i;
+		}
+		if (!tracking_within(real_stats, mine_stats, 2) || mine_stats.allocations < 1000) {
+			return Test_failure();
+		}
+		Test_success();
+
+		annonce("Insert an existing key");
+		std::size_t before = mine_stats.allocations;
+		mine.insert(PRE::make_pair(5, 5));
+		mine[5] = 6;
+		if (mine_stats.allocations != before) {
+			return Test_failure();
+		}
+		Test_success();
+
+		annonce("Copy");
+		std::size_t real_before = real_stats.allocations;
+		before = mine_stats.allocations;
+		std::map<int, int, std::less<int>, std_pair_tracker>	real_copy(real);
+		PRE::map<int, int, std::less<int>, pre_pair_tracker>	copy(mine);
+		if (mine_stats.allocations - before > real_stats.allocations - real_before + 2) {
+			return Test_failure();
+		}
+		Test_success();
+
+		annonce("Erase frees the node");
+		std::size_t freed = mine_stats.deallocations;
+		mine.erase(5);
+		copy.clear();
+		if (mine_stats.deallocations != freed + 1001) {
+			std::cout << "Mine deallocations: " << mine_stats.deallocations - freed << std::endl;
+			return Test_failure();
+		}
+		Test_success();
+	}
+
+	annonce("Nothing leaks");
+	if (mine_stats.live_bytes != 0 || mine_stats.live() != 0) {
+		std::cout << "Mine live bytes: " << mine_stats.live_bytes << std::endl;
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	tracking_allocator_test_stack() {
+	title("\e[95m-Stack-\e[39m");
+
+	ft::allocation_stats real_stats;
+	ft::allocation_stats mine_stats;
+	{
+		std::stack< int, std::vector<int, int_tracker> >	real((std::vector<int, int_tracker>(int_tracker(real_stats))));
+		PRE::stack< int, PRE::vector<int, int_tracker> >	mine((PRE::vector<int, int_tracker>(int_tracker(mine_stats))));
+
+		annonce("Push 1000 elements through the container");
+		for (int i = 0; i < 1000; i++) {
+			real.push(i);
+			mine.push(i);
+		}
+		if (!tracking_within(real_stats, mine_stats, 2)) {
+			return Test_failure();
+		}
+		Test_success();
+
+		annonce("Pop does not allocate");
+		std::size_t before = mine_stats.allocations;
+		while (!mine.empty()) {
+			mine.pop();
+		}
+		if (mine_stats.allocations != before) {
+			return Test_failure();
+		}
+		Test_success();
+	}
+
+	annonce("Nothing leaks");
+	if (mine_stats.live_bytes != 0 || mine_stats.live() != 0) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	tracking_allocator_test_stats() {
+	title("\e[95m-Stats-\e[39m");
+
+	typedef ft::tracking_allocator<int, tracking_tag_a>		tracker_a;
+	typedef ft::tracking_allocator<int, tracking_tag_b>		tracker_b;
+
+	annonce("Default allocators count per tag");
+	tracker_a::tag_stats().reset();
+	tracker_b::tag_stats().reset();
+	{
+		PRE::vector<int, tracker_a>	a1(100);
+		PRE::vector<int, tracker_a>	a2(50);
+		PRE::vector<int, tracker_b>	b(10);
+		if (tracker_a::tag_stats().live_bytes != 150 * sizeof(int) || tracker_b::tag_stats().live_bytes != 10 * sizeof(int)
+			|| a1.get_allocator() != a2.get_allocator()) {
+			return Test_failure();
+		}
+	}
+	if (tracker_a::tag_stats().live_bytes != 0 || tracker_b::tag_stats().peak_bytes != 10 * sizeof(int)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Allocators built on stats count per instance");
+	ft::allocation_stats one;
+	ft::allocation_stats two;
+	tracker_a	first(one);
+	tracker_a	second(two);
+	ft::tracking_allocator<char, tracking_tag_a>	rebound(first);
+	if (first == second || rebound != first || &rebound.stats() != &one) {
+		return Test_failure();
+	}
+	rebound.deallocate(rebound.allocate(64), 64);
+	second.deallocate(second.allocate(2), 2);
+	if (one.allocations != 1 || one.peak_bytes != 64 || one.allocated_bytes != 64
+		|| two.deallocations != 1 || two.peak_bytes != 2 * sizeof(int) || tracker_a::tag_stats().allocations != 2) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_tracking_allocator() {
+	title("\e[93m Tracking_allocator: \e[39m");
+	tracking_allocator_test_vector();
+	tracking_allocator_test_map();
+	tracking_allocator_test_stack();
+	tracking_allocator_test_stats();
+};
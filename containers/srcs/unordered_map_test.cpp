@@ -0,0 +1,263 @@
+#include "../class/utils.hpp"
+
+// Check that an unordered_map holds exactly the same elements as a std::map, in any order
+template< class Real, class Mine >
+bool	unordered_same_content( const Real& real, const Mine& mine ) {
+	if (real.size() != mine.size()) {
+		std::cout << "Real map: " << real.size() << std::endl;
+		std::cout << "Mine map: " << mine.size() << std::endl;
+		return false;
+	}
+	std::size_t visited = 0;
+	for (typename Mine::const_iterator it = mine.begin(); it != mine.end(); ++it, ++visited) {
+		typename Real::const_iterator found = real.find(it->first);
+		if (found == real.end() || found->second != it->second) {
+			return false;
+		}
+	}
+	return visited == real.size();
+};
+
+void	unordered_map_test_insert() {
+	title("\e[95m-Insert-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>						real;
+	ft::unordered_map<int, int>	mine;
+
+	annonce("Insert 10000 random keys");
+	for (int i = 0; i < 10000; i++) {
+		int k = rand() % 20000 - 10000;
+		bool r = real.insert(std::make_pair(k, i)).second;
+		ft::pair<ft::unordered_map<int, int>::iterator, bool> m = mine.insert(ft::make_pair(k, i));
+		if (r != m.second || m.first->first != k) {
+			return Test_failure();
+		}
+	}
+	if (!unordered_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Operator []");
+	for (int k = -100; k < 100; k++) {
+		real[k] += k;
+		mine[k] += k;
+	}
+	if (!unordered_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Range constructor");
+	std::vector< ft::pair<int, int> > values;
+	for (int i = 0; i < 1000; i++) {
+		values.push_back(ft::make_pair(i % 700, i));
+	}
+	ft::unordered_map<int, int> range(values.begin(), values.end());
+	if (range.size() != 700 || range.at(0) != 0 || range.at(699) != 699) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	unordered_map_test_find() {
+	title("\e[95m-Find-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>						real;
+	ft::unordered_map<int, int>	mine;
+	for (int i = 0; i < 5000; i++) {
+		int k = rand() % 10000;
+		real[k] = i;
+		mine[k] = i;
+	}
+
+	annonce("Find, count and at");
+	for (int k = -10; k < 10010; k++) {
+		std::map<int, int>::iterator rit = real.find(k);
+		ft::unordered_map<int, int>::iterator mit = mine.find(k);
+		if ((rit == real.end()) != (mit == mine.end()) || real.count(k) != mine.count(k)) {
+			return Test_failure();
+		}
+		if (rit != real.end() && (mit->second != rit->second || mine.at(k) != real.at(k))) {
+			return Test_failure();
+		}
+	}
+	Test_success();
+
+	annonce("Equal_range");
+	ft::pair<ft::unordered_map<int, int>::iterator, ft::unordered_map<int, int>::iterator> range = mine.equal_range(real.begin()->first);
+	ft::unordered_map<int, int>::iterator next = range.first;
+	if (range.first == mine.end() || ++next != range.second || mine.equal_range(-1).first != mine.end()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("At out of range");
+	try {
+		mine.at(-1);
+		return Test_failure();
+	}
+	catch (const std::exception& e) {
+		;
+	}
+	Test_success();
+};
+
+void	unordered_map_test_erase() {
+	title("\e[95m-Erase-\e[39m");
+	srand(time(NULL));
+
+	std::map<int, int>						real;
+	ft::unordered_map<int, int>	mine;
+	for (int i = 0; i < 10000; i++) {
+		real[i] = i;
+		mine[i] = i;
+	}
+
+	annonce("Erase random keys");
+	for (int i = 0; i < 20000; i++) {
+		int k = rand() % 12000;
+		if (real.erase(k) != mine.erase(k)) {
+			return Test_failure();
+		}
+	}
+	if (!unordered_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase while iterating");
+	for (ft::unordered_map<int, int>::iterator it = mine.begin(); it != mine.end(); ) {
+		ft::unordered_map<int, int>::iterator next = it;
+		++next;
+		if (it->first % 3 == 0) {
+			real.erase(it->first);
+			mine.erase(it);
+		}
+		it = next;
+	}
+	if (!unordered_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Insert and erase cycles keep the table small");
+	ft::unordered_map<int, int> churn;
+	for (int round = 0; round < 200; round++) {
+		for (int i = 0; i < 100; i++) {
+			churn[round * 100 + i] = i;
+		}
+		for (int i = 0; i < 100; i++) {
+			churn.erase(round * 100 + i);
+		}
+	}
+	if (!churn.empty() || churn.bucket_count() > 256 || churn.begin() != churn.end()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Erase everything");
+	mine.erase(mine.begin(), mine.end());
+	if (!mine.empty() || mine.begin() != mine.end() || mine.count(1) != 0) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	unordered_map_test_reserve() {
+	title("\e[95m-Reserve-\e[39m");
+
+	ft::unordered_map<int, int> mine;
+
+	annonce("No rebuild after reserve");
+	mine.reserve(5000);
+	std::size_t buckets = mine.bucket_count();
+	for (int i = 0; i < 5000; i++) {
+		mine[i] = i;
+	}
+	if (mine.bucket_count() != buckets || mine.load_factor() > mine.max_load_factor()) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Rehash");
+	mine.rehash(0);
+	if (mine.size() != 5000 || mine.bucket_count() < 5000 || mine.at(4999) != 4999) {
+		return Test_failure();
+	}
+	mine.clear();
+	mine.rehash(0);
+	if (mine.bucket_count() != 16 || !mine.empty()) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	unordered_map_test_strings() {
+	title("\e[95m-String keys-\e[39m");
+
+	std::map<std::string, int>						real;
+	ft::unordered_map<std::string, int>	mine;
+
+	annonce("Insert and erase strings");
+	for (int i = 0; i < 3000; i++) {
+		std::ostringstream key;
+		key << "key" << (i * 7919) % 3001;
+		real[key.str()] = i;
+		mine[key.str()] = i;
+	}
+	for (int i = 0; i < 3000; i += 3) {
+		std::ostringstream key;
+		key << "key" << i;
+		real.erase(key.str());
+		mine.erase(key.str());
+	}
+	if (!unordered_same_content(real, mine)) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	unordered_map_test_copy_swap() {
+	title("\e[95m-Copy and swap-\e[39m");
+
+	ft::unordered_map<int, int>	mine;
+	for (int i = 0; i < 2000; i++) {
+		mine[i] = i;
+	}
+
+	annonce("Copy constructor and operator =");
+	ft::unordered_map<int, int>	copy(mine);
+	ft::unordered_map<int, int>	assigned;
+	assigned[-1] = -1;
+	assigned = mine;
+	if (copy != mine || assigned != mine) {
+		return Test_failure();
+	}
+	copy[0] = 42;
+	if (copy == mine) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Swap");
+	ft::unordered_map<int, int>	other;
+	other[42] = 42;
+	other.swap(assigned);
+	if (other != mine || assigned.size() != 1 || assigned.begin()->first != 42) {
+		return Test_failure();
+	}
+	Test_success();
+};
+
+void	launch_unordered_map() {
+	title("\e[93m Unordered_map: \e[39m");
+	unordered_map_test_insert();
+	unordered_map_test_find();
+	unordered_map_test_erase();
+	unordered_map_test_reserve();
+	unordered_map_test_strings();
+	unordered_map_test_copy_swap();
+};
@@ -12,14 +12,33 @@ void	Test_failure() {
 	std::cout << "\e[31m[KO]\e[39m" << std::endl;
 }
 
-void	Test_performance(long real_time, long mine_time) {
-	if (mine_time <= real_time * 20) {
+/*
+**	Test_performance
+**
+**	Mine passes when its median is at most PERF_RATIO times the median of real.
+**	Both come from repeated measurements, from an ft::perf_timer or perf_step,
+**	and their distributions are printed.
+*/
+
+static void	perf_print( const char *name, const ft::perf_stats& s ) {
+	std::ios_base::fmtflags flags = std::cout.flags();
+	std::streamsize precision = std::cout.precision();
+	std::cout << std::fixed << std::setprecision(1) << "  " << std::left << std::setw(6) << name << std::right
+		<< " median " << std::setw(10) << s.median << "  p90 " << std::setw(10) << s.p90
+		<< "  p99 " << std::setw(10) << s.p99 << "  stddev " << std::setw(9) << s.stddev
+		<< "  ns/op (" << s.samples << " samples)" << std::endl;
+	std::cout.flags(flags);
+	std::cout.precision(precision);
+}
+
+void	Test_performance(const ft::perf_stats& real, const ft::perf_stats& mine) {
+	perf_print("real", real);
+	perf_print("mine", mine);
+	if (mine.median <= real.median * PERF_RATIO) {
 		Test_success();
 	}
 	else {
 		Test_timeout();
-		std::cout << "Real time: " << real_time << std::endl;
-		std::cout << "Mine time: " << mine_time << std::endl;
 	}
 }
 
@@ -30,12 +49,3 @@ void	Test_success() {
 void	Test_timeout() {
 	std::cout << "\e[93m[TIMEOUT]\e[39m" << std::endl;
 }
-
-long	get_time() {
-	struct timeval tv;
-	long time;
-
-	gettimeofday(&tv, NULL);
-	time = tv.tv_sec * 1000 + tv.tv_usec / 1000;
-	return (time);
-}
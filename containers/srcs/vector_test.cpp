@@ -1,81 +1,227 @@
 #include "../class/utils.hpp"
 
+// Steps of the vector tests, timed by perf_step
+struct vector_step_fill
+{
+	template< class Vector >
+	void	operator()( Vector& v ) const {
+		v.push_back(44);
+		v.push_back(-34);
+		v.push_back(112);
+	};
+};
+
+struct vector_step_fill_construct
+{
+	template< class Vector >
+	void	operator()( Vector& ) const {
+		Vector v(3, 42);
+		ft::do_not_optimize(v);
+	};
+};
+
+struct vector_step_assign
+{
+	std::size_t	count;
+	int					value;
+
+	vector_step_assign( std::size_t n, int v )
+		: count(n), value(v) {
+	};
+
+	template< class Vector >
+	void	operator()( Vector& v ) const {
+		v.assign(count, value);
+	};
+};
+
+template< class Vector >
+struct vector_step_assign_range
+{
+	const Vector	*src;
+
+	explicit vector_step_assign_range( const Vector& v )
+		: src(&v) {
+	};
+
+	void	operator()( Vector& v ) const {
+		v.assign(src->begin(), src->end());
+	};
+};
+
+struct vector_step_reserve
+{
+	std::size_t	count;
+
+	explicit vector_step_reserve( std::size_t n )
+		: count(n) {
+	};
+
+	template< class Vector >
+	void	operator()( Vector& v ) const {
+		v.reserve(count);
+	};
+};
+
+struct vector_step_insert
+{
+	std::size_t	index;
+	std::size_t	count;
+	int					value;
+
+	vector_step_insert( std::size_t i, std::size_t n, int v )
+		: index(i), count(n), value(v) {
+	};
+
+	template< class Vector >
+	void	operator()( Vector& v ) const {
+		if (count == 1) {
+			v.insert(v.begin() + index, value);
+		}
+		else {
+			v.insert(v.begin() + index, count, value);
+		}
+	};
+};
+
+template< class Vector >
+struct vector_step_insert_range
+{
+	std::size_t		index;
+	const Vector	*src;
+
+	vector_step_insert_range( std::size_t i, const Vector& v )
+		: index(i), src(&v) {
+	};
+
+	void	operator()( Vector& v ) const {
+		v.insert(v.begin() + index, src->begin(), src->end());
+	};
+};
+
+struct vector_step_erase
+{
+	std::size_t	first;
+	std::size_t	last;
+
+	vector_step_erase( std::size_t f, std::size_t l )
+		: first(f), last(l) {
+	};
+
+	template< class Vector >
+	void	operator()( Vector& v ) const {
+		if (last == first + 1) {
+			v.erase(v.begin() + first);
+		}
+		else {
+			v.erase(v.begin() + first, v.begin() + last);
+		}
+	};
+};
+
+struct vector_step_push_back
+{
+	int	count;
+
+	explicit vector_step_push_back( int n )
+		: count(n) {
+	};
+
+	template< class Vector >
+	void	operator()( Vector& v ) const {
+		for (int i = 0; i < count; i++) {
+			v.push_back(1);
+		}
+	};
+};
+
+struct vector_step_pop_back
+{
+	int	count;
+
+	explicit vector_step_pop_back( int n )
+		: count(n) {
+	};
+
+	template< class Vector >
+	void	operator()( Vector& v ) const {
+		for (int i = 0; i < count; i++) {
+			v.pop_back();
+		}
+	};
+};
+
+struct vector_step_resize
+{
+	std::size_t	count;
+
+	explicit vector_step_resize( std::size_t n )
+		: count(n) {
+	};
+
+	template< class Vector >
+	void	operator()( Vector& v ) const {
+		v.resize(count);
+	};
+};
+
 void	vector_test_constructors() {
 	title("\e[95m-Constructors-\e[39m");
 
 	annonce("Default constructor");
 
-	long time = get_time();
 	std::vector<int> real;
 	real.push_back(44);
 	real.push_back(-34);
 	real.push_back(112);
-	long real_time = get_time() - time;
 
-	time = get_time();
 	PRE::vector<int>		mine;
 	mine.push_back(44);
 	mine.push_back(-34);
 	mine.push_back(112);
-	long mine_time = get_time() - time;
-	Test_performance(real_time, mine_time);
+	if (!ft::equal(real.begin(), real.end(), mine.begin())) {
+		return Test_failure();
+	}
+	Test_performance(perf_step(std::vector<int>(), vector_step_fill()), perf_step(PRE::vector<int>(), vector_step_fill()));
 
 	annonce("Fill constructor");
 
-	time = get_time();
 	std::vector<int>		real1(3, 42);
-	real_time = get_time() - time;
-
-	time = get_time();
 	PRE::vector<int>		mine1(3, 42);
-	mine_time = get_time() - time;
 	if (!ft::equal(real1.begin(), real1.end(), mine1.begin())) {
 		std::cout << "Mine vector: " << mine1.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(perf_step(std::vector<int>(), vector_step_fill_construct()), perf_step(PRE::vector<int>(), vector_step_fill_construct()));
 
 	annonce("Range constructor");
 
-	time = get_time();
 	std::vector<int>		real2(real1.begin(), real1.end());
-	real_time = get_time() - time;
-
-	time = get_time();
 	PRE::vector<int>	mine2(mine.begin(), mine.end());
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), mine2.begin())) {
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(perf_step(real, step_range_construct()), perf_step(mine, step_range_construct()));
 
 	annonce("Copy constructor");
 
-	time = get_time();
 	std::vector<int>		real3(real2);
-	real_time = get_time() - time;
-
-	time = get_time();
 	PRE::vector<int> mine3(mine);
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), mine3.begin())) {
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(perf_step(real, step_copy()), perf_step(mine, step_copy()));
 
 	annonce("Operator =");
 
-	time = get_time();
-	std::vector<int>		real4 = real3;
-	real_time = get_time() - time;
-
-	time = get_time();
-	PRE::vector<int> mine4 = mine;
-	mine_time = get_time() - time;
+	std::vector<int>		real4;
+	real4 = real3;
+	PRE::vector<int> mine4;
+	mine4 = mine;
 	if (!ft::equal(mine.begin(), mine.end(), mine4.begin())) {
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(perf_step(real, step_assign()), perf_step(mine, step_assign()));
 };
 
 void vector_test_assign() {
@@ -88,55 +234,49 @@ void vector_test_assign() {
 	annonce("Assign 1000 value");
 	int i = rand() % 2147483647;
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, vector_step_assign(1000, i));
+	ft::perf_stats mine_perf = perf_step(mine, vector_step_assign(1000, i));
 	real.assign(1000,i);
-	long real_time = get_time() - time;
 
-	time = get_time();
 	mine.assign(1000,i);
-	long mine_time = get_time() - time;
 	if (!ft::equal(real.begin(), real.end(), mine.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Assign 1000000 value");
 	i = rand() % 2147483647;
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_assign(1000000, i));
+	mine_perf = perf_step(mine, vector_step_assign(1000000, i));
 	real.assign(1000000,i);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.assign(1000000,i);
-	mine_time = get_time() - time;
 	if (!ft::equal(real.begin(), real.end(), mine.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	std::vector<int>	real2;
 	PRE::vector<int>		mine2;
 
 	annonce("Assign range");
 
-	time = get_time();
+	real_perf = perf_step(real2, vector_step_assign_range< std::vector<int> >(real));
+	mine_perf = perf_step(mine2, vector_step_assign_range< PRE::vector<int> >(mine));
 	real2.assign(real.begin(), real.end());
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine2.assign(mine.begin(), mine.end());
-	mine_time = get_time() - time;
 	if (!ft::equal(real2.begin(), real2.end(), mine2.begin())) {
 		std::cout << "Real vector: " << real2.size() << std::endl;
 		std::cout << "Mine vector: " << mine2.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 };
 
 void	vector_test_at() {
@@ -428,67 +568,59 @@ void	vector_test_reserve() {
 
 	annonce("Reserve with 0");
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, vector_step_reserve(0));
+	ft::perf_stats mine_perf = perf_step(mine, vector_step_reserve(0));
 	real.reserve(0);
-	long real_time = get_time() - time;
 
-	time = get_time();
 	mine.reserve(0);
-	long mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.capacity() << std::endl;
 		std::cout << "Mine vector: " << mine.capacity() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Reserve with 1");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_reserve(1));
+	mine_perf = perf_step(mine, vector_step_reserve(1));
 	real.reserve(1);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.reserve(1);
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.capacity() << std::endl;
 		std::cout << "Mine vector: " << mine.capacity() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Reserve with 1000");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_reserve(1000));
+	mine_perf = perf_step(mine, vector_step_reserve(1000));
 	real.reserve(1000);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.reserve(1000);
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.capacity() << std::endl;
 		std::cout << "Mine vector: " << mine.capacity() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Reserve with 1000000");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_reserve(1000000));
+	mine_perf = perf_step(mine, vector_step_reserve(1000000));
 	real.reserve(1000000);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.reserve(1000000);
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.capacity() << std::endl;
 		std::cout << "Mine vector: " << mine.capacity() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 };
 
 void	vector_test_capacity() {
@@ -538,38 +670,34 @@ void	vector_test_clear() {
 
 	annonce("Clear with 0");
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, step_clear());
+	ft::perf_stats mine_perf = perf_step(mine, step_clear());
 	real.clear();
-	long real_time = get_time() - time;
 
-	time = get_time();
 	mine.clear();
-	long mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Clear with 1");
 
 	real.push_back(1);
 	mine.push_back(1);
 
-	time = get_time();
+	real_perf = perf_step(real, step_clear());
+	mine_perf = perf_step(mine, step_clear());
 	real.clear();
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.clear();
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Clear with 1000");
 	for (int i = 0; i < 1000; i++) {
@@ -577,19 +705,17 @@ void	vector_test_clear() {
 		mine.push_back(1);
 	}
 
-	time = get_time();
+	real_perf = perf_step(real, step_clear());
+	mine_perf = perf_step(mine, step_clear());
 	real.clear();
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.clear();
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 };
 
 void	vector_test_insert() {
@@ -601,102 +727,104 @@ void	vector_test_insert() {
 
 	annonce("Insert 2 element at begin");
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, vector_step_insert(0, 1, 2));
+	ft::perf_stats mine_perf = perf_step(mine, vector_step_insert(0, 1, 2));
 	real.insert(real.begin(), 2);
-	long real_time = get_time() - time;
 
-	time = get_time();
 	mine.insert(mine.begin(), 2);
-	long mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Insert 1 element");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_insert(1, 1, 1));
+	mine_perf = perf_step(mine, vector_step_insert(1, 1, 1));
 	real.insert(real.begin() + 1, 1);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.insert(mine.begin() + 1, 1);
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
+
+	annonce("Insert 1 element at the begin of a full vector");
+	while (real.size() < 8) {
+		real.push_back(static_cast<int>(real.size()));
+		mine.push_back(static_cast<int>(mine.size()));
+	}
+	real.insert(real.begin(), 42);
+	mine.insert(mine.begin(), 42);
+	if (real.size() != mine.size() || !ft::equal(mine.begin(), mine.end(), real.begin())) {
+		std::cout << "Real vector: " << real.size() << std::endl;
+		std::cout << "Mine vector: " << mine.size() << std::endl;
+		return Test_failure();
+	}
+	Test_success();
 
 	annonce("Insert 100 elements at the begin");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_insert(0, 100, 1));
+	mine_perf = perf_step(mine, vector_step_insert(0, 100, 1));
 	real.insert(real.begin(), 100, 1);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.insert(mine.begin(), 100, 1);
-	mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Insert 4 elements");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_insert(real.size() - 42, 4, 1));
+	mine_perf = perf_step(mine, vector_step_insert(real.size() - 42, 4, 1));
 	real.insert(real.end() - 42, 4, 1);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.insert(mine.end() - 42, 4, 1);
-	mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	std::vector<int>	real2;
 	PRE::vector<int>		mine2;
 
 	annonce("Insert with range at begin");
 
-	time = get_time();
+	real_perf = perf_step(real2, vector_step_insert_range< std::vector<int> >(0, real));
+	mine_perf = perf_step(mine2, vector_step_insert_range< PRE::vector<int> >(0, mine));
 	real2.insert(real2.begin(), real.begin(), real.end());
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine2.insert(mine2.begin(), mine.begin(), mine.end());
-	mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real vector: " << real2.size() << std::endl;
 		std::cout << "Mine vector: " << mine2.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Insert with range");
 
-	time = get_time();
+	real_perf = perf_step(real2, vector_step_insert_range< std::vector<int> >(42, real));
+	mine_perf = perf_step(mine2, vector_step_insert_range< PRE::vector<int> >(42, mine));
 	real2.insert(real2.begin() + 42, real.begin(), real.end());
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine2.insert(mine2.begin() + 42, mine.begin(), mine.end());
-	mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real vector: " << real2.size() << std::endl;
 		std::cout << "Mine vector: " << mine2.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 };
 
 void	vector_test_erase() {
@@ -710,19 +838,17 @@ void	vector_test_erase() {
 	real.push_back(1);
 	mine.push_back(1);
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, vector_step_erase(0, 1));
+	ft::perf_stats mine_perf = perf_step(mine, vector_step_erase(0, 1));
 	real.erase(real.begin());
-	long real_time = get_time() - time;
 
-	time = get_time();
 	mine.erase(mine.begin());
-	long mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Erase 1 element");
 	for (int i = 0; i < 100; i++) {
@@ -730,51 +856,63 @@ void	vector_test_erase() {
 		mine.push_back(1);
 	}
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_erase(real.size() - 42, real.size() - 41));
+	mine_perf = perf_step(mine, vector_step_erase(real.size() - 42, real.size() - 41));
 	real.erase(real.end() - 42);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.erase(mine.end() - 42);
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Erase 15 elements with range");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_erase(42, 57));
+	mine_perf = perf_step(mine, vector_step_erase(42, 57));
 	real.erase(real.begin() + 42, real.begin() + 57);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.erase(mine.begin() + 42, mine.begin() + 57);
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
+
+	annonce("Erase strings with spare capacity");
+	std::vector<std::string>	real_str;
+	PRE::vector<std::string>	mine_str;
+	real_str.reserve(64);
+	mine_str.reserve(64);
+	for (int i = 0; i < 20; i++) {
+		real_str.push_back(std::string(40, 'a' + i));
+		mine_str.push_back(std::string(40, 'a' + i));
+	}
+	real_str.erase(real_str.begin() + 3);
+	mine_str.erase(mine_str.begin() + 3);
+	real_str.erase(real_str.begin(), real_str.begin() + 5);
+	mine_str.erase(mine_str.begin(), mine_str.begin() + 5);
+	if (real_str.size() != mine_str.size() || !ft::equal(mine_str.begin(), mine_str.end(), real_str.begin())) {
+		return Test_failure();
+	}
+	Test_success();
 
 	annonce("Erase all with range");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_erase(0, real.size()));
+	mine_perf = perf_step(mine, vector_step_erase(0, real.size()));
 	real.erase(real.begin(), real.end());
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.erase(mine.begin(), mine.end());
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 };
 
 void	vector_test_push_back() {
@@ -786,39 +924,35 @@ void	vector_test_push_back() {
 
 	annonce("Push 1 element");
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, vector_step_push_back(1));
+	ft::perf_stats mine_perf = perf_step(mine, vector_step_push_back(1));
 	real.push_back(1);
-	long real_time = get_time() - time;
 
-	time = get_time();
 	mine.push_back(1);
-	long mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.back() << std::endl;
 		std::cout << "Mine vector: " << mine.back() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Push 1000 elements");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_push_back(1000));
+	mine_perf = perf_step(mine, vector_step_push_back(1000));
 	for (int i = 0; i < 1000; i++) {
 		real.push_back(1);
 	}
-	real_time = get_time() - time;
 
-	time = get_time();
 	for (int i = 0; i < 1000; i++) {
 		mine.push_back(1);
 	}
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.back() << std::endl;
 		std::cout << "Mine vector: " << mine.back() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 };
 
 void	vector_test_pop_back() {
@@ -832,19 +966,17 @@ void	vector_test_pop_back() {
 	real.push_back(1);
 	mine.push_back(1);
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, vector_step_pop_back(1));
+	ft::perf_stats mine_perf = perf_step(mine, vector_step_pop_back(1));
 	real.pop_back();
-	long real_time = get_time() - time;
 
-	time = get_time();
 	mine.pop_back();
-	long mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.back() << std::endl;
 		std::cout << "Mine vector: " << mine.back() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Pop 1000 elements");
 	for (int i = 0; i < 1000; i++) {
@@ -852,23 +984,21 @@ void	vector_test_pop_back() {
 		mine.push_back(1);
 	}
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_pop_back(1000));
+	mine_perf = perf_step(mine, vector_step_pop_back(1000));
 	for (int i = 0; i < 1000; i++) {
 		real.pop_back();
 	}
-	real_time = get_time() - time;
 
-	time = get_time();
 	for (int i = 0; i < 1000; i++) {
 		mine.pop_back();
 	}
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.back() << std::endl;
 		std::cout << "Mine vector: " << mine.back() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 };
 
 void	vector_test_resize() {
@@ -880,51 +1010,45 @@ void	vector_test_resize() {
 
 	annonce("Resize from 0 to 1 element");
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, vector_step_resize(1));
+	ft::perf_stats mine_perf = perf_step(mine, vector_step_resize(1));
 	real.resize(1);
-	long real_time = get_time() - time;
 
-	time = get_time();
 	mine.resize(1);
-	long mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Resize from 1 to 1000 elements");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_resize(1000));
+	mine_perf = perf_step(mine, vector_step_resize(1000));
 	real.resize(1000);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.resize(1000);
-	mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Resize 1000 to 50 elements");
 
-	time = get_time();
+	real_perf = perf_step(real, vector_step_resize(50));
+	mine_perf = perf_step(mine, vector_step_resize(50));
 	real.resize(50);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.resize(50);
-	mine_time = get_time() - time;
 	if (real.size() != mine.size()) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 };
 
 void	vector_test_swap() {
@@ -938,19 +1062,17 @@ void	vector_test_swap() {
 	real.push_back(1);
 	mine.push_back(1);
 
-	long time = get_time();
+	ft::perf_stats real_perf = perf_step(real, step_swap_self());
+	ft::perf_stats mine_perf = perf_step(mine, step_swap_self());
 	real.swap(real);
-	long real_time = get_time() - time;
 
-	time = get_time();
 	mine.swap(mine);
-	long mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
 
 	annonce("Swap 1000 elements");
 	for (int i = 0; i < 1000; i++) {
@@ -958,20 +1080,72 @@ void	vector_test_swap() {
 		mine.push_back(1);
 	}
 
-	time = get_time();
+	real_perf = perf_step(real, step_swap_self());
+	mine_perf = perf_step(mine, step_swap_self());
 	real.swap(real);
-	real_time = get_time() - time;
 
-	time = get_time();
 	mine.swap(mine);
-	mine_time = get_time() - time;
 	if (!ft::equal(mine.begin(), mine.end(), real.begin())) {
 		std::cout << "Real vector: " << real.size() << std::endl;
 		std::cout << "Mine vector: " << mine.size() << std::endl;
 		return Test_failure();
 	}
-	Test_performance(real_time, mine_time);
+	Test_performance(real_perf, mine_perf);
+};
+
+# ifdef FT_VECTOR_TELEMETRY
+static std::vector<ft::vector_event>	g_vector_events;
+
+static void	vector_record_event( const ft::vector_event& event, void *context ) {
+	static_cast<std::vector<ft::vector_event> *>(context)->push_back(event);
+}
+
+void	vector_test_telemetry() {
+	title("\e[95m-Telemetry-\e[39m");
+
+	ft::reset_vector_telemetry();
+	g_vector_events.clear();
+	ft::set_vector_telemetry_hook(vector_record_event, &g_vector_events);
+
+	annonce("Reallocations of push_back");
+	ft::vector<int>	mine;
+	for (int i = 0; i < 1000; i++) {
+		mine.push_back(i);
+	}
+	ft::vector_telemetry t = ft::vector_telemetry_counters();
+	// Capacities 1, 2, 4 ... 1024: 11 reallocations moving 1 + 2 + ... + 512 elements
+	if (t.reallocations != 11 || t.reallocated_elements != 1023 || t.largest_reallocation != 1024 * sizeof(int)
+		|| t.shifted_elements != 0 || g_vector_events.size() != 11 || g_vector_events.back().spare_bytes != 512 * sizeof(int)
+		|| mine.spare_bytes() != 24 * sizeof(int)) {
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("Elements moved by insert and erase");
+	ft::reset_vector_telemetry();
+	g_vector_events.clear();
+	mine.insert(mine.begin() + 900, 7);
+	mine.erase(mine.begin() + 10);
+	mine.erase(mine.begin() + 100, mine.begin() + 200);
+	mine.insert(mine.end(), 3, 7);
+	t = ft::vector_telemetry_counters();
+	// Inserting at the end shifts nothing, which is not an event
+	if (t.shifted_elements != 100 + 990 + 800 || t.reallocations != 0 || g_vector_events.size() != 3
+		|| g_vector_events[0].kind != ft::vector_shift || g_vector_events[0].bytes != 100 * sizeof(int)) {
+		std::cout << "Shifted: " << t.shifted_elements << std::endl;
+		return Test_failure();
+	}
+	Test_success();
+
+	annonce("No hook");
+	ft::set_vector_telemetry_hook(NULL);
+	mine.reserve(5000);
+	if (ft::vector_telemetry_counters().reallocations != 1 || g_vector_events.size() != 3) {
+		return Test_failure();
+	}
+	Test_success();
 };
+# endif
 
 void launch_vector() {
 	title("\e[93m Functions: \e[39m");
@@ -994,6 +1168,9 @@ void launch_vector() {
 	vector_test_pop_back();
 	vector_test_resize();
 	vector_test_swap();
+# ifdef FT_VECTOR_TELEMETRY
+	vector_test_telemetry();
+# endif
 };
 
 